@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace engine {
+
+/**
+ * AssetCache - Content-addressed identity and derived data for source assets
+ *
+ * - Key = FNV-1a over the asset type, its import settings, the file's bytes
+ *   and, recursively, the keys of everything it reads (scene -> model ->
+ *   .mtl / buffers / images). The path is not part of the key, so the same
+ *   content under another name or path gets the same key and the loaders
+ *   share one GPU resource for it
+ * - Dependencies are discovered from the file (glTF buffers and images, OBJ
+ *   mtllib, .mtl texture maps) or declared by the caller (scenes)
+ * - File hashes and dependency lists are kept in <directory>/index.bin by
+ *   path, size and modification time: a warm start only stats the files
+ * - Derived data (imports, decodes) lives in <directory>/<key><extension>;
+ *   a changed input changes the key, so stale entries are never read
+ *
+ * Safe from any thread. Disabled, nothing is read from or written to the
+ * directory, but keys still work for in-memory sharing.
+ */
+class AssetCache {
+public:
+    enum class AssetType : uint32_t {
+        Model = 1,
+        Texture,
+        Shader,
+        Scene
+    };
+
+    struct Stats {
+        uint32_t hashed = 0;     // Files read and hashed
+        uint32_t unchanged = 0;  // Hashes reused after a stat
+        uint32_t hits = 0;       // Derived data found
+        uint32_t misses = 0;
+        uint32_t stored = 0;
+    };
+
+    static AssetCache& Instance();
+
+    ~AssetCache();
+
+    // Set before the first lookup; the index is read from here once
+    void SetDirectory(const std::string& dir);
+    const std::string& GetDirectory() const { return directory; }
+
+    void SetEnabled(bool enabled) { m_Enabled = enabled; }
+    bool IsEnabled() const { return m_Enabled; }
+
+    // FNV-1a of the file's bytes; 0 if it can't be read
+    uint64_t HashFile(const std::string& path);
+
+    // Files `path` reads besides itself, as paths usable from here
+    std::vector<std::string> GetDependencies(const std::string& path);
+
+    // External files in a .gltf/.glb's "buffers" or "images" section, resolved
+    // next to it (data: URIs skipped). The same discovery GetDependencies uses.
+    static std::vector<std::string> GetGltfReferences(const std::string& path, const char* section);
+
+    // For files the cache can't parse itself (scenes); replaced when the file changes
+    void SetDependencies(const std::string& path, std::vector<std::string> dependencies);
+
+    // 0 if `path` can't be read. Missing dependencies are part of the key.
+    uint64_t ComputeKey(AssetType type, const std::string& path, uint64_t settings = 0);
+
+    // ComputeKey from hashes already held for unchanged files: a stat per
+    // file, never a read. 0 if any of them would have to be hashed first.
+    uint64_t FindKey(AssetType type, const std::string& path, uint64_t settings = 0);
+
+    // Path of the derived entry if there is one, else empty (counts a hit or miss)
+    std::string FindDerived(uint64_t key, const char* extension);
+
+    // Writes the entry through `write(path)` unless disabled or another thread
+    // is already writing it. Returns whether this call stored it.
+    bool StoreDerived(uint64_t key, const char* extension, const std::function<bool(const std::string&)>& write);
+
+    // Persist file hashes and dependencies; a no-op when nothing changed
+    bool SaveIndex();
+
+    Stats GetStats() const;
+    void ResetStats();
+
+    // Delete Copy
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+
+private:
+    struct FileRecord {
+        uint64_t size = 0;
+        int64_t modified = 0;
+        uint64_t hash = 0;
+        bool dependenciesKnown = false;
+        std::vector<std::string> dependencies;
+    };
+
+    AssetCache() = default;
+
+    std::string directory = "asset_cache";
+    bool m_Enabled = true;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, FileRecord> files;  // By normalized path
+    std::unordered_set<uint64_t> storing;               // Derived entries being written
+    bool indexLoaded = false;
+    bool indexDirty = false;
+    Stats stats;
+
+    void loadIndexLocked();
+    uint64_t contentKey(const std::string& path, std::unordered_set<std::string>& visiting);
+    bool knownContentKey(const std::string& path, std::unordered_set<std::string>& visiting, uint64_t& key);
+    std::string derivedPath(uint64_t key, const char* extension) const;
+};
+
+} // namespace engine
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Engine/Rendering/Geometry/Mesh/MeshData.hpp"
+#include "Engine/Rendering/Geometry/Model/ModelHierarchy.hpp"
+#include <string>
+#include <vector>
+
+namespace engine {
+
+/**
+ * EMeshFormat - Engine-native binary mesh files (.emesh)
+ *
+ * One file holds every submesh of a model exactly as MeshData describes it:
+ * vertex/index blobs in final GPU layout, draw ranges, meshlets and bounds.
+ * Layout (native little-endian, blobs 16-byte aligned):
+ *
+ *   FileHeader | MeshRecord[meshCount] | per mesh: vertices, indices,
+ *   draw ranges, meshlets | hierarchy (nodes, materials; may be empty)
+ *
+ * Read() memory-maps the file and hands out MeshData whose vertex/index
+ * bytes point into the mapping, so nothing is parsed or copied before the
+ * GPU upload reads them. Produce files offline with Write() from importer
+ * output (ObjImporter / GltfImporter::ImportMeshes).
+ */
+class EMeshFormat {
+public:
+    static constexpr const char* Extension = ".emesh";
+
+    // Meshes must still have their bytes (MeshData::HasBytes)
+    static bool Write(const std::string& path, const std::vector<MeshData>& meshes,
+                      const ModelHierarchy* hierarchy = nullptr);
+
+    // Appends to `meshes` (and replaces `hierarchy`, whose mesh indices are
+    // then positions in `meshes`); false (with a message) for missing,
+    // truncated or foreign files
+    static bool Read(const std::string& path, std::vector<MeshData>& meshes,
+                     ModelHierarchy* hierarchy = nullptr);
+};
+
+} // namespace engine
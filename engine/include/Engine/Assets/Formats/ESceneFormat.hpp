@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Engine/Core/Utility/MappedFile.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace engine {
+
+/**
+ * ESceneFormat - Engine-native binary scenes (.escene)
+ *
+ * The JSON scene flattened into fixed-size record tables that the loader
+ * reads in place from a memory mapping:
+ *
+ *   FileHeader | assets | keywords | variant masks | entities | transforms |
+ *   components | materials | string bytes
+ *
+ * - Entities are stored parents first (parent index < own index), each with
+ *   a contiguous run of components and its child count, so a World can be
+ *   filled in one forward pass with every allocation sized up front
+ * - Materials are deduplicated (a named material is one record however
+ *   many components use it); components refer to them by index and carry
+ *   their own overrides, and the loader creates one Material per record
+ * - Asset references are names (models, meshes, textures, shaders) and the
+ *   scene's asset paths exactly as written in the JSON, relative to the
+ *   scene's directory
+ * - Strings live in one table, deduplicated, and are referenced by offset
+ *
+ * Produced from JSON by SceneLoader::ConvertScene (AssetCooker, AssetCache).
+ */
+class ESceneFormat {
+public:
+    static constexpr const char* Extension = ".escene";
+
+    struct StringRef {
+        uint32_t offset = 0;
+        uint32_t size = 0;
+    };
+
+    enum class AssetType : uint32_t { Texture, Shader, Model };
+    enum class ComponentType : uint32_t { Camera, MeshRenderer, Model };
+    enum class MaterialType : uint32_t { Tinted, Textured };
+
+    // Asset flags
+    static constexpr uint32_t KeepCpuData = 1u << 0;
+
+    // Material flags
+    static constexpr uint32_t Transparent = 1u << 0;
+
+    // Component override flags
+    static constexpr uint32_t OverrideTint = 1u << 0;
+
+    struct AssetRecord {
+        AssetType type;
+        uint32_t flags;
+        StringRef name;
+        StringRef path;          // Vertex stage for shaders
+        StringRef fragmentPath;  // Shaders only
+        uint32_t firstKeyword;   // Shaders: keywords[first, first + count)
+        uint32_t keywordCount;
+        uint32_t firstVariant;   // Shaders: feature masks to submit up front
+        uint32_t variantCount;
+    };
+
+    struct EntityRecord {
+        StringRef name;
+        int32_t parent;  // -1 for roots
+        uint32_t childCount;
+        uint32_t firstComponent;
+        uint32_t componentCount;
+    };
+
+    struct TransformRecord {
+        float position[3];
+        float rotation[3];  // Radians, applied as Rx * Ry * Rz
+        float scale[3];
+    };
+
+    struct ComponentRecord {
+        ComponentType type;
+        int32_t material;  // Index into materials, or -1
+        StringRef asset;   // Model name (MeshRenderer: the model holding the mesh)
+        int32_t meshIndex;
+        uint32_t cameraType;  // CameraComponent::Type
+        float fovY;           // Radians
+        float orthoHeight;
+        float nearPlane;
+        float farPlane;
+        uint32_t overrideFlags;  // MeshRenderer, Model: OverrideTint
+        float overrideTint[4];
+    };
+
+    struct PipelineRecord {
+        uint8_t faceCulling;
+        uint8_t depthTesting;
+        uint8_t depthMask;
+        uint8_t blending;
+        uint8_t colorMask[4];
+        uint32_t cullFace;
+        uint32_t depthFunc;
+        uint32_t blendSrc;
+        uint32_t blendDst;
+    };
+
+    struct SamplerRecord {
+        uint32_t minFilter;  // GL enums, defaults filled in
+        uint32_t magFilter;
+        uint32_t wrapS;
+        uint32_t wrapT;
+        uint32_t wrapR;
+    };
+
+    struct MaterialRecord {
+        MaterialType type;
+        uint32_t flags;
+        StringRef shader;   // Empty: none
+        StringRef maps[4];  // Texture names: albedo, specular, normal, emissive
+        float tint[4];            // 1,1,1,1 unless the JSON sets one
+        PipelineRecord pipeline;  // Complete state, defaults filled in
+        SamplerRecord sampler;    // Textured only
+    };
+
+    // Writer side: fill the tables, then Write()
+    struct Scene {
+        bool hasResidency = false;
+        double gpuBudgetMB = 0.0;
+        double cpuBudgetMB = 0.0;
+
+        std::vector<AssetRecord> assets;
+        std::vector<StringRef> keywords;
+        std::vector<uint32_t> variants;
+        std::vector<EntityRecord> entities;
+        std::vector<TransformRecord> transforms;  // One per entity
+        std::vector<ComponentRecord> components;
+        std::vector<MaterialRecord> materials;
+        std::string strings;
+
+        StringRef AddString(const std::string& s);
+
+    private:
+        std::unordered_map<std::string, StringRef> stringLookup;
+    };
+
+    // Reader side: tables point into the mapping, valid while the View lives
+    class View {
+    public:
+        bool hasResidency = false;
+        double gpuBudgetMB = 0.0;
+        double cpuBudgetMB = 0.0;
+
+        const AssetRecord* assets = nullptr;
+        const StringRef* keywords = nullptr;
+        const uint32_t* variants = nullptr;
+        const EntityRecord* entities = nullptr;
+        const TransformRecord* transforms = nullptr;
+        const ComponentRecord* components = nullptr;
+        const MaterialRecord* materials = nullptr;
+        uint32_t assetCount = 0;
+        uint32_t keywordCount = 0;
+        uint32_t variantCount = 0;
+        uint32_t entityCount = 0;
+        uint32_t componentCount = 0;
+        uint32_t materialCount = 0;
+
+        std::string_view GetString(StringRef ref) const {
+            return std::string_view(strings + ref.offset, ref.size);
+        }
+
+    private:
+        friend class ESceneFormat;
+        MappedFile file;
+        const char* strings = nullptr;
+    };
+
+    static bool IsEScenePath(const std::string& path);
+
+    static bool Write(const std::string& path, const Scene& scene);
+
+    // Maps the file and checks every table and cross-reference once, so the
+    // loader can index without further checks; false (with a message) for
+    // missing, truncated or foreign files
+    static bool Read(const std::string& path, View& view);
+};
+
+} // namespace engine
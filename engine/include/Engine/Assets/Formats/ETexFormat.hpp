@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace engine {
+
+/**
+ * ETexFormat - Engine-native pre-decoded textures (.etex)
+ *
+ * A small header followed by level-0 pixels, 8 bits per channel, rows
+ * tightly packed and bottom row first - exactly what Texture uploads - so
+ * loading is a memory map instead of a PNG/JPEG decode. Produced offline
+ * by the AssetCooker.
+ */
+class ETexFormat {
+public:
+    static constexpr const char* Extension = ".etex";
+
+    struct Image {
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        std::shared_ptr<const unsigned char> pixels;  // Keeps the mapping (or decode) alive
+    };
+
+    static bool IsETexPath(const std::string& path);
+
+    static bool Write(const std::string& path, const unsigned char* pixels, int width, int height, int channels);
+
+    // Pixels point into the mapped file; false (with a message) for missing or corrupt files
+    static bool Read(const std::string& path, Image& image);
+};
+
+} // namespace engine
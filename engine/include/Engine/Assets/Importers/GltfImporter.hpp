@@ -3,6 +3,7 @@
 #include "Engine/Rendering/Geometry/Model/Model.hpp"
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace engine {
 
@@ -13,13 +14,21 @@ namespace engine {
  *  - Mesh primitives (triangles)
  *  - POSITION / NORMAL / TEXCOORD_0
  *  - Indices (optional)
+ *  - Node hierarchy (local TRS, mesh references) and base-colour materials,
+ *    see ModelHierarchy; a mesh used by many nodes is imported once
  *
  * Future scope (animations):
- *  - Node hierarchy, skins, JOINTS_0/WEIGHTS_0, animation channels/samplers.
+ *  - Skins, JOINTS_0/WEIGHTS_0, animation channels/samplers.
  */
 class GltfImporter {
 public:
     static std::unique_ptr<Model> Import(const std::string& path);
+
+    // Packed meshes only: no GL objects, so it can run off the render thread
+    // (offline conversion to .emesh, worker threads). The hierarchy's mesh
+    // indices are positions in `meshes`.
+    static bool ImportMeshes(const std::string& path, std::vector<MeshData>& meshes,
+                             ModelHierarchy* hierarchy = nullptr);
 };
 
 } // namespace engine
@@ -3,6 +3,7 @@
 #include "Engine/Rendering/Geometry/Model/Model.hpp"
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace engine {
 
@@ -13,6 +14,10 @@ namespace engine {
 class ObjImporter {
 public:
     static std::unique_ptr<Model> Import(const std::string& path);
+
+    // Packed meshes only: no GL objects, so it can run off the render thread
+    // (offline conversion to .emesh, worker threads)
+    static bool ImportMeshes(const std::string& path, std::vector<MeshData>& meshes);
 };
 
 } // namespace engine
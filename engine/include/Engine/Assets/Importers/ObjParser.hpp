@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Engine/Rendering/Geometry/Mesh/VertexFormat.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace engine {
+
+/**
+ * ObjParser - Fast Wavefront OBJ geometry reader (CPU only, no GL calls)
+ *
+ * - The file is memory-mapped and split into newline-aligned chunks that
+ *   are tokenized in parallel on the JobSystem (memchr line scanning,
+ *   std::from_chars numbers); chunk results are stitched by prefix sums,
+ *   which also resolves negative (relative) indices
+ * - Faces are fan-triangulated; `o` and `g` start a new shape
+ * - Each shape's corners are welded into unique vertices through an
+ *   open-addressing table keyed by the (position, texcoord, normal) index
+ *   triple packed into 64 bits, or 96 when the counts don't fit
+ * - Geometry only: materials, smoothing groups, lines and points are skipped
+ */
+class ObjParser {
+public:
+    struct Shape {
+        std::string name;
+        std::vector<Vertex> vertices;
+        std::vector<unsigned int> indices;  // Triangle list
+    };
+
+    struct Result {
+        std::vector<Shape> shapes;     // Non-empty shapes in file order
+        bool hasNormals = false;       // The file declares any vn / vt
+        bool hasTexCoords = false;
+        size_t skippedTriangles = 0;   // Referenced a position that doesn't exist
+    };
+
+    // False (with a message) if the file can't be mapped
+    static bool Load(const std::string& path, Result& result);
+};
+
+} // namespace engine
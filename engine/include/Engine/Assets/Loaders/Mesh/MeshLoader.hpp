@@ -1,36 +1,71 @@
 #pragma once
 
 #include "Engine/Rendering/Geometry/Model/Model.hpp"
+#include <cstdint>
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <shared_mutex>
+#include <vector>
 
 namespace engine {
 
 /**
  * MeshLoader (actually a Model asset loader):
  * - Owns loaded Model assets (RAII)
- * - Chooses importer by file extension (.obj / .gltf / .glb)
- * - Avoids duplicate loads by caching by *path*
- * - Allows multiple names to reference the same loaded asset
+ * - Chooses importer by file extension (.obj / .gltf / .glb), or maps a
+ *   cooked .emesh file and uploads straight from the mapping
+ * - Avoids duplicate loads by caching by path and by content (AssetCache
+ *   key): the same file under another name or path shares one Model
+ * - Source imports (.obj / .gltf / .glb) are stored as .emesh derived data
+ *   in the AssetCache and mapped on later runs until an input changes
+ * - Releases the meshes' CPU copies after upload (the file is their reload
+ *   source) unless keepCpuData asks for them, e.g. for picking or collision
+ * - Get() is safe from any thread. Load()/Add() create GL buffers and must
+ *   run on the GL thread; do the import itself on workers with
+ *   ImportMeshData() and hand the result to Add()
  */
 class MeshLoader {
 private:
-    // Own by path (single owner)
-    std::unordered_map<std::string, std::unique_ptr<Model>> modelsByPath;
-    // Alias by user-given name (non-owning)
+    std::vector<std::unique_ptr<Model>> models;
+    // Aliases (non-owning)
+    std::unordered_map<std::string, Model*> modelsByPath;
     std::unordered_map<std::string, Model*> modelsByName;
+    std::unordered_map<uint64_t, Model*> modelsByContent;  // AssetCache key
+    mutable std::shared_mutex mutex;
 
-    MeshLoader() = default;
+    MeshLoader();
+
+    Model* add(const std::string& name, const std::string& path, uint64_t contentKey,
+               std::vector<MeshData> meshes, bool keepCpuData, ModelHierarchy hierarchy);
 
 public:
     static MeshLoader& Instance();
 
     ~MeshLoader();
 
-    Model* Load(const std::string& name, const std::string& path);
+    Model* Load(const std::string& name, const std::string& path, bool keepCpuData = false);
+
+    // Create a model from meshes (and node hierarchy) imported, e.g. on a worker,
+    // with ImportMeshData. Returns the already loaded model if the name, path
+    // or content is taken.
+    Model* Add(const std::string& name, const std::string& path, std::vector<MeshData> meshes,
+               bool keepCpuData = false, ModelHierarchy hierarchy = {});
+
     Model* Get(const std::string& name);
+
+    // Loaded under this name or from this path (content isn't checked)
+    bool IsLoaded(const std::string& name, const std::string& path) const;
+    // Drops this name; the model itself is destroyed (GL thread) once no other
+    // name refers to it. Pointers to it must not be used afterwards.
+    void Unload(const std::string& name);
     void Clear();
+
+    // Packed meshes for any supported file, without GL (offline conversion, workers);
+    // glTF and .emesh files also fill the node hierarchy when one is passed.
+    // Thread-safe; goes through the AssetCache for source formats.
+    static bool ImportMeshData(const std::string& path, std::vector<MeshData>& meshes,
+                               ModelHierarchy* hierarchy = nullptr);
 };
 
 } // namespace engine
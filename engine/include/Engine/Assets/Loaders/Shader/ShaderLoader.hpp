@@ -1,26 +1,84 @@
 #pragma once
 
 #include "Engine/Core/Graphics/Shader/Shader.hpp"
+#include <cstdint>
 #include <unordered_map>
 #include <memory>
+#include <shared_mutex>
 #include <string>
+#include <vector>
 
 namespace engine {
 
+/**
+ * ShaderLoader - Named shader programs and their keyword variants
+ *
+ * A shader may declare up to 32 keywords; keyword i maps to bit i of a
+ * feature mask. Each distinct mask compiles a variant with the enabled
+ * keywords #defined, built on first request and cached. Mask 0 is the
+ * base program returned by Get().
+ *
+ * Programs are keyed by content (preprocessed sources plus keywords):
+ * loading the same name with unchanged sources returns the existing program,
+ * and identical sources under another name share it, variants included.
+ *
+ * Lookups are safe from any thread. Anything that creates a program (Load,
+ * GetVariant on a miss) must run on the GL thread; the file reading and
+ * #include expansion can be done beforehand on a worker with Preprocess().
+ */
 class ShaderLoader {
 private:
-    std::unordered_map<std::string, std::shared_ptr<Shader>> shaders;
+    struct ShaderEntry {
+        std::string vertPath;
+        std::string fragPath;
+        std::vector<std::string> keywords;
+        std::unordered_map<uint32_t, std::shared_ptr<Shader>> variants;
+        uint64_t contentKey = 0;
+    };
+
+    // Names sharing content share the entry
+    std::unordered_map<std::string, std::shared_ptr<ShaderEntry>> shaders;
+    std::unordered_map<uint64_t, std::weak_ptr<ShaderEntry>> shadersByContent;
+    mutable std::shared_mutex mutex;
     
     ShaderLoader() = default;
     
 public:
+    static constexpr size_t MaxKeywords = 32;
+
+    // Base-variant stages after preprocessing (no keyword defines)
+    struct Sources {
+        std::string vertex;
+        std::string fragment;
+    };
+
     static ShaderLoader& Instance();
+
+    // Any thread: read both stages and expand their #includes
+    static bool Preprocess(const std::string& vertPath, const std::string& fragPath, Sources& sources);
     
     ~ShaderLoader();
     
     Shader* Load(const std::string& name, const std::string& vertPath, const std::string& fragPath);
+    Shader* Load(const std::string& name, const std::string& vertPath, const std::string& fragPath,
+                 const std::vector<std::string>& keywords);
+    // Same, from sources already produced by Preprocess()
+    Shader* Load(const std::string& name, const std::string& vertPath, const std::string& fragPath,
+                 const std::vector<std::string>& keywords, const Sources& sources);
     Shader* Get(const std::string& name);
+
+    // Bit for a declared keyword (0 if the shader doesn't declare it)
+    uint32_t GetKeywordBit(const std::string& name, const std::string& keyword) const;
+
+    // Variant for a feature mask; compiled on first request. Bits for
+    // undeclared keywords are ignored.
+    Shader* GetVariant(const std::string& name, uint32_t featureMask);
+
+    // GL thread: finish every submitted build (see Shader::Resolve), so each
+    // linked program reaches the binary cache whether or not it gets drawn
+    void ResolvePending();
+
     void Clear();
 };
 
-}
\ No newline at end of file
+}
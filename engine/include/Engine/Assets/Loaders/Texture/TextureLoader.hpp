@@ -1,24 +1,46 @@
 #pragma once
 
 #include "Engine/Core/Graphics/Texture/Texture.hpp"
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 #include <string>
+#include <vector>
 
 namespace engine {
 
+// Get() is safe from any thread; Load() creates the texture object and must
+// run on the GL thread (decoding already happens on workers, see TextureStreamer).
+// Files with identical contents (AssetCache key) share one texture whatever
+// their names or paths. Load() never reads the file to find that key: it
+// takes one hashed on a worker beforehand, or one the AssetCache already
+// knows. A texture loaded before its file was hashed becomes shareable once
+// its decode (on a worker) has hashed it.
 class TextureLoader {
 private:
-    std::unordered_map<std::string, Texture*> textures;
+    std::vector<std::unique_ptr<Texture>> owned;
+    // Aliases (non-owning)
+    std::unordered_map<std::string, Texture*> textures;  // By name
+    std::unordered_map<uint64_t, Texture*> texturesByContent;
+    std::unordered_map<Texture*, std::string> unkeyed;  // Path, until its key is known
+    mutable std::shared_mutex mutex;
     
-    TextureLoader() = default;
+    TextureLoader();
+
+    void keyDecodedLocked();
     
 public:
     static TextureLoader& Instance();
     
     ~TextureLoader();
     
-    Texture* Load(const std::string& name, const std::string& path);
+    // contentKey: AssetCache::ComputeKey(Texture, path) if the caller has it
+    Texture* Load(const std::string& name, const std::string& path, uint64_t contentKey = 0);
     Texture* Get(const std::string& name);
+    // Drops this name; the texture is destroyed (GL thread) once no other
+    // name refers to it
+    void Unload(const std::string& name);
     void Clear();
 };
 
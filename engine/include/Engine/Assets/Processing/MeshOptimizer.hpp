@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Engine/Rendering/Geometry/Mesh/VertexFormat.hpp"
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace engine {
+
+/**
+ * MeshOptimizer - Import-time geometry reordering (CPU only, no GL calls)
+ *
+ * Runs on raw importer output, before a Mesh is built:
+ * 1. Weld bit-identical vertices
+ * 2. Reorder triangles for post-transform cache locality (Forsyth)
+ * 3. Reorder cache-friendly clusters front-to-back-ish to cut overdraw,
+ *    kept only if ACMR stays within a threshold
+ * 4. Renumber vertices in first-use order for vertex fetch locality
+ *
+ * ACMR = transformed vertices per triangle, ATVR = transformed vertices per
+ * unique vertex, both simulated with a FIFO post-transform cache.
+ */
+class MeshOptimizer {
+public:
+    struct Options {
+        bool enabled = true;
+        bool weld = true;
+        bool vertexCache = true;
+        bool overdraw = true;
+        bool vertexFetch = true;
+        float overdrawThreshold = 1.05f;  // Max ACMR growth accepted for overdraw ordering
+        unsigned int fifoCacheSize = 16;  // Used for reporting only
+    };
+
+    struct Report {
+        size_t meshes = 0;
+        size_t triangles = 0;
+        size_t verticesBefore = 0;
+        size_t verticesAfter = 0;
+        size_t transformsBefore = 0;  // Simulated cache misses
+        size_t transformsAfter = 0;
+
+        float AcmrBefore() const;
+        float AcmrAfter() const;
+        float AtvrBefore() const;
+        float AtvrAfter() const;
+
+        Report& operator+=(const Report& other);
+        void Print(std::ostream& out) const;
+    };
+
+    // Options the importers use
+    static Options& Settings();
+
+    // Full pipeline; vertices and indices are rewritten in place
+    static Report Optimize(std::vector<Vertex>& vertices,
+                           std::vector<unsigned int>& indices,
+                           const Options& options = Settings());
+
+    // Individual passes
+    static size_t WeldVertices(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+    static void OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount);
+    static bool OptimizeOverdraw(std::vector<unsigned int>& indices,
+                                 const std::vector<Vertex>& vertices,
+                                 float threshold);
+    static size_t OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices);
+
+    // FIFO cache simulation: number of vertex shader invocations
+    static size_t SimulateTransforms(const std::vector<unsigned int>& indices,
+                                     size_t vertexCount,
+                                     unsigned int cacheSize);
+};
+
+} // namespace engine
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "Engine/Rendering/Geometry/Mesh/Meshlet.hpp"
+#include "Engine/Rendering/Geometry/Mesh/VertexFormat.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace engine {
+
+/**
+ * MeshletBuilder - Splits a mesh into small, spatially compact clusters
+ *
+ * Clusters grow greedily across shared vertices from the first unassigned
+ * triangle (so they follow the vertex-cache order from MeshOptimizer), then
+ * the index buffer is rewritten cluster by cluster so each one is a single
+ * draw range. Run MeshOptimizer::OptimizeVertexFetch afterwards to restore
+ * vertex locality for the new order.
+ */
+class MeshletBuilder {
+public:
+    static constexpr size_t MaxTriangles = 128;
+    static constexpr size_t MaxVertices = 96;
+
+    // Below this a mesh is cheaper drawn whole than culled per cluster
+    static constexpr size_t MinTriangles = 512;
+
+    static std::vector<Meshlet> Build(const std::vector<Vertex>& vertices,
+                                      std::vector<unsigned int>& indices,
+                                      size_t maxTriangles = MaxTriangles,
+                                      size_t maxVertices = MaxVertices);
+
+    // Bounding sphere and normal cone for indices[first, first + count)
+    static void ComputeBounds(const std::vector<Vertex>& vertices,
+                              const std::vector<unsigned int>& indices,
+                              Meshlet& meshlet);
+};
+
+} // namespace engine
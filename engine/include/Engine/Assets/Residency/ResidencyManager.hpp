@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace engine {
+
+enum class AssetCategory {
+    Mesh,
+    Texture,
+    Count
+};
+
+const char* AssetCategoryName(AssetCategory category);
+
+/**
+ * ResidentAsset - Base for assets whose GPU copy can be dropped and rebuilt
+ *
+ * - Registers itself with the ResidencyManager for its whole lifetime
+ *   (moves hand the registration over to the new object)
+ * - Derived classes call MarkUsed() whenever they are drawn or bound;
+ *   an evicted asset is restored there before the GL call goes out
+ * - EvictGpu() must leave the object valid; RestoreGpu() rebuilds it from
+ *   the CPU copy or from disk
+ */
+class ResidentAsset {
+public:
+    virtual ~ResidentAsset();
+
+    AssetCategory GetCategory() const { return m_Category; }
+    bool IsResident() const { return m_Resident; }
+    uint64_t GetLastUsedFrame() const { return m_LastUsedFrame; }
+
+    // Bytes held right now (GPU bytes are 0 while evicted)
+    virtual size_t GetGpuBytes() const = 0;
+    virtual size_t GetCpuBytes() const = 0;
+
+    // Delete Copy
+    ResidentAsset(const ResidentAsset&) = delete;
+    ResidentAsset& operator=(const ResidentAsset&) = delete;
+
+protected:
+    explicit ResidentAsset(AssetCategory category);
+    ResidentAsset(ResidentAsset&& other) noexcept;
+
+    // Stamp the current frame, restoring first if evicted; false if the restore failed
+    bool MarkUsed();
+    void SetResident(bool resident) { m_Resident = resident; }
+
+    // True if the GPU copy can be rebuilt after EvictGpu()
+    virtual bool CanEvictGpu() const = 0;
+    virtual void EvictGpu() = 0;
+    virtual bool RestoreGpu() = 0;
+
+    // Drop the CPU copy if it can be reloaded from disk; returns bytes freed
+    virtual size_t ReleaseCpu() { return 0; }
+
+private:
+    friend class ResidencyManager;
+
+    AssetCategory m_Category;
+    bool m_Resident = true;
+    uint64_t m_LastUsedFrame = 0;
+    size_t m_Slot = 0;  // Index in ResidencyManager::assets
+};
+
+/**
+ * ResidencyManager - Tracks CPU/GPU bytes per asset and enforces budgets
+ *
+ * - EndFrame() (called by the Renderer) evicts least-recently-drawn GPU
+ *   copies while the GPU total is over budget, then releases least-recently
+ *   used CPU copies while the CPU total is over budget
+ * - Assets drawn during the current frame are never evicted, so an
+ *   undersized budget degrades to "everything visible stays resident"
+ *   instead of thrashing
+ * - A budget of 0 means unlimited (the default)
+ */
+class ResidencyManager {
+public:
+    static ResidencyManager& Instance();
+
+    struct Budget {
+        size_t gpuBytes = 0;
+        size_t cpuBytes = 0;
+    };
+
+    struct CategoryUsage {
+        size_t assets = 0;
+        size_t resident = 0;
+        size_t gpuBytes = 0;
+        size_t cpuBytes = 0;
+        uint64_t evictions = 0;
+        uint64_t restores = 0;
+        uint64_t cpuReleases = 0;
+    };
+
+    void SetBudget(const Budget& budget) { m_Budget = budget; }
+    const Budget& GetBudget() const { return m_Budget; }
+
+    // Evict / release over budget, then advance the frame counter
+    void EndFrame();
+    uint64_t GetFrame() const { return m_Frame; }
+
+    CategoryUsage GetUsage(AssetCategory category) const;
+    size_t GetTotalGpuBytes() const;
+    size_t GetTotalCpuBytes() const;
+    void PrintReport(std::ostream& out) const;
+
+    // Delete Copy
+    ResidencyManager(const ResidencyManager&) = delete;
+    ResidencyManager& operator=(const ResidencyManager&) = delete;
+
+private:
+    ResidencyManager() = default;
+
+    friend class ResidentAsset;
+    void Register(ResidentAsset* asset);
+    void Unregister(ResidentAsset* asset);
+    void Restore(ResidentAsset* asset);
+
+    struct Counters {
+        uint64_t evictions = 0;
+        uint64_t restores = 0;
+        uint64_t cpuReleases = 0;
+    };
+
+    std::vector<ResidentAsset*> assets;
+    Counters m_Counters[static_cast<size_t>(AssetCategory::Count)];
+    Budget m_Budget;
+    uint64_t m_Frame = 1;  // 0 = never used
+};
+
+} // namespace engine
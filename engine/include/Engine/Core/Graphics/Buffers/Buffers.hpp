@@ -12,10 +12,12 @@ class VBO {
 
     public:
         VBO();
+        explicit VBO(GLuint existing) : ID(existing) {}  // Takes ownership (e.g. from UploadThread)
         ~VBO();
         void Bind();
         void Unbind();
         void SetData(const void*, GLsizeiptr, GLenum);
+        GLuint GetID() const { return ID; }
 
         // Delete Copy
     VBO(const VBO&) = delete;
@@ -50,6 +52,11 @@ class VAO {
         void Unbind();
         void AddAttribute(const Shader&, const std::string&, GLsizei, std::size_t offset);
 
+        // Explicit source format, e.g. normalized GL_UNSIGNED_SHORT or GL_HALF_FLOAT
+        // feeding a float shader input
+        void AddAttribute(const Shader&, const std::string&, GLint components, GLenum type,
+                          GLboolean normalized, GLsizei stride, std::size_t offset);
+
         // Delete Copy
     VAO(const VAO&) = delete;
     VAO& operator=(const VAO&) = delete;
@@ -76,10 +83,12 @@ class EBO {
 
     public:
         EBO();
+        explicit EBO(GLuint existing) : ID(existing) {}  // Takes ownership (e.g. from UploadThread)
         ~EBO();
         void Bind();
         void Unbind();
         void SetData(const void*, GLsizeiptr, GLenum);
+        GLuint GetID() const { return ID; }
 
         // Delete Copy
     EBO(const EBO&) = delete;
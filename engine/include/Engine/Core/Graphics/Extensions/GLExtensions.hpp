@@ -0,0 +1,58 @@
+#pragma once
+
+#include <glad/glad.h>
+
+// Enums from GL 4.1 / ARB_get_program_binary (the bundled glad only covers 3.3 core)
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+// KHR/ARB_parallel_shader_compile
+#ifndef GL_MAX_SHADER_COMPILER_THREADS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#endif
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+namespace engine {
+
+typedef void (APIENTRYP PFNENGINEGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei* length,
+                                                       GLenum* binaryFormat, void* binary);
+typedef void (APIENTRYP PFNENGINEPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat,
+                                                    const void* binary, GLsizei length);
+typedef void (APIENTRYP PFNENGINEPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+typedef void (APIENTRYP PFNENGINEMAXSHADERCOMPILERTHREADSPROC)(GLuint count);
+
+/**
+ * GLExtensions - Optional entry points beyond the 3.3 core profile
+ *
+ * Loaded once after gladLoadGLLoader(). Every feature has a flag; callers
+ * must check it before touching the matching function pointers, which stay
+ * null when the driver doesn't expose them.
+ */
+struct GLExtensions {
+    // ARB_get_program_binary (core in 4.1)
+    static bool programBinary;
+    static PFNENGINEGETPROGRAMBINARYPROC GetProgramBinary;
+    static PFNENGINEPROGRAMBINARYPROC ProgramBinary;
+    static PFNENGINEPROGRAMPARAMETERIPROC ProgramParameteri;
+
+    // KHR_parallel_shader_compile (or the ARB flavour): driver-side compiler
+    // threads plus a non-blocking GL_COMPLETION_STATUS_KHR query
+    static bool parallelShaderCompile;
+    static PFNENGINEMAXSHADERCOMPILERTHREADSPROC MaxShaderCompilerThreads;
+
+    static void Load(GLADloadproc loader);
+
+    // True if the context advertises the named extension
+    static bool HasExtension(const char* name);
+};
+
+} // namespace engine
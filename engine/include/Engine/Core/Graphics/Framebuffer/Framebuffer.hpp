@@ -0,0 +1,59 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <vector>
+
+namespace engine {
+
+/**
+ * Framebuffer - RAII wrapper around an offscreen FBO with texture attachments
+ *
+ * - Attachments are declared once, storage is (re)allocated by Resize()
+ * - Every color attachment is a 2D texture so later passes can sample it
+ * - All color attachments are enabled as draw buffers in declaration order
+ */
+class Framebuffer {
+private:
+    struct ColorAttachment {
+        GLuint texture;
+        GLenum internalFormat;
+        GLenum format;
+        GLenum type;
+    };
+
+    GLuint ID;
+    std::vector<ColorAttachment> colorAttachments;
+    bool hasDepth;
+    GLuint depthTexture;
+    int width;
+    int height;
+
+    void allocateStorage();
+    void releaseStorage();
+
+public:
+    Framebuffer();
+    ~Framebuffer();
+
+    void Bind();
+    void Unbind();
+
+    // Declare attachments (before the first Resize call)
+    int AddColorAttachment(GLenum internalFormat, GLenum format, GLenum type);
+    void EnableDepthAttachment();
+
+    // Reallocates attachment storage only when the size actually changes
+    void Resize(int w, int h);
+    bool IsComplete() const;
+
+    GLuint GetColorTexture(int index) const { return colorAttachments[index].texture; }
+    GLuint GetDepthTexture() const { return depthTexture; }
+    int GetWidth() const { return width; }
+    int GetHeight() const { return height; }
+
+    // Delete Copy
+    Framebuffer(const Framebuffer&) = delete;
+    Framebuffer& operator=(const Framebuffer&) = delete;
+};
+
+} // namespace engine
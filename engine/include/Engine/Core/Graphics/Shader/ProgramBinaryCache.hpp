@@ -0,0 +1,66 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+
+namespace engine {
+
+/**
+ * ProgramBinaryCache - Linked GL programs persisted to disk
+ *
+ * - Key = FNV-1a of the final (preprocessed) vertex/fragment sources plus
+ *   the GL vendor, renderer and version strings, so a driver update or a
+ *   source edit simply misses instead of loading a stale binary
+ * - One file per program: <directory>/<key>.bin
+ * - Any mismatch (bad header, driver rejects the blob) deletes the entry and
+ *   the caller falls back to compiling from source
+ * - Inactive when the driver doesn't support program binaries
+ */
+class ProgramBinaryCache {
+public:
+    struct Stats {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t rejected = 0;  // Found on disk but unusable
+        uint32_t stored = 0;
+    };
+
+    static ProgramBinaryCache& Instance();
+
+    void SetDirectory(const std::string& dir) { directory = dir; }
+    const std::string& GetDirectory() const { return directory; }
+
+    void SetEnabled(bool enabled) { m_Enabled = enabled; }
+    bool IsActive() const;
+
+    // Returns a linked program, or 0 if there is no usable entry
+    GLuint TryLoad(const std::string& vertexCode, const std::string& fragmentCode);
+
+    // Call before glLinkProgram so the driver keeps the binary around
+    void PrepareForLink(GLuint program) const;
+
+    // Save a successfully linked program
+    void Store(GLuint program, const std::string& vertexCode, const std::string& fragmentCode);
+
+    const Stats& GetStats() const { return stats; }
+    void ResetStats() { stats = Stats(); }
+
+    // Delete Copy
+    ProgramBinaryCache(const ProgramBinaryCache&) = delete;
+    ProgramBinaryCache& operator=(const ProgramBinaryCache&) = delete;
+
+private:
+    ProgramBinaryCache() = default;
+
+    std::string directory = "shader_cache";
+    bool m_Enabled = true;
+    uint64_t driverHash = 0;
+    bool driverHashValid = false;
+    Stats stats;
+
+    uint64_t computeKey(const std::string& vertexCode, const std::string& fragmentCode);
+    std::string entryPath(uint64_t key) const;
+};
+
+} // namespace engine
@@ -2,21 +2,40 @@
 
 #include <glad/glad.h>
 #include <string>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>
 
 namespace engine {
 
+/**
+ * Shader - Linked vertex + fragment program
+ *
+ * Building is two-phase: the constructor only submits compile and link
+ * work, and the first call that needs the result (use(), attribute or
+ * uniform lookups) checks the status and reflects attributes. Creating
+ * every scene shader up front therefore lets the driver overlap the
+ * compiles, on its own threads when KHR_parallel_shader_compile is present.
+ */
 class Shader {
 public:
     Shader(const char* vertexPath, const char* fragmentPath);
+
+    // Variant build: each define is injected as `#define NAME 1` into both stages
+    Shader(const char* vertexPath, const char* fragmentPath, const std::vector<std::string>& defines);
     ~Shader();
 
+    // Build a program from in-memory GLSL (engine-internal passes ship their own sources)
+    static std::unique_ptr<Shader> FromSource(const std::string& vertexSource,
+                                              const std::string& fragmentSource);
+
     void use() const;
 
     // Uniform setters (all const - they don't modify the Shader object)
     void setBool(const std::string &name, bool value) const;
     void setInt(const std::string &name, int value) const;
+    void setUInt(const std::string &name, unsigned int value) const;
     void setFloat(const std::string &name, float value) const;
     void setMat4(const std::string& name, const float* value) const;
     void setVec4(const std::string& name, const glm::vec4& v) const;
@@ -28,8 +47,17 @@ public:
     GLint getUniformLocation(const std::string& name) const;
     GLuint getID() const { return ID; }
 
+    // True once use() won't block on the driver. Without
+    // KHR_parallel_shader_compile that can't be polled, so it stays false
+    // until the first use resolves the build.
+    bool IsReady() const;
+
+    // Finish the build now instead of on first use, blocking on the driver
+    // if it is still compiling. Programs never drawn are cached this way too.
+    void Resolve() const { ensureBuilt(); }
+
     // Attribute reflection
-    void ReflectAttribs();
+    void ReflectAttribs() const;
 
     struct ReflectedAttribs {
         const std::string name;
@@ -52,26 +80,50 @@ public:
     Shader& operator=(const Shader&) = delete;
 
     // Move Constructor
-    Shader(Shader&& other) noexcept : ID(other.ID) {
+    Shader(Shader&& other) noexcept
+        : ID(other.ID),
+          m_Pending(std::move(other.m_Pending)),
+          m_Attributes(std::move(other.m_Attributes)) {
         other.ID = 0;
     }
 
     // Move Assignment
     Shader& operator=(Shader&& other) noexcept {
         if (this != &other) {
+            releasePending();
             if (ID) glDeleteProgram(ID);
             ID = other.ID;
+            m_Pending = std::move(other.m_Pending);
+            m_Attributes = std::move(other.m_Attributes);
             other.ID = 0;
         }
         return *this;
     }
 
 private:
+    Shader() : ID(0) {}
+
+    // Compile/link submitted but not yet checked
+    struct PendingBuild {
+        GLuint vertex = 0;
+        GLuint fragment = 0;
+        std::string vertexCode;    // Kept only for the program binary cache
+        std::string fragmentCode;
+    };
+
     unsigned int ID;
-    static std::string readFile(const char* path);
     static unsigned int compileShader(GLenum type, const std::string& source);
+    static void printCompileLog(GLuint shader, const char* stage);
+    void build(const std::string& vertexCode, const std::string& fragmentCode);
+
+    // Finish a pending build; const because every accessor may trigger it
+    void resolve() const;
+    void ensureBuilt() const { if (m_Pending) resolve(); }
+    void releasePending();
 
-    std::unordered_map<std::string, ReflectedAttribs> m_Attributes;
+    // Lazily resolved state (see resolve())
+    mutable std::unique_ptr<PendingBuild> m_Pending;
+    mutable std::unordered_map<std::string, ReflectedAttribs> m_Attributes;
 };
 
 } // namespace engine
\ No newline at end of file
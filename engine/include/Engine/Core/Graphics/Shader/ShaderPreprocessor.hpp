@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace engine {
+
+/**
+ * ShaderPreprocessor - Minimal GLSL front end run before compilation
+ *
+ * - #include "file" is resolved relative to the including file and pasted
+ *   in place; each file is included at most once per stage
+ * - Keyword defines are injected right after #version (GLSL requires
+ *   #version to come first), followed by a #line so compiler errors still
+ *   point at the original line numbers of the main file
+ *
+ * The output is what gets compiled and hashed for the program binary cache,
+ * so every variant gets its own cache entry.
+ */
+class ShaderPreprocessor {
+public:
+    // Returns false (and logs) if a file or one of its includes can't be read
+    static bool Process(const std::string& path,
+                        const std::vector<std::string>& defines,
+                        std::string& out);
+
+    // Same, for sources already in memory (includes resolve against includeDir)
+    static bool ProcessSource(const std::string& source,
+                              const std::string& includeDir,
+                              const std::vector<std::string>& defines,
+                              std::string& out);
+};
+
+} // namespace engine
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace engine {
+
+/**
+ * FrameTimeHistogram - Collects frame times (ms) and reports their spread
+ *
+ * Percentiles and the worst frame say more about hitches than an average:
+ * Print() shows fixed buckets around the 60/30 Hz budgets plus p50/p95/p99/max.
+ */
+class FrameTimeHistogram {
+public:
+    void Add(double frameMs) { samples.push_back(frameMs); }
+    void Clear() { samples.clear(); }
+
+    size_t GetCount() const { return samples.size(); }
+    double GetPercentile(double percent) const;  // 0..100; 0 when empty
+    double GetMax() const;
+
+    void Print(std::ostream& out) const;
+
+private:
+    std::vector<double> samples;
+};
+
+} // namespace engine
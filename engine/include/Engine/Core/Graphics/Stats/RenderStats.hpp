@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+
+namespace engine {
+
+/**
+ * RenderStats - Plain per-frame counters for the render thread
+ *
+ * The graphics wrappers (Shader, VAO, Texture, Sampler, buffers, PipelineState) bump
+ * RenderStats::Current() as they issue GL calls; the Renderer snapshots and
+ * resets it at the end of every frame. Everything is a plain integer add, so
+ * it is cheap enough to stay enabled in release builds.
+ */
+struct RenderStats {
+    // Submission
+    uint32_t drawCalls = 0;
+    uint32_t instances = 0;
+    uint64_t triangles = 0;
+
+    // State changes
+    uint32_t programBinds = 0;
+    uint32_t vaoBinds = 0;
+    uint32_t textureBinds = 0;
+    uint32_t samplerBinds = 0;
+    uint32_t uniformUploads = 0;
+    uint32_t pipelineStateChanges = 0;
+
+    // Transfers
+    uint64_t bytesUploaded = 0;
+    double uploadMs = 0.0;  // CPU time in UploadQueue steps
+
+    // Visibility
+    uint32_t visibleObjects = 0;
+    uint32_t culledObjects = 0;
+    uint32_t clustersTested = 0;
+    uint32_t clustersCulled = 0;
+
+    // CPU time spent inside Renderer::Render
+    double cpuSubmitMs = 0.0;
+
+    void Reset() { *this = RenderStats(); }
+
+    // Accumulate another frame (used for averaging the history)
+    RenderStats& operator+=(const RenderStats& other);
+
+    void Print(std::ostream& out) const;
+
+    // Counters for the frame currently being recorded
+    static RenderStats& Current();
+};
+
+} // namespace engine
@@ -5,21 +5,46 @@
 namespace engine {
 
 class Sampler {
+public:
+    // Everything a sampler object holds; SamplerCache keys on it
+    struct State {
+        GLenum minFilter = GL_LINEAR_MIPMAP_LINEAR;
+        GLenum magFilter = GL_LINEAR;
+        GLenum wrapS = GL_REPEAT;
+        GLenum wrapT = GL_REPEAT;
+        GLenum wrapR = GL_REPEAT;
+
+        bool operator==(const State& other) const {
+            return minFilter == other.minFilter && magFilter == other.magFilter && wrapS == other.wrapS &&
+                   wrapT == other.wrapT && wrapR == other.wrapR;
+        }
+        bool operator!=(const State& other) const { return !(*this == other); }
+    };
+
 private:
     GLuint ID;
+    State state;
     
 public:
     Sampler();
+    explicit Sampler(const State& initialState);
     ~Sampler();
     
+    // Skips the GL call if this sampler is already bound to `unit`
     void Bind(int unit);
     void Unbind(int unit);
     
-    void SetMinFilter(GLenum filter);
-    void SetMagFilter(GLenum filter);
-    void SetWrapS(GLenum wrap);
-    void SetWrapT(GLenum wrap);
-    void SetWrapR(GLenum wrap);
+    // Bind no sampler to `unit` (texture parameters apply again); for code
+    // that binds raw GL textures, so the tracking Bind() relies on stays right
+    static void ClearBinding(int unit);
+    
+    // Fixed at construction: samplers are shared (SamplerCache), so a
+    // different state means a different sampler
+    const State& GetState() const { return state; }
+    
+    // Delete Copy
+    Sampler(const Sampler&) = delete;
+    Sampler& operator=(const Sampler&) = delete;
 };
 
-}
\ No newline at end of file
+}
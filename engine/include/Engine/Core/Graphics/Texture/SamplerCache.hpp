@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Engine/Core/Graphics/Texture/Sampler.hpp"
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace engine {
+
+/**
+ * SamplerCache - One GL sampler object per distinct filter/wrap state
+ *
+ * Materials that sample the same way share a sampler, so sampler objects
+ * (and sampler binds, which the Sampler skips when nothing changes) scale
+ * with the number of sampling states in a scene rather than its entities,
+ * and their materials stay instancing-compatible (TexturedMaterial compares
+ * samplers by pointer).
+ *
+ * The cache only holds weak references: a sampler is deleted once no
+ * material uses it, and Get() creates a new one the next time. A sampler's
+ * state is fixed when it is created, so Get() the state you want rather
+ * than changing one. GL thread only.
+ */
+class SamplerCache {
+public:
+    static SamplerCache& Instance();
+
+    std::shared_ptr<Sampler> Get(const Sampler::State& state);
+
+    // Samplers still alive (one per state in use)
+    size_t GetLiveCount() const;
+
+    // Delete Copy
+    SamplerCache(const SamplerCache&) = delete;
+    SamplerCache& operator=(const SamplerCache&) = delete;
+
+private:
+    SamplerCache() = default;
+
+    struct Entry {
+        Sampler::State state;
+        std::weak_ptr<Sampler> sampler;
+    };
+
+    // A handful of states per scene: a linear scan beats hashing
+    std::vector<Entry> entries;
+};
+
+} // namespace engine
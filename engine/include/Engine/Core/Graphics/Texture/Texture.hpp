@@ -1,25 +1,91 @@
 #pragma once
 
 #include <glad/glad.h>
+#include <cstdint>
 #include <string>
+#include "Engine/Assets/Formats/ETexFormat.hpp"
+#include "Engine/Assets/Residency/ResidencyManager.hpp"
 
 namespace engine {
 
-class Texture {
+// File-backed textures can be evicted by the ResidencyManager; the next
+// Bind() reloads them from disk.
+// LoadFromFileAsync() returns at once with a 1x1 grey placeholder; the
+// TextureStreamer decodes on a worker and swaps the real image in once the
+// UploadQueue has written all of it. Cooked .etex files are mapped as-is;
+// anything else is decoded with stb_image once and the result kept as .etex
+// in the AssetCache for later loads of the same content.
+class Texture : public ResidentAsset {
+public:
+    enum class LoadState {
+        Empty,
+        Loading,  // Placeholder bound, decode/upload pending
+        Ready,
+        Failed
+    };
+
 private:
     GLuint ID;
     GLenum target;
+    LoadState state = LoadState::Empty;
+    uint64_t streamRequest = 0;  // TextureStreamer request while Loading
+
+    // Reload source and size of the last successful LoadFromFile
+    std::string path;
+    bool hasMipmaps = false;
+    int width = 0;
+    int height = 0;
+    int channels = 0;
     
 public:
     Texture(GLenum target = GL_TEXTURE_2D);
-    ~Texture();
+    ~Texture() override;
     
     void Bind(int unit);
     void Unbind();
     
-    void LoadFromFile(const std::string& path, bool generateMipmap = true);
+    bool LoadFromFile(const std::string& path, bool generateMipmap = true);
+    void LoadFromFileAsync(const std::string& path, bool generateMipmap = true);
     
     GLuint GetID() const { return ID; }
+    GLenum GetTarget() const { return target; }
+    LoadState GetLoadState() const { return state; }
+    bool IsReady() const { return state == LoadState::Ready; }
+
+    // Screen-space importance for a queued upload this frame (see UploadQueue)
+    void PrioritizeUpload(float importance) const;
+
+    // ResidentAsset
+    size_t GetGpuBytes() const override;
+    size_t GetCpuBytes() const override { return 0; }  // Pixels are freed after upload
+
+protected:
+    bool CanEvictGpu() const override { return !path.empty() && state != LoadState::Loading; }
+    void EvictGpu() override;
+    bool RestoreGpu() override;
+
+private:
+    friend class TextureStreamer;
+
+    // Pixels of an image file, bottom row first (thread-safe; used by TextureStreamer workers)
+    static bool readImage(const std::string& path, ETexFormat::Image& image);
+
+    // Upload decoded pixels (or a bound GL_PIXEL_UNPACK_BUFFER when pixels is an offset)
+    void uploadImage(const void* pixels, int imageWidth, int imageHeight, int imageChannels, bool generateMipmap);
+    void finishAsyncLoad(bool succeeded);
+
+    // Fill texture `id` with no bookkeeping (safe on the UploadThread's context)
+    static void uploadImageTo(GLenum target, GLuint id, const void* pixels,
+                              int imageWidth, int imageHeight, int imageChannels, bool generateMipmap);
+
+    // Chunked uploads: fill rows [firstRow, firstRow + rowCount) of level 0 of
+    // storage allocated with uploadImageTo(nullptr), then build the mip chain
+    static void uploadRowsTo(GLenum target, GLuint id, const void* pixels,
+                             int firstRow, int rowCount, int imageWidth, int imageChannels);
+    static void finishImageTo(GLenum target, GLuint id, bool generateMipmap);
+
+    // Replace our texture object with one filled elsewhere (UploadThread, UploadQueue)
+    void adoptImage(GLuint id, int imageWidth, int imageHeight, int imageChannels);
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace engine {
+
+class Texture;
+
+/**
+ * TextureStreamer - Decodes image files on worker threads and uploads them
+ * on the GL thread through a pixel-unpack buffer
+ *
+ * - Request() queues a decode (or, for cooked .etex files, a mapping) on
+ *   the JobSystem and returns immediately
+ * - Update() runs once per frame on the GL thread (Renderer::Render) and
+ *   hands finished decodes to the UploadQueue, which writes them into a new
+ *   texture object in bands of rows under its per-frame budget; the
+ *   placeholder stays bound until the last band (and the mip chain) is done
+ * - Cancel() is safe while the decode is still running; the result is
+ *   simply dropped when it arrives
+ * - With the UploadThread running, decoded images are uploaded into new
+ *   texture objects there and swapped in once their fence signals
+ */
+class TextureStreamer {
+public:
+    static TextureStreamer& Instance();
+
+    ~TextureStreamer();
+
+    uint64_t Request(Texture* texture, const std::string& path);
+    void Cancel(uint64_t request);
+
+    // GL thread: queue uploads for what finished decoding
+    void Update();
+
+    // GL thread: block until every pending request is uploaded (tools, loading screens)
+    void Flush();
+
+    size_t GetPendingCount() const { return requests.size(); }
+
+    // GL thread: delete the staging buffer (before the context goes away)
+    void ReleaseGLResources();
+
+    // Delete Copy
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+private:
+    TextureStreamer();
+
+    struct DecodedImage {
+        uint64_t request = 0;
+        std::shared_ptr<const unsigned char> pixels;  // Decoded or mapped (.etex)
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        std::string path;
+    };
+
+    // Shared with in-flight decode jobs, so they can finish after we're gone
+    struct Completed {
+        std::mutex mutex;
+        std::deque<DecodedImage> images;
+    };
+
+    // A decoded image being written into `id` by the UploadQueue
+    struct ChunkedUpload {
+        DecodedImage image;
+        GLuint id = 0;
+        int nextRow = 0;
+    };
+
+    std::shared_ptr<Completed> completed;
+    std::unordered_map<uint64_t, Texture*> requests;  // Live (not cancelled) requests
+    uint64_t nextRequest = 1;
+    GLuint pbo = 0;
+
+    size_t dispatchDecoded();
+    void enqueueUpload(Texture* texture, DecodedImage&& image);
+    size_t uploadRows(ChunkedUpload& upload, bool& done);
+    void submitToUploadThread(Texture* texture, DecodedImage&& image);
+};
+
+} // namespace engine
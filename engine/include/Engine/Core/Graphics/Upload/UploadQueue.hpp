@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+namespace engine {
+
+/**
+ * UploadQueue - Time-sliced GPU uploads on the render thread
+ *
+ * - Loads enqueue each upload as a series of steps (allocate, then chunks of
+ *   about ChunkBytes); Process() runs once per frame and executes steps until
+ *   the frame's byte or millisecond budget is spent, so a scene or cell load
+ *   is spread over several frames instead of landing in one
+ * - Work is keyed by an owner pointer. The renderer reports the screen-space
+ *   size of every visible owner with SetImportance() before Process(), which
+ *   serves the largest first; unreported (off-screen) work follows in FIFO order
+ * - A step must cope with its owner being destroyed in between (check a
+ *   shared flag and finish immediately); queued steps are never dropped
+ * - Unused while the UploadThread is running: transfers happen over there
+ */
+class UploadQueue {
+public:
+    static UploadQueue& Instance();
+
+    // Granularity steps should aim for: small enough to stop close to the budget
+    static constexpr size_t ChunkBytes = 256 * 1024;
+
+    // Per-frame caps; 0 = unlimited. At least one step runs every frame.
+    struct Budget {
+        size_t maxBytes = 4 * 1024 * 1024;
+        double maxMilliseconds = 2.0;
+    };
+    void SetBudget(const Budget& budget) { m_Budget = budget; }
+    const Budget& GetBudget() const { return m_Budget; }
+
+    // Upload the next chunk, return its size in bytes and set `done` after the last one
+    using Step = std::function<size_t(bool& done)>;
+    void Enqueue(const void* owner, Step step);
+
+    // Render thread, before Process(): importance of an owner this frame (largest wins)
+    void SetImportance(const void* owner, float importance);
+
+    // Render thread: run steps within the budget
+    void Process();
+
+    // Render thread: run everything queued (tools, loading screens)
+    void Flush();
+
+    size_t GetPendingCount() const { return items.size() + incoming.size(); }
+
+    // What the last Process() call spent
+    size_t GetLastFrameBytes() const { return lastFrameBytes; }
+    double GetLastFrameMilliseconds() const { return lastFrameMs; }
+
+    // Delete Copy
+    UploadQueue(const UploadQueue&) = delete;
+    UploadQueue& operator=(const UploadQueue&) = delete;
+
+private:
+    UploadQueue() = default;
+
+    struct Item {
+        const void* owner = nullptr;
+        Step step;
+        float importance = 0.0f;
+        bool done = false;
+    };
+
+    Budget m_Budget;
+    std::vector<Item> items;
+    std::vector<Item> incoming;  // Enqueued while steps run; merged next time
+    std::unordered_map<const void*, float> importance;  // Cleared every Process()
+    size_t lastFrameBytes = 0;
+    double lastFrameMs = 0.0;
+
+    void run(size_t maxBytes, double maxMilliseconds);
+};
+
+} // namespace engine
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+struct GLFWwindow;
+
+namespace engine {
+
+/**
+ * UploadThread - Optional second GL context that fills buffers and textures
+ *
+ * - Start() (main thread, after the renderer's window exists) creates a
+ *   hidden 1x1 window whose context shares objects with the main one and
+ *   makes it current on a dedicated thread
+ * - Submit(work, publish): `work` runs on the upload thread and should
+ *   create its own GL names (buffers, textures) and fill them; a fence is
+ *   inserted behind it. Poll() runs on the render thread every frame and
+ *   calls `publish` once that fence has signalled, so the renderer only
+ *   ever sees finished objects and never blocks on the transfer
+ * - VAOs and FBOs are not shared between contexts: anything that needs
+ *   them must be wired up in `publish`
+ * - Works with any driver that can create a hidden shared context
+ *   (including Mesa llvmpipe under a virtual X server)
+ */
+class UploadThread {
+public:
+    static UploadThread& Instance();
+
+    ~UploadThread();
+
+    // Main thread. False (and stays stopped) if the shared context can't be created.
+    bool Start(GLFWwindow* mainWindow);
+
+    // Main thread: finish queued work, publish it, destroy the context
+    void Stop();
+
+    bool IsRunning() const { return running; }
+
+    void Submit(std::function<void()> work, std::function<void()> publish);
+
+    // Render thread: publish every upload whose fence has signalled (never blocks)
+    void Poll();
+
+    // Render thread: block until everything submitted so far is published
+    void Flush();
+
+    // Delete Copy
+    UploadThread(const UploadThread&) = delete;
+    UploadThread& operator=(const UploadThread&) = delete;
+
+private:
+    UploadThread() = default;
+
+    struct Task {
+        std::function<void()> work;
+        std::function<void()> publish;
+        GLsync fence = nullptr;
+    };
+
+    GLFWwindow* uploadWindow = nullptr;
+    std::thread thread;
+    bool running = false;
+    bool stopping = false;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::deque<Task> queued;     // Waiting for the upload thread
+    std::deque<Task> submitted;  // Fenced, waiting to be published
+    size_t inFlight = 0;         // Taken off `queued` but not yet fenced
+
+    void threadLoop();
+    size_t publishReady(bool wait);
+};
+
+} // namespace engine
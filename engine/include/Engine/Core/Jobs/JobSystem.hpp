@@ -0,0 +1,103 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine {
+
+/**
+ * JobHandle - Completion counter shared by one or more jobs
+ */
+class JobHandle {
+public:
+    bool IsDone() const { return !m_Pending || m_Pending->load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+    std::shared_ptr<std::atomic<int>> m_Pending;
+};
+
+/**
+ * JobSystem - Fixed pool of worker threads fed from a FIFO job queue plus a
+ * worker-only background queue
+ *
+ * - Started lazily on first use with hardware_concurrency - 1 workers
+ *   (the calling thread works too while it waits)
+ * - Wait() never blocks idle: the waiting thread runs queued jobs until its
+ *   handle completes, so nested ParallelFor calls can't deadlock
+ * - Jobs must not touch GL; only the main thread owns the context
+ * - Shutdown() drains the queue and joins the workers; a later Init() or
+ *   Submit() starts a fresh pool (e.g. to measure scaling per worker count)
+ * - Background jobs (long, latency-tolerant work such as streaming a world
+ *   cell) wait in a second queue that only workers take from, and only when
+ *   the main queue is empty: a frame's Wait() or ParallelFor() never ends up
+ *   running one on the calling thread
+ * - Submit() and ParallelFor() called from inside a background job queue
+ *   background work as well, so e.g. a streamed cell's parallel import stays
+ *   off the render thread
+ */
+class JobSystem {
+public:
+    static JobSystem& Instance();
+
+    ~JobSystem();
+
+    // Optional explicit start (0 = hardware_concurrency - 1). No-op while running.
+    void Init(unsigned int workerCount = 0);
+    void Shutdown();
+
+    unsigned int GetWorkerCount() const { return static_cast<unsigned int>(workers.size()); }
+
+    // Queue a job; the handle completes when it has run. From inside a
+    // background job it is queued as background too.
+    JobHandle Submit(std::function<void()> job);
+    // Queue a job for the workers only, behind all regular jobs
+    JobHandle SubmitBackground(std::function<void()> job);
+
+    // Block (while helping) until the job(s) behind the handle finish
+    void Wait(const JobHandle& handle);
+
+    /**
+     * Run fn(begin, end) over [0, count) split into batches of at most
+     * `grain` items, on the workers and the calling thread. Returns when
+     * every batch has finished.
+     */
+    void ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn);
+
+    // Delete Copy
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+private:
+    JobSystem() = default;
+
+    struct Job {
+        std::function<void()> fn;
+        std::shared_ptr<std::atomic<int>> counter;
+    };
+
+    std::vector<std::thread> workers;
+    std::deque<Job> queue;
+    std::deque<Job> backgroundQueue;  // Workers only
+    std::mutex queueMutex;
+    std::condition_variable queueCondition;
+    bool stopping = false;
+    std::mutex startMutex;  // Serializes Init/Shutdown
+    std::atomic<bool> running{false};
+
+    void ensureStarted();
+    void workerLoop(unsigned int index);
+    bool runOne();  // Execute one queued job if any; false if the queue was empty
+    void run(Job& job, bool background);
+    void enqueue(std::function<void()> fn, const std::shared_ptr<std::atomic<int>>& counter,
+                 bool background = false);
+};
+
+} // namespace engine
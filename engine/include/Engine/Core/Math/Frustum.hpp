@@ -0,0 +1,24 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace engine {
+
+/**
+ * Frustum - Six planes extracted from a view-projection matrix
+ *
+ * Planes point inwards and are normalized, so plane distance is in world
+ * units (Gribb/Hartmann extraction, OpenGL clip space).
+ */
+class Frustum {
+public:
+    Frustum() = default;
+    explicit Frustum(const glm::mat4& viewProjection);
+
+    bool IntersectsSphere(const glm::vec3& center, float radius) const;
+
+private:
+    glm::vec4 planes[6];
+};
+
+} // namespace engine
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Engine/Core/Profiling/Profiler.hpp"
+
+#if ENGINE_ENABLE_PROFILING
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+
+namespace engine {
+
+/**
+ * GpuProfiler - GL_TIME_ELAPSED query pools, one pool per in-flight frame
+ *
+ * - Results are read back FrameLatency frames later, and only if the driver
+ *   reports them available, so the CPU never stalls waiting on the GPU
+ * - Timings are forwarded to Profiler on the "GPU" track, positioned at the
+ *   CPU time the pass was submitted
+ * - Time-elapsed queries cannot nest: passes must be sequential
+ */
+class GpuProfiler {
+public:
+    static constexpr int FrameLatency = 4;
+
+    GpuProfiler();
+    ~GpuProfiler();
+
+    // Harvest the oldest frame's queries and recycle them for this frame
+    void BeginFrame();
+
+    void BeginPass(const char* name);
+    void EndPass();
+
+    // Delete Copy
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+
+private:
+    struct PendingQuery {
+        const char* name;
+        GLuint query;
+        uint64_t cpuStartNs;
+    };
+
+    struct FrameSlot {
+        std::vector<GLuint> freeQueries;
+        std::vector<PendingQuery> pending;
+    };
+
+    FrameSlot frames[FrameLatency];
+    int frameIndex = 0;
+    bool passActive = false;
+    int ignoredDepth = 0;  // Nested passes are skipped, not timed
+
+    GLuint acquireQuery(FrameSlot& slot);
+};
+
+/**
+ * GpuPassScope - RAII wrapper around BeginPass/EndPass
+ */
+class GpuPassScope {
+public:
+    GpuPassScope(GpuProfiler& profiler, const char* name) : m_Profiler(profiler) {
+        m_Profiler.BeginPass(name);
+    }
+    ~GpuPassScope() { m_Profiler.EndPass(); }
+
+    GpuPassScope(const GpuPassScope&) = delete;
+    GpuPassScope& operator=(const GpuPassScope&) = delete;
+
+private:
+    GpuProfiler& m_Profiler;
+};
+
+} // namespace engine
+
+#define ENGINE_PROFILE_GPU_PASS(profiler, name) \
+    ::engine::GpuPassScope ENGINE_PROFILE_CONCAT(engineGpuPass_, __LINE__)(profiler, name)
+
+#else
+
+#define ENGINE_PROFILE_GPU_PASS(profiler, name) ((void)0)
+
+#endif
@@ -0,0 +1,91 @@
+#pragma once
+
+/**
+ * Profiler - Scoped CPU instrumentation exported as Chrome trace-event JSON
+ *
+ * - Every thread records into its own fixed-size event ring (single writer,
+ *   no locks on the hot path; the registry mutex is only taken once per thread)
+ * - WriteChromeTrace() produces a file loadable in Perfetto / chrome://tracing
+ * - Compiled out entirely unless ENGINE_ENABLE_PROFILING is defined to 1
+ *   (CMake option ENGINE_ENABLE_PROFILING); the macros then expand to nothing
+ *
+ * Event names must outlive the profiler (string literals / __func__).
+ */
+
+#ifndef ENGINE_ENABLE_PROFILING
+#define ENGINE_ENABLE_PROFILING 0
+#endif
+
+#if ENGINE_ENABLE_PROFILING
+
+#include <cstdint>
+#include <string>
+
+namespace engine {
+
+class Profiler {
+public:
+    // Thread id used for GPU events so they get their own track
+    static constexpr uint32_t GpuThreadId = 0xFFFF;
+
+    // Nanoseconds since the profiler epoch (first call)
+    static uint64_t NowNs();
+
+    // Append a completed event to the calling thread's buffer
+    static void RecordEvent(const char* name, const char* category,
+                            uint64_t startNs, uint64_t durationNs);
+
+    // Same, but attributed to an explicit track (used for GPU timings)
+    static void RecordEvent(const char* name, const char* category,
+                            uint64_t startNs, uint64_t durationNs, uint32_t threadId);
+
+    // Label the calling thread in the exported trace
+    static void SetThreadName(const char* name);
+
+    // Dump all buffered events; call while worker threads are idle
+    static bool WriteChromeTrace(const std::string& path);
+
+    // Drop all buffered events (keeps thread registrations)
+    static void Clear();
+};
+
+/**
+ * ProfileScope - RAII timer that records one "complete" event on destruction
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(const char* name, const char* category = "cpu")
+        : m_Name(name), m_Category(category), m_Start(Profiler::NowNs()) {}
+
+    ~ProfileScope() {
+        Profiler::RecordEvent(m_Name, m_Category, m_Start, Profiler::NowNs() - m_Start);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    const char* m_Name;
+    const char* m_Category;
+    uint64_t m_Start;
+};
+
+} // namespace engine
+
+#define ENGINE_PROFILE_CONCAT_INNER(a, b) a##b
+#define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_INNER(a, b)
+
+#define ENGINE_PROFILE_SCOPE(name) \
+    ::engine::ProfileScope ENGINE_PROFILE_CONCAT(engineProfileScope_, __LINE__)(name)
+#define ENGINE_PROFILE_FUNCTION() ENGINE_PROFILE_SCOPE(__func__)
+#define ENGINE_PROFILE_THREAD_NAME(name) ::engine::Profiler::SetThreadName(name)
+#define ENGINE_PROFILE_WRITE_TRACE(path) ::engine::Profiler::WriteChromeTrace(path)
+
+#else
+
+#define ENGINE_PROFILE_SCOPE(name) ((void)0)
+#define ENGINE_PROFILE_FUNCTION() ((void)0)
+#define ENGINE_PROFILE_THREAD_NAME(name) ((void)0)
+#define ENGINE_PROFILE_WRITE_TRACE(path) ((void)0)
+
+#endif
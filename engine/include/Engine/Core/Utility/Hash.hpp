@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace engine {
+
+// 64-bit FNV-1a. Not cryptographic - used for cache keys and change detection.
+constexpr uint64_t Fnv1aOffset = 14695981039346656037ull;
+constexpr uint64_t Fnv1aPrime  = 1099511628211ull;
+
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t seed = Fnv1aOffset) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= Fnv1aPrime;
+    }
+    return hash;
+}
+
+inline uint64_t HashString(const std::string& s, uint64_t seed = Fnv1aOffset) {
+    // Include the length so ("ab","c") and ("a","bc") chain to different keys
+    const uint64_t size = s.size();
+    return HashBytes(s.data(), s.size(), HashBytes(&size, sizeof(size), seed));
+}
+
+inline std::string HashToHex(uint64_t hash) {
+    static const char digits[] = "0123456789abcdef";
+    std::string out(16, '0');
+    for (int i = 15; i >= 0; --i) {
+        out[i] = digits[hash & 0xF];
+        hash >>= 4;
+    }
+    return out;
+}
+
+} // namespace engine
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace engine {
+
+/**
+ * MappedFile - Read-only memory mapping of a whole file (RAII)
+ *
+ * The OS pages the contents in on demand and shares them with the page
+ * cache, so reading a large asset costs no copy and no heap allocation.
+ * An empty file maps successfully with Size() == 0 and Data() == nullptr.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // False (and stays closed) if the file can't be opened or mapped
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return open; }
+    const uint8_t* Data() const { return data; }
+    size_t Size() const { return size; }
+    const std::string& GetPath() const { return path; }
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Delete Copy
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+private:
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    bool open = false;
+    std::string path;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+} // namespace engine
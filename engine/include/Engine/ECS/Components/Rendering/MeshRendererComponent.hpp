@@ -11,7 +11,8 @@ namespace engine {
 class MeshRendererComponent : public Component {
 public:
     Mesh* mesh;  // Non-owning - points to mesh in Model owned by MeshLoader
-    std::unique_ptr<Material> material;  // Owning - this component owns the material
+    std::shared_ptr<Material> material;  // Shared by every renderer using the same material asset
+    MaterialOverrides overrides;         // Per-renderer tweaks applied on top of it
     
     MeshRendererComponent();
 };
@@ -1,6 +1,8 @@
 // engine/include/Engine/ECS/Core/World/World.hpp
 #pragma once
 
+#include <map>
+#include <memory>
 #include <vector>
 #include <string>
 #include "Engine/ECS/Core/Entity/Entity.hpp"
@@ -15,12 +17,25 @@ public:
     ~World();
     
     Entity* CreateEntity(const std::string& name = "Entity");
+    // `count` default entities in one allocation, appended to `entities`;
+    // returns the first (bulk scene loads fill them in place)
+    Entity* CreateEntities(size_t count);
     Entity* FindByName(const std::string& name);
+    // Destroys `entity` and everything below it and detaches it from its
+    // parent; storage is freed once every entity of its block is gone
+    void DestroyEntity(Entity* entity);
     
     template<typename T>
     std::vector<T*> GetComponentsOfType();
     
     void Clear();
+
+private:
+    struct EntityBlock {
+        std::unique_ptr<Entity[]> entities;
+        size_t alive = 0;
+    };
+    std::map<const Entity*, EntityBlock> entityBlocks;  // By first entity; owns every entity
 };
 
 template<typename T>
@@ -16,7 +16,11 @@
 #include "Engine/ECS/Components/Rendering/MeshRendererComponent.hpp"
 
 // ---- Geometry ----
+#include "Engine/Rendering/Geometry/Mesh/VertexFormat.hpp"
+#include "Engine/Rendering/Geometry/Mesh/Meshlet.hpp"
+#include "Engine/Rendering/Geometry/Mesh/MeshData.hpp"
 #include "Engine/Rendering/Geometry/Mesh/Mesh.hpp"
+#include "Engine/Rendering/Geometry/Model/ModelHierarchy.hpp"
 #include "Engine/Rendering/Geometry/Model/Model.hpp"
 
 // ---- Materials ----
@@ -26,18 +30,51 @@
 
 // ---- Graphics objects ----
 #include "Engine/Core/Graphics/Shader/Shader.hpp"
+#include "Engine/Core/Graphics/Shader/ProgramBinaryCache.hpp"
+#include "Engine/Core/Graphics/Shader/ShaderPreprocessor.hpp"
+#include "Engine/Core/Graphics/Extensions/GLExtensions.hpp"
 #include "Engine/Core/Graphics/Buffers/Buffers.hpp"
 #include "Engine/Core/Graphics/Texture/Texture.hpp"
 #include "Engine/Core/Graphics/Texture/Sampler.hpp"
+#include "Engine/Core/Graphics/Texture/SamplerCache.hpp"
+#include "Engine/Core/Graphics/Texture/TextureStreamer.hpp"
+#include "Engine/Core/Graphics/Upload/UploadQueue.hpp"
+#include "Engine/Core/Graphics/Upload/UploadThread.hpp"
 #include "Engine/Core/Graphics/State/PipelineState.hpp"
+#include "Engine/Core/Graphics/Framebuffer/Framebuffer.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
+#include "Engine/Core/Graphics/Stats/FrameTimeHistogram.hpp"
+
+// ---- Post processing ----
+#include "Engine/Rendering/PostProcess/PostProcessParams.hpp"
+#include "Engine/Rendering/PostProcess/PostProcessPass.hpp"
 
 // ---- Asset loaders ----
 #include "Engine/Assets/Loaders/Shader/ShaderLoader.hpp"
 #include "Engine/Assets/Loaders/Texture/TextureLoader.hpp"
 #include "Engine/Assets/Loaders/Mesh/MeshLoader.hpp"
+#include "Engine/Assets/Formats/EMeshFormat.hpp"
+#include "Engine/Assets/Formats/ETexFormat.hpp"
+#include "Engine/Assets/Formats/ESceneFormat.hpp"
+#include "Engine/Assets/Processing/MeshOptimizer.hpp"
+#include "Engine/Assets/Processing/MeshletBuilder.hpp"
+#include "Engine/Assets/Cache/AssetCache.hpp"
+#include "Engine/Assets/Residency/ResidencyManager.hpp"
 
 // ---- Scene system ----
 #include "Engine/Scene/SceneLoader.hpp"
+#include "Engine/Scene/ModelInstantiator.hpp"
+#include "Engine/Scene/SceneReader.hpp"
+#include "Engine/Scene/WorldPartition.hpp"
+
+// ---- Math / jobs / utility ----
+#include "Engine/Core/Math/Frustum.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Core/Utility/MappedFile.hpp"
+
+// ---- Profiling ----
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include "Engine/Core/Profiling/GpuProfiler.hpp"
 
 // ---- Input system ----
 #include "Engine/Core/Input/InputManager.hpp"
\ No newline at end of file
@@ -2,7 +2,15 @@
 
 #include "Engine/Core/Graphics/Shader/Shader.hpp"
 #include "Engine/Core/Graphics/Buffers/Buffers.hpp"
+#include "Engine/Rendering/PostProcess/PostProcessPass.hpp"
+#include "Engine/Core/Profiling/GpuProfiler.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
+#include "Engine/Core/Math/Frustum.hpp"
+#include <array>
+#include <iosfwd>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include <glm/glm.hpp>
 
 struct GLFWwindow;
@@ -12,6 +20,7 @@ namespace engine {
 class World;
 class CameraComponent;
 class MeshRendererComponent;
+class Mesh;
 
 class Renderer {
 public:
@@ -24,14 +33,82 @@ public:
     void Resize(int w, int h);
     GLFWwindow* GetWindow() const { return m_Window; }
     
+    // Full-screen quantize/dither/fog pass (on by default)
+    void SetPostProcessEnabled(bool enabled) { m_PostProcessEnabled = enabled; }
+    bool IsPostProcessEnabled() const { return m_PostProcessEnabled; }
+
+    // Upload buffers/textures from a second, shared GL context (off by default).
+    // Must be set before Init().
+    void SetUploadThreadEnabled(bool enabled) { m_UploadThreadEnabled = enabled; }
+    bool IsUploadThreadEnabled() const { return m_UploadThreadEnabled; }
+
+    // Per-meshlet frustum and normal-cone culling on the job system (on by default)
+    void SetClusterCullingEnabled(bool enabled) { m_ClusterCullingEnabled = enabled; }
+    bool IsClusterCullingEnabled() const { return m_ClusterCullingEnabled; }
+
+    // Draw opaque objects sharing a mesh and an equivalent material (see
+    // Material::CanInstanceWith) with one instanced call (on by default).
+    // Needs shaders with the aInstanceModel input (include/instancing.glsl).
+    void SetInstancingEnabled(bool enabled) { m_InstancingEnabled = enabled; }
+    bool IsInstancingEnabled() const { return m_InstancingEnabled; }
+    
+    // Per-frame statistics (last completed frame + rolling history)
+    static constexpr size_t StatsHistorySize = 120;
+    const RenderStats& GetFrameStats() const { return m_LastFrameStats; }
+    std::vector<RenderStats> GetStatsHistory() const;  // Oldest first
+    RenderStats GetAverageStats() const;
+    void PrintStats(std::ostream& out) const;
+    
 private:
     std::unique_ptr<VAO> vao;
     std::unique_ptr<VBO> vbo;
+    std::unique_ptr<VBO> instanceVbo;  // This frame's per-instance model matrices
+    std::unique_ptr<PostProcessPass> postPass;
+    bool m_PostProcessEnabled = true;
+    bool m_ClusterCullingEnabled = true;
+    bool m_InstancingEnabled = true;
+    bool m_UploadThreadEnabled = false;
+#if ENGINE_ENABLE_PROFILING
+    std::unique_ptr<GpuProfiler> gpuProfiler;
+#endif
     int width;
     int height;
     bool initialized;
     GLFWwindow* m_Window = nullptr;
     
+    RenderStats m_LastFrameStats;
+    std::array<RenderStats, StatsHistorySize> m_StatsHistory;
+    size_t m_StatsHistoryHead = 0;   // Next slot to write
+    size_t m_StatsHistoryCount = 0;
+    void EndFrameStats(double cpuSubmitMs);
+
+    // One entity that survived object culling this frame
+    struct DrawItem {
+        static constexpr size_t NoClusters = static_cast<size_t>(-1);
+
+        MeshRendererComponent* meshRenderer = nullptr;
+        glm::mat4 model = glm::mat4(1.0f);
+        float maxScale = 1.0f;
+        bool coneCulling = false;
+        size_t firstCluster = NoClusters;  // Offset into m_ClusterVisibility
+    };
+    std::vector<DrawItem> m_DrawItems;          // Reused every frame
+    std::vector<uint8_t> m_ClusterVisibility;   // One flag per meshlet of every DrawItem
+    void cullClusters(const Frustum& frustum, const glm::vec3& eye, size_t clusterCount);
+
+    // DrawItems drawn together: one item, or an instanced group whose
+    // matrices sit at firstInstance in m_InstanceMatrices
+    struct DrawBatch {
+        size_t item = 0;  // The first item; its material is bound for all
+        uint32_t instanceCount = 1;
+        size_t firstInstance = 0;
+    };
+    std::vector<DrawBatch> m_DrawBatches;
+    std::vector<size_t> m_ItemBatch;  // DrawItem -> m_DrawBatches slot
+    std::vector<glm::mat4> m_InstanceMatrices;
+    std::unordered_map<const Mesh*, std::vector<size_t>> m_BatchesByMesh;
+    void buildDrawBatches();
+    
     void RenderEntity(MeshRendererComponent* renderer, const glm::mat4& view, const glm::mat4& proj);
 };
 
@@ -2,39 +2,65 @@
 
 #include <glad/glad.h>
 #include <glm/glm.hpp>
+#include <functional>
+#include <memory>
 #include <vector>
 #include <unordered_set>
 #include "Engine/Core/Graphics/Shader/Shader.hpp"
 #include "Engine/Core/Graphics/Buffers/Buffers.hpp"
+#include "Engine/Rendering/Geometry/Mesh/MeshData.hpp"
+#include "Engine/Assets/Residency/ResidencyManager.hpp"
 
 namespace engine {
 
-struct Vertex {
-    glm::vec3 Position;
-    glm::vec3 Normal;
-    glm::vec2 TexCoords;
-};
-
 /**
  * Mesh class - Manages vertex data and rendering using RAII principles
  * 
  * - Uses VAO/VBO/EBO abstractions for automatic OpenGL resource management
  * - Lazily configures vertex attributes per shader (once per unique shader)
  * - Complies with OpenGL 3.3 Core Profile requirements
+ * - Vertices are packed into a VertexFormat (compact by default); shaders
+ *   rebuild positions with the uPosScale / uPosOffset uniforms set in Draw()
+ * - Indices are stored as 16-bit whenever the vertex count allows. Larger
+ *   meshes with good vertex locality are split into a few 16-bit ranges
+ *   drawn with a base vertex; otherwise they stay 32-bit
+ * - Large meshes may carry meshlets (contiguous index ranges with bounds)
+ *   so the renderer can cull and draw them per cluster
+ * - The packing itself is MeshData's job, so it can run off the GL thread
+ *   or come pre-baked from an .emesh file
+ * - GPU buffers can be evicted by the ResidencyManager and are rebuilt on
+ *   the next draw, from the packed CPU copy or through the reload source
+ * - DrawInstanced() repeats the mesh with per-instance model matrices
+ *   read from a caller-owned buffer (shader input aInstanceModel)
+ * - Buffers are filled in chunks by the UploadQueue (or, with the
+ *   UploadThread running, on its context) and adopted by the first Draw()
+ *   after the last chunk lands; nothing is drawn before
  */
-class Mesh {
+class Mesh : public ResidentAsset {
 public:
+    // Refills the packed vertex/index bytes (same layout as the original upload)
+    using ReloadSource = std::function<bool(std::vector<uint8_t>& vertexData, std::vector<uint8_t>& indexData)>;
+
     /**
-     * Constructor - Uploads vertex and index data to GPU
+     * Constructor - Packs the data and queues it for upload to the GPU
      * @param verts Vertex data (position, normal, texcoords)
      * @param inds Index data for indexed drawing
+     * @param format GPU layout; drop hasNormals/hasTexCoords for data the source lacks
+     * @param meshlets Optional clusters covering inds (see MeshletBuilder)
      */
-    Mesh(std::vector<Vertex> verts, std::vector<unsigned int> inds);
+    Mesh(const std::vector<Vertex>& verts, const std::vector<unsigned int>& inds,
+         const VertexFormat& format = VertexFormat(), std::vector<Meshlet> meshlets = {});
+
+    /**
+     * Constructor - Queues already packed data for upload (e.g. from an .emesh file);
+     * the bytes are uploaded straight from data.storage
+     */
+    explicit Mesh(MeshData data);
     
     /**
      * Destructor - RAII handles cleanup automatically through member destructors
      */
-    ~Mesh();
+    ~Mesh() override;
     
     /**
      * Draw the mesh using the specified shader
@@ -44,6 +70,55 @@ public:
      */
     void Draw(const Shader& shader);
 
+    /**
+     * Draw only the meshlets whose flag is non-zero (one byte per meshlet)
+     * - Adjacent visible meshlets are merged into one draw call
+     */
+    void DrawMeshlets(const Shader& shader, const uint8_t* visible);
+
+    /**
+     * Draw `count` instances; their model matrices (tightly packed mat4s)
+     * start at byteOffset in `instances` and feed the shader's aInstanceModel.
+     * Does nothing if the shader has no such input.
+     */
+    void DrawInstanced(const Shader& shader, VBO& instances, size_t byteOffset, GLsizei count);
+
+    // Screen-space importance for a queued upload this frame (see UploadQueue)
+    void PrioritizeUpload(float importance) const;
+    bool IsUploadPending() const { return pendingUpload != nullptr; }
+
+    const std::vector<Meshlet>& GetMeshlets() const { return data.meshlets; }
+    const glm::vec3& GetBoundsCenter() const { return data.boundsCenter; }
+    float GetBoundsRadius() const { return data.boundsRadius; }
+
+    const VertexFormat& GetVertexFormat() const { return data.format; }
+    size_t GetVertexCount() const { return data.vertexCount; }
+    size_t GetVertexBufferSize() const { return data.vertexSize; }
+    GLenum GetIndexType() const { return data.indexType; }
+    size_t GetIndexCount() const { return data.indexCount; }
+    size_t GetIndexBufferSize() const { return data.indexSize; }
+    size_t GetDrawRangeCount() const { return data.drawRanges.size(); }
+
+    /**
+     * Where to reload the packed data from once the CPU copy is released
+     * (set by MeshLoader). Without one the CPU copy is never released.
+     */
+    void SetReloadSource(ReloadSource source);
+
+    // Keep the CPU copy even when reloadable (picking, collision, ...)
+    void SetKeepCpuData(bool keep);
+    bool HasCpuData() const { return data.HasBytes(); }
+
+    // Copy the packed CPU data out (used when reloading from a fresh import)
+    void CopyCpuData(std::vector<uint8_t>& outVertexData, std::vector<uint8_t>& outIndexData) const;
+
+    // Packed description (bytes only while HasCpuData())
+    const MeshData& GetData() const { return data; }
+
+    // ResidentAsset
+    size_t GetGpuBytes() const override;
+    size_t GetCpuBytes() const override;
+
 
     // Move Constructor (Defaults to moving the underlying VAO/VBO/EBO)
     Mesh(Mesh&& other) noexcept = default;
@@ -52,11 +127,24 @@ public:
     Mesh(const Mesh&) = delete;
     Mesh& operator=(const Mesh&) = delete;
 
+protected:
+    bool CanEvictGpu() const override;
+    void EvictGpu() override;
+    bool RestoreGpu() override;
+    size_t ReleaseCpu() override;
+
 private:
-    // Vertex and index data (kept for potential future use)
-    std::vector<Vertex> vertices;
-    std::vector<unsigned int> indices;
-    
+    // Packed GPU-layout data; the bytes are released after upload when reloadable
+    MeshData data;
+
+    ReloadSource reloadSource;
+    bool keepCpuData = false;
+
+    // Buffers being filled by the UploadQueue or UploadThread (shared with their callbacks)
+    struct PendingUpload;
+    std::shared_ptr<PendingUpload> pendingUpload;
+    bool adoptPendingUpload();  // False while the upload is still in flight
+
     // OpenGL buffer objects - RAII managed
     VAO vao;
     VBO vbo;
@@ -66,6 +154,7 @@ private:
     // Using shader ID avoids pointer lifetime issues
     std::unordered_set<GLuint> configuredShaders;
     void configureForShader(const Shader& shader);
+    void upload();
 };
 
 } // namespace engine
\ No newline at end of file
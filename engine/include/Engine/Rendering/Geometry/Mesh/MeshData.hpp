@@ -0,0 +1,72 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "Engine/Rendering/Geometry/Mesh/VertexFormat.hpp"
+#include "Engine/Rendering/Geometry/Mesh/Meshlet.hpp"
+
+namespace engine {
+
+/**
+ * MeshData - A mesh in its final GPU layout, without any GL objects
+ *
+ * - Pack() builds it from importer output (vertex encoding, 16-bit index
+ *   chunking, bounds); .emesh files store exactly this, so loading one is
+ *   a memory map and no per-vertex work at all
+ * - The vertex/index bytes are borrowed: `storage` owns them (two vectors,
+ *   or a MappedFile) and keeps them alive for as long as any copy of the
+ *   MeshData, or an upload started from it, still needs them
+ * - Safe to build on any thread
+ */
+struct MeshData {
+    // One draw call; baseVertex rebases 16-bit chunks of big meshes
+    struct DrawRange {
+        uint32_t count = 0;
+        uint64_t byteOffset = 0;
+        int32_t baseVertex = 0;
+    };
+
+    VertexFormat format;
+    uint64_t vertexCount = 0;
+    uint64_t indexCount = 0;
+    GLenum indexType = GL_UNSIGNED_INT;
+    std::vector<DrawRange> drawRanges;
+
+    std::vector<Meshlet> meshlets;
+    std::vector<int32_t> meshletBaseVertex;  // Base vertex of the chunk holding each meshlet
+
+    glm::vec3 boundsCenter = glm::vec3(0.0f);
+    float boundsRadius = 0.0f;
+
+    // position = aPosition * posScale + posOffset
+    glm::vec3 posScale = glm::vec3(1.0f);
+    glm::vec3 posOffset = glm::vec3(0.0f);
+
+    const uint8_t* vertexBytes = nullptr;
+    size_t vertexSize = 0;
+    const uint8_t* indexBytes = nullptr;
+    size_t indexSize = 0;
+    std::shared_ptr<const void> storage;
+
+    bool HasBytes() const { return storage != nullptr; }
+
+    // Take ownership of packed bytes (same layout as vertexBytes/indexBytes)
+    void SetBytes(std::vector<uint8_t> vertexData, std::vector<uint8_t> indexData);
+
+    // Drop the bytes (sizes are kept)
+    void ReleaseBytes();
+
+    /**
+     * Encode vertices and indices into GPU layout
+     * @param format GPU layout; drop hasNormals/hasTexCoords for data the source lacks
+     * @param meshlets Optional clusters covering indices (see MeshletBuilder)
+     */
+    static MeshData Pack(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+                         const VertexFormat& format = VertexFormat(), std::vector<Meshlet> meshlets = {});
+};
+
+} // namespace engine
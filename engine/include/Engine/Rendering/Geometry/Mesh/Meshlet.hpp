@@ -0,0 +1,27 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace engine {
+
+/**
+ * Meshlet - Contiguous triangle range of a mesh with culling bounds
+ *
+ * Bounds are in mesh (object) space. The normal cone is stored in the
+ * center-based form: the cluster faces away from a camera at `eye` when
+ *   dot(center - eye, coneAxis) >= coneCutoff * |center - eye| + radius
+ * coneCutoff >= 1 means the triangles face too many ways to cone-cull.
+ */
+struct Meshlet {
+    uint32_t firstIndex = 0;
+    uint32_t indexCount = 0;
+
+    glm::vec3 center = glm::vec3(0.0f);
+    float radius = 0.0f;
+
+    glm::vec3 coneAxis = glm::vec3(0.0f, 0.0f, 1.0f);
+    float coneCutoff = 1.0f;
+};
+
+} // namespace engine
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace engine {
+
+// CPU-side vertex as produced by the importers
+struct Vertex {
+    glm::vec3 Position;
+    glm::vec3 Normal;
+    glm::vec2 TexCoords;
+};
+
+/**
+ * VertexFormat - GPU layout of a mesh's vertex buffer
+ *
+ * Compact (default, 16 bytes with every attribute):
+ * - Position: 3 x unorm16 relative to the mesh AABB (padded to 8 bytes),
+ *   decoded in the vertex shader with uPosScale / uPosOffset
+ * - Normal:   octahedral, 2 x snorm16
+ * - TexCoord: 2 x half float
+ *
+ * Full keeps float positions/UVs and float2 octahedral normals, so the same
+ * shaders (aPosition vec3, aNormal vec2, aTexCoords vec2) read both layouts.
+ * Attributes a mesh doesn't have are left out of the buffer entirely.
+ */
+struct VertexFormat {
+    enum class Precision { Compact, Full };
+
+    Precision precision = Precision::Compact;
+    bool hasNormals = true;
+    bool hasTexCoords = true;
+
+    GLsizei Stride() const;
+    size_t NormalOffset() const;    // Only meaningful if hasNormals
+    size_t TexCoordOffset() const;  // Only meaningful if hasTexCoords
+
+    // GL attribute descriptions for VAO::AddAttribute
+    GLenum PositionType() const { return precision == Precision::Compact ? GL_UNSIGNED_SHORT : GL_FLOAT; }
+    GLenum NormalType() const   { return precision == Precision::Compact ? GL_SHORT : GL_FLOAT; }
+    GLenum TexCoordType() const { return precision == Precision::Compact ? GL_HALF_FLOAT : GL_FLOAT; }
+    GLboolean Normalized() const { return precision == Precision::Compact ? GL_TRUE : GL_FALSE; }
+
+    /**
+     * Pack vertices into this layout
+     * @param posScale / posOffset  Receive the dequantization terms:
+     *        position = aPosition * posScale + posOffset
+     */
+    std::vector<uint8_t> Encode(const std::vector<Vertex>& vertices,
+                                glm::vec3& posScale,
+                                glm::vec3& posOffset) const;
+};
+
+// Octahedral normal mapping, in [-1, 1]^2 (matches decodeOctNormal in GLSL)
+glm::vec2 OctEncodeNormal(const glm::vec3& n);
+glm::vec3 OctDecodeNormal(const glm::vec2& e);
+
+} // namespace engine
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Rendering/Geometry/Mesh/Mesh.hpp"
+#include "Engine/Rendering/Geometry/Model/ModelHierarchy.hpp"
 #include "Engine/Core/Graphics/Shader/Shader.hpp"
 #include <string>
 #include <vector>
@@ -23,6 +24,9 @@ public:
     // Public for now (matches your current usage pattern)
     std::vector<Mesh> meshes;
 
+    // Node tree and materials from the source file (empty for OBJ)
+    ModelHierarchy hierarchy;
+
     // Useful for resolving relative asset paths (e.g., textures referenced by the model)
     std::string directory;
 
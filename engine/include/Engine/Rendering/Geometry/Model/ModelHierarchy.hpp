@@ -0,0 +1,51 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace engine {
+
+// Surface description carried over from the source file (glTF base colour)
+struct ModelMaterial {
+    std::string name;
+    glm::vec4 baseColor = glm::vec4(1.0f);
+    std::string baseColorTexture;  // Relative to Model::directory; empty if none or embedded
+};
+
+// One node of the source scene graph, in its parent's space
+struct ModelNode {
+    std::string name;
+    int parent = -1;  // Index into ModelHierarchy::nodes; -1 for roots
+    glm::vec3 translation = glm::vec3(0.0f);
+    glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec3 scale = glm::vec3(1.0f);
+    std::vector<uint32_t> meshes;  // Indices into Model::meshes (one per primitive)
+};
+
+/**
+ * ModelHierarchy - Node tree of a model, CPU only
+ *
+ * Nodes are stored parents first, so one forward pass can build world
+ * transforms or entities. Several nodes may reference the same mesh: the
+ * GPU data is shared and the renderer draws such copies instanced.
+ * Empty for formats without a scene graph (OBJ): every mesh is then placed
+ * at the model's origin.
+ */
+struct ModelHierarchy {
+    std::vector<ModelNode> nodes;
+    std::vector<ModelMaterial> materials;
+    std::vector<int> meshMaterials;  // Per Model::meshes entry: index into materials, or -1
+
+    bool Empty() const { return nodes.empty(); }
+
+    const ModelMaterial* GetMeshMaterial(size_t mesh) const {
+        if (mesh >= meshMaterials.size()) return nullptr;
+        const int material = meshMaterials[mesh];
+        return material >= 0 && material < static_cast<int>(materials.size()) ? &materials[material] : nullptr;
+    }
+};
+
+} // namespace engine
@@ -2,10 +2,25 @@
 
 #include "Engine/Core/Graphics/Shader/Shader.hpp"
 #include "Engine/Core/Graphics/State/PipelineState.hpp"
+#include "Engine/Rendering/PostProcess/PostProcessParams.hpp"
+#include <glm/glm.hpp>
 #include <memory>
 
 namespace engine {
 
+// Per-renderer tweaks on top of a shared material (MeshRendererComponent::overrides).
+// Empty overrides cost nothing; draws batch only with equal overrides.
+struct MaterialOverrides {
+    bool hasTint = false;
+    glm::vec4 tint{1.0f};  // Multiplies the material's tint
+
+    bool Empty() const { return !hasTint; }
+    bool operator==(const MaterialOverrides& other) const {
+        return hasTint == other.hasTint && (!hasTint || tint == other.tint);
+    }
+    bool operator!=(const MaterialOverrides& other) const { return !(*this == other); }
+};
+
 class Material {
 public:
     std::shared_ptr<Shader> shader;  
@@ -17,7 +32,31 @@ public:
     
     virtual void Setup() = 0;
     
+    // Called after Setup() for renderers with non-empty overrides; must only
+    // change what the overrides cover, as the material itself is shared
+    virtual void ApplyOverrides(const MaterialOverrides& /*overrides*/) {}
+    
+    // A copy to modify without affecting the renderers sharing this one;
+    // nullptr (default) if the type can't be copied
+    virtual std::unique_ptr<Material> Clone() const { return nullptr; }
+    
+    // Screen-space effects resolved by the renderer's post pass.
+    // Return false (default) to have this material's pixels passed through.
+    virtual bool GetPostProcessParams(PostProcessParams& /*out*/) const { return false; }
+    
+    // Forward the on-screen importance of a draw to textures still being uploaded
+    virtual void PrioritizeUploads(float /*importance*/) const {}
+    
+    // True if drawing with `other` would set exactly the same state and
+    // uniforms, so the renderer may batch both into one instanced draw.
+    // Override together with Setup(); the default never batches.
+    virtual bool CanInstanceWith(const Material& /*other*/) const { return false; }
+    
     void Bind();
+    
+protected:
+    // Same concrete type, shader, pipeline state and transparency
+    bool SharesStateWith(const Material& other) const;
 };
 
 }
\ No newline at end of file
@@ -15,7 +15,7 @@ public:
     Texture* normalMap;
     Texture* emissiveMap;
     
-    std::shared_ptr<Sampler> sampler;  // Can be shared between materials
+    std::shared_ptr<Sampler> sampler;  // Usually from SamplerCache, shared between materials
     
     glm::vec4 tint;
     
@@ -28,6 +28,10 @@ public:
     TexturedMaterial();
     
     void Setup() override;
+    void ApplyOverrides(const MaterialOverrides& overrides) override;
+    std::unique_ptr<Material> Clone() const override;
+    bool CanInstanceWith(const Material& other) const override;
+    void PrioritizeUploads(float importance) const override;
 };
 
 }
\ No newline at end of file
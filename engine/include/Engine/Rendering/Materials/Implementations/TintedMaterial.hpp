@@ -12,6 +12,9 @@ public:
     TintedMaterial();
     
     void Setup() override;
+    void ApplyOverrides(const MaterialOverrides& overrides) override;
+    std::unique_ptr<Material> Clone() const override;
+    bool CanInstanceWith(const Material& other) const override;
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace engine {
+
+/**
+ * Per-material settings consumed by the full-screen post pass.
+ *
+ * Materials that want quantization / dithering / fog report these through
+ * Material::GetPostProcessParams(); the renderer turns each unique set into a
+ * material ID that the geometry pass writes next to the lit colour.
+ */
+struct PostProcessParams {
+    float colorDepth = 256.0f;     // Levels per channel (32 = PS1 5-bit)
+    float ditherStrength = 0.0f;   // 0.0 = off, 1.0 = full Bayer pattern
+    float fogStart = 1000.0f;      // View-space distance where fog begins
+    float fogEnd = 2000.0f;        // View-space distance of full fog
+    glm::vec3 fogColor = glm::vec3(0.0f);
+
+    bool operator==(const PostProcessParams& other) const {
+        return colorDepth == other.colorDepth &&
+               ditherStrength == other.ditherStrength &&
+               fogStart == other.fogStart &&
+               fogEnd == other.fogEnd &&
+               fogColor == other.fogColor;
+    }
+    bool operator!=(const PostProcessParams& other) const { return !(*this == other); }
+};
+
+} // namespace engine
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Engine/Core/Graphics/Framebuffer/Framebuffer.hpp"
+#include "Engine/Core/Graphics/Shader/Shader.hpp"
+#include "Engine/Core/Graphics/Buffers/Buffers.hpp"
+#include "Engine/Rendering/PostProcess/PostProcessParams.hpp"
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace engine {
+
+/**
+ * PostProcessPass - Offscreen scene target plus one full-screen resolve
+ *
+ * Geometry renders plain lit colour into attachment 0 and a material ID into
+ * attachment 1 (R16UI). End() resolves to the default framebuffer and applies
+ * colour quantization, 8x8 ordered dithering and distance fog once per pixel,
+ * looking up per-material settings by ID. ID 0 means "pass through untouched".
+ */
+class PostProcessPass {
+public:
+    // Size of the per-frame material table (ID 0 is reserved for pass-through)
+    static constexpr int MaxMaterials = 64;
+
+    PostProcessPass();
+    ~PostProcessPass();
+
+    // Bind the offscreen target (resizing if needed) and clear it
+    void Begin(int width, int height, const glm::vec4& clearColor);
+
+    // Returns the material ID to write for these settings (deduplicated per frame).
+    // Falls back to 0 (pass-through) once the table is full.
+    unsigned int RegisterParams(const PostProcessParams& params);
+
+    // Resolve to the default framebuffer; projection is used to rebuild view depth
+    void End(const glm::mat4& projection);
+
+    // Delete Copy
+    PostProcessPass(const PostProcessPass&) = delete;
+    PostProcessPass& operator=(const PostProcessPass&) = delete;
+
+private:
+    Framebuffer framebuffer;
+    std::unique_ptr<Shader> resolveShader;
+    VAO fullscreenVAO;  // Empty - the triangle is generated from gl_VertexID
+
+    // Index == material ID; slot 0 is the pass-through entry
+    std::vector<PostProcessParams> frameParams;
+};
+
+} // namespace engine
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Engine/ECS/Core/World/World.hpp"
+#include "Engine/Rendering/Geometry/Model/Model.hpp"
+#include "Engine/Rendering/Materials/Base/Material.hpp"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace engine {
+
+/**
+ * ModelInstantiator - Turns a Model's node tree into World entities
+ *
+ * - One entity per ModelNode, parented like the source graph under `root`
+ *   (or left as world roots), with the node's local TRS
+ * - A node with one mesh gets a MeshRendererComponent; a node with several
+ *   primitives gets one child entity per primitive
+ * - Entities point at the Model's meshes, so repeated references share GPU
+ *   buffers and the renderer draws them instanced when their materials match
+ * - Models without a hierarchy (OBJ) get one entity per mesh
+ *
+ * Materials come from `makeMaterial`, called once per renderer with the
+ * primitive's source material (nullptr if it has none); return nullptr to
+ * leave the renderer without one. Returning the same material for equal
+ * sources lets their renderers share it.
+ */
+class ModelInstantiator {
+public:
+    using MaterialFactory = std::function<std::shared_ptr<Material>(const ModelMaterial* source)>;
+
+    // Returns the top-level entities created (children of `root` if given)
+    static std::vector<Entity*> Instantiate(World& world, Model& model, Entity* root,
+                                            const MaterialFactory& makeMaterial);
+
+    // Euler angles (radians) for Entity::rotation, whose local transform
+    // applies them as Rx * Ry * Rz
+    static glm::vec3 ToEntityRotation(const glm::quat& rotation);
+};
+
+} // namespace engine
@@ -2,48 +2,155 @@
 
 #include "Engine/ECS/Core/World/World.hpp"
 #include "Engine/ECS/Core/Entity/Entity.hpp"
+#include "Engine/Assets/Formats/ESceneFormat.hpp"
 #include <nlohmann/json.hpp>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace engine {
 
 /**
- * SceneLoader - Deserializes scene from JSON files
+ * SceneLoader - Deserializes scenes from JSON or binary (.escene) files
  * 
  * Handles loading:
  * - Assets (shaders, textures, models)
- * - Entities with components
+ * - Entities with components; a "Model" component expands a model's node
+ *   hierarchy into child entities (see ModelInstantiator)
  * - Scene graph (parent-child relationships)
- * - Materials and pipeline states
+ * - Materials and pipeline states. Materials are shared: every renderer
+ *   whose "material" is the same block, or names the same entry of
+ *   "assets.materials", gets the same Material object, and samplers come
+ *   from the SamplerCache. Per-renderer differences go in "overrides":
+ *
+ *     "assets": { "materials": { "brick": { "type": "textured", "albedoMap": "brick",
+ *                                           "sampler": { "minFilter": "nearest", "wrap": "clamp" } } } }
+ *     { "type": "MeshRenderer", "mesh": "wall", "material": "brick", "overrides": { "tint": [1, 0.8, 0.8] } }
+ *
+ * JSON is the authoring format. It is streamed (see SceneReader): entities
+ * and components are created as the parser reaches them, so no document is
+ * held in memory, and only a summary line is logged. ConvertScene()
+ * flattens a JSON scene into an .escene (see ESceneFormat), which loads by
+ * mapping the file and filling the World in one pass with entities created
+ * in a single block. A JSON scene is converted while it loads and the
+ * result kept in the AssetCache, so later loads of unchanged content take
+ * the binary path.
+ *
+ * Asset loading fans out over the JobSystem: texture decodes, shader
+ * preprocessing and model imports run on workers, and only GL object
+ * creation happens on the calling (GL) thread.
  */
 class SceneLoader {
 public:
     /**
-     * Load a complete scene from a JSON file
-     * @param path Path to scene JSON file
+     * Load a complete scene from a JSON or .escene file
+     * @param path Path to scene file
      * @return Loaded world (nullptr on failure)
      */
     static std::unique_ptr<World> LoadScene(const std::string& path);
+
+    // A scene already in memory (generated, or parsed elsewhere); asset
+    // paths resolve against sceneDir and nothing is cached
+    static std::unique_ptr<World> LoadScene(const nlohmann::json& sceneJson, const std::string& sceneDir);
+
+    // Write the binary form of a JSON scene. Asset paths stay relative to
+    // the JSON's directory, so place the .escene next to it.
+    static bool ConvertScene(const std::string& jsonPath, const std::string& escenePath);
+
+    /**
+     * Two-phase loading for streaming (see WorldPartition). PrepareScene()
+     * maps the scene and reads, preprocesses and imports its shaders and
+     * models without touching GL, so it can run on a worker; a JSON scene
+     * is converted through the AssetCache, which must be enabled.
+     * InstantiateScene() then creates the GL objects and the entities on the
+     * GL thread, with the scene's root entities parented to `root` (if any).
+     */
+    struct PreparedScene;
+
+    // Models and textures an instantiated scene uses (textures include the
+    // ones its models' materials refer to), for callers that release them
+    struct SceneAssets {
+        struct Entry {
+            std::string name;
+            bool created = false;  // Not loaded before this scene
+        };
+        std::vector<Entry> models;
+        std::vector<Entry> textures;
+    };
+
+    static std::shared_ptr<PreparedScene> PrepareScene(const std::string& path);
+    static bool InstantiateScene(PreparedScene& scene, World& world, Entity* root = nullptr,
+                                 SceneAssets* assets = nullptr);
     
 private:
+    // SceneReader::Handler that fills a World, the .escene tables, or both
+    struct JsonSceneBuilder;
+    static std::unique_ptr<World> LoadJsonScene(const std::string& path, const std::string& sceneDir);
+    static std::unique_ptr<World> LoadBinaryScene(const std::string& path, const std::string& sceneDir);
+
     // Asset loading helpers
     static void LoadAssets(const nlohmann::json& assetsJson, const std::string& sceneDir);
-    static void LoadShaders(const nlohmann::json& shadersJson, const std::string& sceneDir);
+    static void LoadAssets(const ESceneFormat::View& scene, const std::string& sceneDir);
     static void LoadTextures(const nlohmann::json& texturesJson, const std::string& sceneDir);
-    static void LoadModels(const nlohmann::json& modelsJson, const std::string& sceneDir);
+    // Files the assets block reads (the scene's edges in the AssetCache graph)
+    static std::vector<std::string> GetAssetPaths(const nlohmann::json& assetsJson, const std::string& sceneDir);
+
+    // CPU side of a shader or model, filled on a worker and finished on the GL thread
+    struct PendingShader;
+    struct PendingModel;
+    static void CollectAssets(const ESceneFormat::View& scene, const std::string& sceneDir,
+                              std::vector<PendingShader>& shaders, std::vector<PendingModel>& models);
+    static void ImportAssetData(std::vector<PendingShader>& shaders, std::vector<PendingModel>& models);
+    static void ImportAssets(std::vector<PendingShader>& shaders, std::vector<PendingModel>& models);
+    // The .escene a JSON scene converts to, from the AssetCache or converted now
+    static std::string GetConvertedScene(const std::string& jsonPath);
+    static void LoadShaders(const std::vector<PendingShader>& shaders);
+    static void LoadModels(std::vector<PendingModel>& models);
     
     // Entity loading helpers
-    static void LoadEntities(World* world, const nlohmann::json& entitiesJson);
-    static Entity* LoadEntity(World* world, const nlohmann::json& entityJson, Entity* parent);
+    static void LoadTransform(Entity* entity, const nlohmann::json& transformJson);
+    static void LoadEntities(World* world, const ESceneFormat::View& scene, Entity* root = nullptr);
+
+    // The Material objects one load hands out: one per distinct block, named
+    // material or .escene record, and per model primitive completed from one
+    struct SharedMaterials;
+
+    // JSON -> .escene tables (materials deduplicated); false for unknown component types.
+    // A named material the "assets" block hasn't declared yet gets a placeholder record.
+    static void FlattenAssets(const nlohmann::json& assetsJson, ESceneFormat::Scene& scene);
+    static void FlattenTransform(const nlohmann::json& transformJson, ESceneFormat::TransformRecord& transform);
+    static bool FlattenComponent(const nlohmann::json& compJson, const nlohmann::json& namedMaterials,
+                                 ESceneFormat::Scene& scene,
+                                 std::unordered_map<std::string, int32_t>& materialIndices,
+                                 ESceneFormat::ComponentRecord& component);
+    static int32_t FlattenMaterial(const nlohmann::json& matJson, const nlohmann::json& namedMaterials,
+                                   ESceneFormat::Scene& scene,
+                                   std::unordered_map<std::string, int32_t>& materialIndices);
+    static ESceneFormat::MaterialRecord FlattenMaterialRecord(const nlohmann::json& matJson,
+                                                              ESceneFormat::Scene& scene);
     
-    // Component loading helpers
-    static void LoadComponents(Entity* entity, const nlohmann::json& componentsJson);
+    // Component loading helpers; false (with a warning) for unknown types
+    static bool LoadComponent(World* world, Entity* entity, const nlohmann::json& compJson,
+                              SharedMaterials& materials);
     static void LoadCameraComponent(Entity* entity, const nlohmann::json& camJson);
-    static void LoadMeshRendererComponent(Entity* entity, const nlohmann::json& rendererJson);
+    static void LoadMeshRendererComponent(Entity* entity, const nlohmann::json& rendererJson,
+                                          SharedMaterials& materials);
+    static void LoadModelComponent(World* world, Entity* entity, const nlohmann::json& modelJson,
+                                   SharedMaterials& materials);
+    // Entities for a model's node tree under `entity`: each primitive's own
+    // material completes `material` (a copy, shared by equal primitives) and
+    // every renderer gets `overrides`
+    static size_t InstantiateModel(World* world, Entity* entity, const std::string& modelName,
+                                   const std::shared_ptr<class Material>& material,
+                                   const struct MaterialOverrides& overrides, SharedMaterials& materials);
     
     // Material loading helpers
+    // A block, or the name of one in "assets.materials"; nullptr for unknown names
+    static std::shared_ptr<class Material> GetMaterial(const nlohmann::json& matJson, SharedMaterials& materials);
     static std::unique_ptr<class Material> LoadMaterial(const nlohmann::json& matJson);
+    static std::unique_ptr<class Material> LoadMaterial(const ESceneFormat::View& scene,
+                                                        const ESceneFormat::MaterialRecord& record);
     static void LoadPipelineState(class PipelineState& state, const nlohmann::json& stateJson);
     
     // Utility functions
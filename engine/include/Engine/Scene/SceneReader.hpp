@@ -0,0 +1,44 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <string>
+
+namespace engine {
+
+/**
+ * SceneReader - Walks a JSON scene as a stream of entity events
+ *
+ * Read() drives nlohmann's SAX parser over the file and never holds the
+ * whole document: only small, self-contained values (the "assets" block, an
+ * entity's "transform", one component) are assembled into a json, and each
+ * is handed over the moment it closes. Entities and their "children" and
+ * "components" arrays are walked structurally, so memory is bounded by the
+ * nesting depth and the largest single value, not by the file size.
+ *
+ * Events follow the file: entities arrive parents first, Begin/End pairs
+ * nest like the JSON, and keys come in file order (an entity's "name" may
+ * follow its components, and "assets" may follow "entities").
+ */
+class SceneReader {
+public:
+    class Handler {
+    public:
+        virtual ~Handler() = default;
+
+        virtual void OnAssets(const nlohmann::json& assetsJson) = 0;
+        virtual void OnBeginEntity() = 0;  // A child of the innermost open entity, if any
+        virtual void OnEntityName(const std::string& name) = 0;
+        virtual void OnTransform(const nlohmann::json& transformJson) = 0;
+        virtual void OnComponent(const nlohmann::json& componentJson) = 0;
+        virtual void OnEndEntity() = 0;
+    };
+
+    // False (with a message) if the file can't be read, isn't valid JSON, or
+    // a handler throws; events already delivered are not undone
+    static bool Read(const std::string& path, Handler& handler);
+
+    // The same events for a scene already in memory
+    static bool Walk(const nlohmann::json& sceneJson, Handler& handler);
+};
+
+} // namespace engine
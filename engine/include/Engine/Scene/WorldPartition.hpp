@@ -0,0 +1,143 @@
+#pragma once
+
+#include "Engine/ECS/Core/World/World.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Scene/SceneLoader.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace engine {
+
+class CameraComponent;
+
+/**
+ * WorldPartition - Streams a large scene in spatial cells around the camera
+ *
+ * A partitioned scene is an ordinary scene file, whose own entities (the
+ * camera, sky, ...) stay loaded, plus a "partition" block listing cells on
+ * the XZ grid. Each cell is a scene of its own (.escene, or JSON through
+ * the AssetCache) that carries only the assets its entities use:
+ *
+ *   "partition": {
+ *     "cellSize": 64, "loadRadius": 128, "unloadRadius": 160, "prefetchSeconds": 1.5,
+ *     "cells": [ { "cell": [0, -1], "scene": "world_cells/0_-1.escene" }, ... ]
+ *   }
+ *
+ * - Update() (GL thread, once per frame) wants every cell within loadRadius
+ *   of where the camera will be over the next prefetchSeconds at its current
+ *   velocity, nearest first
+ * - Wanted cells are prepared as background jobs (mapping, imports; see
+ *   SceneLoader::PrepareScene) and instantiated on the GL thread a few per
+ *   frame, under one root entity each; their uploads then go through the
+ *   UploadQueue's per-frame budget, and texture decodes through the streamer
+ * - Cells beyond unloadRadius are destroyed with their entities. Models and
+ *   textures no loaded cell uses any more are unloaded, unless they were
+ *   already loaded when the partition first needed them.
+ * - Split() turns an ordinary scene into a partitioned one (AssetCooker --partition)
+ */
+class WorldPartition {
+public:
+    struct Settings {
+        float cellSize = 64.0f;
+        float loadRadius = 128.0f;
+        float unloadRadius = 160.0f;  // Above loadRadius so cells on the boundary don't thrash
+        float prefetchSeconds = 1.5f;
+        int maxConcurrentLoads = 2;
+        int maxInstantiationsPerFrame = 1;
+    };
+
+    struct Stats {
+        size_t cells = 0;
+        size_t loaded = 0;
+        size_t pending = 0;  // Preparing or waiting to be instantiated
+        size_t entities = 0;  // In loaded cells
+        uint64_t loads = 0;
+        uint64_t unloads = 0;
+        uint64_t releasedModels = 0;
+        uint64_t releasedTextures = 0;
+        double lastInstantiateMs = 0.0;
+        double maxInstantiateMs = 0.0;  // The worst hitch streaming has caused
+    };
+
+    WorldPartition() = default;
+    ~WorldPartition() = default;  // Loaded cells stay in their World
+
+    // Reads the "partition" block of a scene file (the scene itself is
+    // loaded with SceneLoader as usual). False if it has none.
+    bool Load(const std::string& scenePath);
+
+    void Update(World& world, const CameraComponent& camera, float deltaTime);
+
+    // Destroys every loaded cell and releases its assets
+    void UnloadAll(World& world);
+
+    const Settings& GetSettings() const { return settings; }
+    void SetSettings(const Settings& newSettings) { settings = newSettings; }
+    const Stats& GetStats() const { return stats; }
+
+    // Called (GL thread) for each cell as soon as its entities exist, e.g. to swap materials
+    void SetCellLoadedCallback(std::function<void(Entity* root)> callback) { onCellLoaded = std::move(callback); }
+
+    /**
+     * Write a partitioned copy of a JSON scene: root entities go to the cell
+     * their position falls in (<outPath stem>_cells/x_z.json, converted to
+     * .escene next to it), entities with a camera stay in the scene at outPath
+     */
+    static bool Split(const std::string& scenePath, const std::string& outPath, float cellSize);
+
+    // Delete Copy
+    WorldPartition(const WorldPartition&) = delete;
+    WorldPartition& operator=(const WorldPartition&) = delete;
+
+private:
+    enum class CellState { Unloaded, Preparing, Ready, Loaded, Failed };
+
+    // Written by the background job, read once its handle is done
+    struct CellRequest {
+        std::shared_ptr<SceneLoader::PreparedScene> scene;
+    };
+
+    struct Cell {
+        glm::ivec2 coord{0};
+        std::string scenePath;
+        CellState state = CellState::Unloaded;
+        JobHandle job;
+        std::shared_ptr<CellRequest> request;
+        Entity* root = nullptr;
+        size_t entityCount = 0;
+        SceneLoader::SceneAssets assets;
+    };
+
+    // Loaded cells using an asset, and whether the partition loaded it
+    struct AssetRef {
+        uint32_t cells = 0;
+        bool owned = false;
+    };
+
+    Settings settings;
+    Stats stats;
+    std::function<void(Entity* root)> onCellLoaded;
+    std::vector<Cell> cells;
+    std::unordered_map<uint64_t, size_t> cellIndex;  // By packed coordinate
+    std::vector<size_t> active;                      // Cells not Unloaded or Failed
+    std::unordered_map<std::string, AssetRef> modelRefs;
+    std::unordered_map<std::string, AssetRef> textureRefs;
+
+    bool hasLastPosition = false;
+    glm::vec3 lastPosition{0.0f};
+    glm::vec3 velocity{0.0f};  // Smoothed
+
+    Cell* findCell(glm::ivec2 coord);
+    float cellDistance(const Cell& cell, glm::vec2 from, glm::vec2 to) const;
+    void startLoads(glm::vec2 from, glm::vec2 to, glm::vec2 position);
+    void instantiateReady(World& world, glm::vec2 position);
+    void unloadCell(World& world, Cell& cell);
+    void releaseAssets(Cell& cell);
+};
+
+} // namespace engine
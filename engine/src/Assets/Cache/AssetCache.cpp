@@ -0,0 +1,480 @@
+#include "Engine/Assets/Cache/AssetCache.hpp"
+#include "Engine/Core/Utility/Hash.hpp"
+#include "Engine/Core/Utility/MappedFile.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace engine {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x49434145;  // "EACI"
+constexpr uint32_t kVersion = 1;
+
+// Bump to orphan every key, e.g. when hashing or discovery changes
+constexpr uint64_t kKeyVersion = 1;
+
+struct IndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t recordCount;
+};
+
+static_assert(sizeof(IndexHeader) == 16, "IndexHeader layout is part of the file format");
+
+std::string normalizePath(const std::string& path) {
+    return fs::path(path).lexically_normal().generic_string();
+}
+
+std::string resolveRelative(const std::string& from, const std::string& relative) {
+    return normalizePath((fs::path(from).parent_path() / relative).string());
+}
+
+std::string extensionOf(const std::string& path) {
+    std::string ext = fs::path(path).extension().string();
+    for (char& c : ext) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return ext;
+}
+
+// 0 for unreadable content
+uint64_t assetKey(AssetCache::AssetType type, uint64_t settings, uint64_t content) {
+    if (content == 0) return 0;
+
+    uint64_t key = HashBytes(&kKeyVersion, sizeof(kKeyVersion));
+    key = HashBytes(&type, sizeof(type), key);
+    key = HashBytes(&settings, sizeof(settings), key);
+    return HashBytes(&content, sizeof(content), key);
+}
+
+bool statFile(const std::string& path, uint64_t& size, int64_t& modified) {
+    std::error_code ec;
+    size = fs::file_size(path, ec);
+    if (ec) return false;
+    const auto time = fs::last_write_time(path, ec);
+    if (ec) return false;
+    modified = static_cast<int64_t>(time.time_since_epoch().count());
+    return true;
+}
+
+// glTF uris are percent-encoded ("tex%20red.png")
+std::string decodeUri(const std::string& uri) {
+    std::string out;
+    out.reserve(uri.size());
+    for (size_t i = 0; i < uri.size(); ++i) {
+        if (uri[i] == '%' && i + 2 < uri.size() && std::isxdigit(static_cast<unsigned char>(uri[i + 1])) &&
+            std::isxdigit(static_cast<unsigned char>(uri[i + 2]))) {
+            out += static_cast<char>(std::stoi(uri.substr(i + 1, 2), nullptr, 16));
+            i += 2;
+        } else {
+            out += uri[i];
+        }
+    }
+    return out;
+}
+
+void gltfReferences(const std::string& path, const std::string& jsonText, std::initializer_list<const char*> sections,
+                    std::vector<std::string>& out) {
+    const nlohmann::json gltf = nlohmann::json::parse(jsonText, nullptr, false);
+    if (gltf.is_discarded() || !gltf.is_object()) return;
+
+    for (const char* section : sections) {
+        if (!gltf.contains(section) || !gltf[section].is_array()) continue;
+        for (const auto& item : gltf[section]) {
+            if (!item.is_object() || !item.contains("uri") || !item["uri"].is_string()) continue;
+            const std::string uri = item["uri"].get<std::string>();
+            if (uri.rfind("data:", 0) == 0) continue;  // Embedded
+            out.push_back(resolveRelative(path, decodeUri(uri)));
+        }
+    }
+}
+
+// The JSON chunk of a .glb; buffer 0 is the binary chunk and needs no entry
+bool glbJson(const MappedFile& file, std::string& jsonText) {
+    constexpr uint32_t kGlbMagic = 0x46546C67;  // "glTF"
+    constexpr uint32_t kJsonChunk = 0x4E4F534A;  // "JSON"
+    uint32_t header[5];
+    if (file.Size() < sizeof(header)) return false;
+    std::memcpy(header, file.Data(), sizeof(header));
+    if (header[0] != kGlbMagic || header[4] != kJsonChunk || header[3] > file.Size() - sizeof(header)) return false;
+    jsonText.assign(reinterpret_cast<const char*>(file.Data()) + sizeof(header), header[3]);
+    return true;
+}
+
+// .gltf as is, .glb from its JSON chunk
+bool gltfJson(const std::string& path, const MappedFile& file, std::string& jsonText) {
+    if (extensionOf(path) == ".glb") return glbJson(file, jsonText);
+    jsonText.assign(reinterpret_cast<const char*>(file.Data()), file.Size());
+    return true;
+}
+
+// OBJ: every mtllib; MTL: the file name ending each texture map statement
+void textDependencies(const std::string& path, const MappedFile& file, bool material, std::vector<std::string>& out) {
+    std::istringstream lines(std::string(reinterpret_cast<const char*>(file.Data()), file.Size()));
+    std::string line;
+    while (std::getline(lines, line)) {
+        std::istringstream tokens(line);
+        std::string keyword;
+        if (!(tokens >> keyword)) continue;
+
+        std::vector<std::string> arguments;
+        for (std::string token; tokens >> token;) arguments.push_back(token);
+        if (arguments.empty()) continue;
+
+        if (!material && keyword == "mtllib") {
+            for (const std::string& library : arguments) out.push_back(resolveRelative(path, library));
+        } else if (material && (keyword.rfind("map_", 0) == 0 || keyword == "bump" || keyword == "disp" ||
+                                keyword == "decal" || keyword == "refl" || keyword == "norm")) {
+            // Options (-bm 1.0, -clamp on, ...) come first
+            out.push_back(resolveRelative(path, arguments.back()));
+        }
+    }
+}
+
+std::vector<std::string> discoverDependencies(const std::string& path) {
+    ENGINE_PROFILE_SCOPE("AssetCache::DiscoverDependencies");
+    std::vector<std::string> dependencies;
+    const std::string ext = extensionOf(path);
+    if (ext != ".gltf" && ext != ".glb" && ext != ".obj" && ext != ".mtl") return dependencies;
+
+    MappedFile file;
+    if (!file.Open(path) || file.Size() == 0) return dependencies;
+
+    if (ext == ".gltf" || ext == ".glb") {
+        std::string jsonText;
+        if (gltfJson(path, file, jsonText)) gltfReferences(path, jsonText, {"buffers", "images"}, dependencies);
+    } else {
+        textDependencies(path, file, ext == ".mtl", dependencies);
+    }
+    return dependencies;
+}
+
+void writeString(std::ofstream& file, const std::string& s) {
+    const uint32_t length = static_cast<uint32_t>(s.size());
+    file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    file.write(s.data(), s.size());
+}
+
+// Bounds-checked reads from the mapped index
+struct IndexReader {
+    const uint8_t* cursor;
+    const uint8_t* end;
+
+    template <typename T>
+    bool read(T& value) {
+        if (static_cast<size_t>(end - cursor) < sizeof(T)) return false;
+        std::memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+
+    bool readString(std::string& s) {
+        uint32_t length = 0;
+        if (!read(length) || static_cast<size_t>(end - cursor) < length) return false;
+        s.assign(reinterpret_cast<const char*>(cursor), length);
+        cursor += length;
+        return true;
+    }
+};
+
+} // namespace
+
+AssetCache& AssetCache::Instance() {
+    static AssetCache instance;
+    return instance;
+}
+
+AssetCache::~AssetCache() {
+    SaveIndex();
+}
+
+void AssetCache::SetDirectory(const std::string& dir) {
+    std::lock_guard<std::mutex> lock(mutex);
+    directory = dir;
+}
+
+void AssetCache::loadIndexLocked() {
+    if (indexLoaded) return;
+    indexLoaded = true;
+    if (!m_Enabled) return;
+
+    MappedFile file;
+    if (!file.Open((fs::path(directory) / "index.bin").string())) return;  // First run
+
+    IndexReader reader{file.Data(), file.Data() + file.Size()};
+    IndexHeader header{};
+    if (!reader.read(header) || header.magic != kMagic || header.version != kVersion) {
+        std::cerr << "Asset cache: ignoring unreadable index in " << directory << "\n";
+        return;
+    }
+
+    for (uint64_t i = 0; i < header.recordCount; ++i) {
+        std::string path;
+        FileRecord record;
+        uint32_t dependenciesKnown = 0;
+        uint32_t dependencyCount = 0;
+        bool ok = reader.readString(path) && reader.read(record.size) && reader.read(record.modified) &&
+                  reader.read(record.hash) && reader.read(dependenciesKnown) && reader.read(dependencyCount);
+        for (uint32_t d = 0; ok && d < dependencyCount; ++d) {
+            ok = reader.readString(record.dependencies.emplace_back());
+        }
+        if (!ok) {
+            std::cerr << "Asset cache: index truncated after " << i << " records\n";
+            return;
+        }
+        record.dependenciesKnown = dependenciesKnown != 0;
+        files.emplace(std::move(path), std::move(record));
+    }
+}
+
+bool AssetCache::SaveIndex() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!m_Enabled || !indexDirty) return true;
+
+    std::error_code ec;
+    fs::create_directories(directory, ec);
+    if (ec) {
+        std::cerr << "Asset cache: cannot create " << directory << ": " << ec.message() << "\n";
+        return false;
+    }
+
+    // Write to a temp file and rename so a crash never leaves a torn file
+    const std::string path = (fs::path(directory) / "index.bin").string();
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        IndexHeader header{kMagic, kVersion, files.size()};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const auto& [filePath, record] : files) {
+            const uint32_t dependenciesKnown = record.dependenciesKnown ? 1 : 0;
+            const uint32_t dependencyCount = static_cast<uint32_t>(record.dependencies.size());
+            writeString(file, filePath);
+            file.write(reinterpret_cast<const char*>(&record.size), sizeof(record.size));
+            file.write(reinterpret_cast<const char*>(&record.modified), sizeof(record.modified));
+            file.write(reinterpret_cast<const char*>(&record.hash), sizeof(record.hash));
+            file.write(reinterpret_cast<const char*>(&dependenciesKnown), sizeof(dependenciesKnown));
+            file.write(reinterpret_cast<const char*>(&dependencyCount), sizeof(dependencyCount));
+            for (const std::string& dependency : record.dependencies) writeString(file, dependency);
+        }
+        if (!file) {
+            file.close();
+            fs::remove(tmpPath, ec);
+            std::cerr << "Asset cache: index write failed: " << tmpPath << "\n";
+            return false;
+        }
+    }
+    fs::rename(tmpPath, path, ec);
+    if (ec) {
+        fs::remove(tmpPath, ec);
+        std::cerr << "Asset cache: cannot replace " << path << "\n";
+        return false;
+    }
+    indexDirty = false;
+    return true;
+}
+
+uint64_t AssetCache::HashFile(const std::string& rawPath) {
+    const std::string path = normalizePath(rawPath);
+    uint64_t size = 0;
+    int64_t modified = 0;
+    if (!statFile(path, size, modified)) return 0;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadIndexLocked();
+        auto it = files.find(path);
+        if (it != files.end() && it->second.hash != 0 && it->second.size == size && it->second.modified == modified) {
+            stats.unchanged++;
+            return it->second.hash;
+        }
+    }
+
+    // Hash outside the lock; several workers may be importing at once
+    ENGINE_PROFILE_SCOPE("AssetCache::HashFile");
+    MappedFile file;
+    if (!file.Open(path)) return 0;
+    const uint64_t hash = HashBytes(file.Data(), file.Size());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    FileRecord& record = files[path];
+    if (record.hash != hash) {
+        // New contents may reference other files
+        record.dependenciesKnown = false;
+        record.dependencies.clear();
+    }
+    record.size = size;
+    record.modified = modified;
+    record.hash = hash;
+    indexDirty = true;
+    stats.hashed++;
+    return hash;
+}
+
+std::vector<std::string> AssetCache::GetDependencies(const std::string& rawPath) {
+    const std::string path = normalizePath(rawPath);
+    if (HashFile(path) == 0) return {};
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = files.find(path);
+        if (it != files.end() && it->second.dependenciesKnown) return it->second.dependencies;
+    }
+
+    std::vector<std::string> dependencies = discoverDependencies(path);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    FileRecord& record = files[path];
+    record.dependencies = dependencies;
+    record.dependenciesKnown = true;
+    indexDirty = true;
+    return dependencies;
+}
+
+std::vector<std::string> AssetCache::GetGltfReferences(const std::string& rawPath, const char* section) {
+    const std::string path = normalizePath(rawPath);
+    std::vector<std::string> references;
+    MappedFile file;
+    std::string jsonText;
+    if (file.Open(path) && file.Size() > 0 && gltfJson(path, file, jsonText)) {
+        gltfReferences(path, jsonText, {section}, references);
+    }
+    return references;
+}
+
+void AssetCache::SetDependencies(const std::string& rawPath, std::vector<std::string> dependencies) {
+    const std::string path = normalizePath(rawPath);
+    if (HashFile(path) == 0) return;
+
+    for (std::string& dependency : dependencies) dependency = normalizePath(dependency);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    FileRecord& record = files[path];
+    if (record.dependenciesKnown && record.dependencies == dependencies) return;
+    record.dependencies = std::move(dependencies);
+    record.dependenciesKnown = true;
+    indexDirty = true;
+}
+
+uint64_t AssetCache::contentKey(const std::string& path, std::unordered_set<std::string>& visiting) {
+    const uint64_t hash = HashFile(path);
+    if (hash == 0) return 0;
+
+    uint64_t key = hash;
+    for (const std::string& dependency : GetDependencies(path)) {
+        // Cycles and shared dependencies count once, at their first visit
+        if (!visiting.insert(dependency).second) continue;
+        const uint64_t dependencyKey = contentKey(dependency, visiting);  // 0 while missing
+        key = HashBytes(&dependencyKey, sizeof(dependencyKey), key);
+    }
+    return key;
+}
+
+bool AssetCache::knownContentKey(const std::string& path, std::unordered_set<std::string>& visiting,
+                                 uint64_t& key) {
+    uint64_t size = 0;
+    int64_t modified = 0;
+    if (!statFile(path, size, modified)) {
+        key = 0;  // Missing, as contentKey() counts it
+        return true;
+    }
+
+    std::vector<std::string> dependencies;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadIndexLocked();
+        auto it = files.find(path);
+        if (it == files.end() || it->second.hash == 0 || it->second.size != size ||
+            it->second.modified != modified || !it->second.dependenciesKnown) {
+            return false;
+        }
+        key = it->second.hash;
+        dependencies = it->second.dependencies;
+    }
+
+    for (const std::string& dependency : dependencies) {
+        if (!visiting.insert(dependency).second) continue;
+        uint64_t dependencyKey = 0;
+        if (!knownContentKey(dependency, visiting, dependencyKey)) return false;
+        key = HashBytes(&dependencyKey, sizeof(dependencyKey), key);
+    }
+    return true;
+}
+
+uint64_t AssetCache::ComputeKey(AssetType type, const std::string& path, uint64_t settings) {
+    std::unordered_set<std::string> visiting{normalizePath(path)};
+    return assetKey(type, settings, contentKey(normalizePath(path), visiting));
+}
+
+uint64_t AssetCache::FindKey(AssetType type, const std::string& path, uint64_t settings) {
+    std::unordered_set<std::string> visiting{normalizePath(path)};
+    uint64_t content = 0;
+    if (!knownContentKey(normalizePath(path), visiting, content)) return 0;
+    return assetKey(type, settings, content);
+}
+
+std::string AssetCache::derivedPath(uint64_t key, const char* extension) const {
+    return (fs::path(directory) / (HashToHex(key) + extension)).string();
+}
+
+std::string AssetCache::FindDerived(uint64_t key, const char* extension) {
+    if (!m_Enabled || key == 0) return "";
+
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        path = derivedPath(key, extension);
+    }
+    std::error_code ec;
+    const bool found = fs::is_regular_file(path, ec);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (found) {
+        stats.hits++;
+        return path;
+    }
+    stats.misses++;
+    return "";
+}
+
+bool AssetCache::StoreDerived(uint64_t key, const char* extension,
+                              const std::function<bool(const std::string&)>& write) {
+    if (!m_Enabled || key == 0) return false;
+
+    std::string path;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!storing.insert(key).second) return false;  // Same content imported on another thread
+        path = derivedPath(key, extension);
+    }
+
+    std::error_code ec;
+    fs::create_directories(fs::path(path).parent_path(), ec);
+    const bool stored = !ec && write(path);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    storing.erase(key);
+    if (stored) stats.stored++;
+    return stored;
+}
+
+AssetCache::Stats AssetCache::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void AssetCache::ResetStats() {
+    std::lock_guard<std::mutex> lock(mutex);
+    stats = Stats();
+}
+
+} // namespace engine
@@ -0,0 +1,462 @@
+#include "Engine/Assets/Formats/EMeshFormat.hpp"
+#include "Engine/Core/Utility/MappedFile.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+namespace engine {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x48534D45;  // "EMSH"
+constexpr uint32_t kVersion = 2;  // 2: node hierarchy section
+constexpr uint64_t kBlobAlignment = 16;
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t meshCount;
+    uint32_t reserved;
+    uint64_t fileSize;  // Catches truncated copies
+    uint64_t hierarchyOffset;
+    uint64_t hierarchySize;  // 0: no hierarchy
+};
+
+struct MeshRecord {
+    uint8_t precision;  // VertexFormat::Precision
+    uint8_t hasNormals;
+    uint8_t hasTexCoords;
+    uint8_t reserved;
+    uint32_t indexType;  // GL_UNSIGNED_SHORT / GL_UNSIGNED_INT
+    uint64_t vertexCount;
+    uint64_t indexCount;
+    float boundsCenter[3];
+    float boundsRadius;
+    float posScale[3];
+    float posOffset[3];
+    uint32_t drawRangeCount;
+    uint32_t meshletCount;
+    uint64_t vertexOffset;
+    uint64_t vertexSize;
+    uint64_t indexOffset;
+    uint64_t indexSize;
+    uint64_t drawRangeOffset;
+    uint64_t meshletOffset;
+};
+
+struct DrawRangeRecord {
+    uint32_t count;
+    int32_t baseVertex;
+    uint64_t byteOffset;
+};
+
+struct MeshletRecord {
+    uint32_t firstIndex;
+    uint32_t indexCount;
+    int32_t baseVertex;
+    float center[3];
+    float radius;
+    float coneAxis[3];
+    float coneCutoff;
+};
+
+static_assert(sizeof(FileHeader) == 40, "FileHeader layout is part of the file format");
+static_assert(sizeof(MeshRecord) == 120, "MeshRecord layout is part of the file format");
+static_assert(sizeof(DrawRangeRecord) == 16, "DrawRangeRecord layout is part of the file format");
+static_assert(sizeof(MeshletRecord) == 44, "MeshletRecord layout is part of the file format");
+
+uint64_t alignUp(uint64_t value) {
+    return (value + kBlobAlignment - 1) & ~(kBlobAlignment - 1);
+}
+
+size_t indexSizeOf(uint32_t indexType) {
+    return indexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+// [offset, offset + size) lies inside a file of fileSize bytes
+bool inFile(uint64_t offset, uint64_t size, uint64_t fileSize) {
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+// The hierarchy section is a plain little-endian stream: counts, then
+// nodes, materials and the per-mesh material table; strings are
+// length-prefixed
+class SectionWriter {
+public:
+    std::string bytes;
+
+    template <typename T>
+    void Put(const T& value) {
+        bytes.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    void PutString(const std::string& value) {
+        Put(static_cast<uint32_t>(value.size()));
+        bytes.append(value);
+    }
+};
+
+// Every read is bounds-checked; after a failed read `ok` stays false
+class SectionReader {
+public:
+    SectionReader(const uint8_t* data, uint64_t size) : m_Cursor(data), m_End(data + size) {}
+
+    bool ok = true;
+
+    template <typename T>
+    T Get() {
+        T value{};
+        if (!ok || static_cast<uint64_t>(m_End - m_Cursor) < sizeof(T)) {
+            ok = false;
+            return value;
+        }
+        std::memcpy(&value, m_Cursor, sizeof(T));
+        m_Cursor += sizeof(T);
+        return value;
+    }
+    std::string GetString() {
+        const uint32_t size = Get<uint32_t>();
+        if (!ok || static_cast<uint64_t>(m_End - m_Cursor) < size) {
+            ok = false;
+            return {};
+        }
+        std::string value(reinterpret_cast<const char*>(m_Cursor), size);
+        m_Cursor += size;
+        return value;
+    }
+    // A count of elements at least minBytes each still fits in what's left
+    bool Fits(uint32_t count, size_t minBytes) {
+        ok = ok && count <= static_cast<uint64_t>(m_End - m_Cursor) / minBytes;
+        return ok;
+    }
+
+private:
+    const uint8_t* m_Cursor;
+    const uint8_t* m_End;
+};
+
+std::string writeHierarchy(const ModelHierarchy& hierarchy) {
+    SectionWriter out;
+    out.Put(static_cast<uint32_t>(hierarchy.nodes.size()));
+    out.Put(static_cast<uint32_t>(hierarchy.materials.size()));
+    out.Put(static_cast<uint32_t>(hierarchy.meshMaterials.size()));
+
+    for (const ModelNode& node : hierarchy.nodes) {
+        out.PutString(node.name);
+        out.Put(static_cast<int32_t>(node.parent));
+        out.Put(node.translation);
+        out.Put(glm::vec4(node.rotation.x, node.rotation.y, node.rotation.z, node.rotation.w));
+        out.Put(node.scale);
+        out.Put(static_cast<uint32_t>(node.meshes.size()));
+        for (uint32_t mesh : node.meshes) out.Put(mesh);
+    }
+    for (const ModelMaterial& material : hierarchy.materials) {
+        out.PutString(material.name);
+        out.Put(material.baseColor);
+        out.PutString(material.baseColorTexture);
+    }
+    for (int material : hierarchy.meshMaterials) {
+        out.Put(static_cast<int32_t>(material));
+    }
+    return std::move(out.bytes);
+}
+
+// Indices are validated against meshCount; mesh indices are offset by firstMesh
+bool readHierarchy(SectionReader& in, uint32_t meshCount, uint32_t firstMesh, ModelHierarchy& hierarchy) {
+    constexpr size_t kMinNodeBytes = 4 + 4 + 40 + 4;
+    constexpr size_t kMinMaterialBytes = 4 + 16 + 4;
+
+    const uint32_t nodeCount = in.Get<uint32_t>();
+    const uint32_t materialCount = in.Get<uint32_t>();
+    const uint32_t meshMaterialCount = in.Get<uint32_t>();
+    if (!in.Fits(nodeCount, kMinNodeBytes) || meshMaterialCount > meshCount) return false;
+
+    hierarchy = ModelHierarchy{};
+    hierarchy.nodes.resize(nodeCount);
+    for (uint32_t i = 0; i < nodeCount && in.ok; ++i) {
+        ModelNode& node = hierarchy.nodes[i];
+        node.name = in.GetString();
+        node.parent = in.Get<int32_t>();
+        node.translation = in.Get<glm::vec3>();
+        const glm::vec4 rotation = in.Get<glm::vec4>();
+        node.rotation = glm::quat(rotation.w, rotation.x, rotation.y, rotation.z);
+        node.scale = in.Get<glm::vec3>();
+
+        const uint32_t count = in.Get<uint32_t>();
+        if (!in.Fits(count, sizeof(uint32_t))) return false;
+        node.meshes.resize(count);
+        for (uint32_t& mesh : node.meshes) {
+            mesh = in.Get<uint32_t>();
+            if (mesh >= meshCount) return false;
+            mesh += firstMesh;
+        }
+        // Parents first keeps instantiation a single forward pass
+        if (node.parent < -1 || node.parent >= static_cast<int32_t>(i)) return false;
+    }
+
+    if (!in.Fits(materialCount, kMinMaterialBytes)) return false;
+    hierarchy.materials.resize(materialCount);
+    for (ModelMaterial& material : hierarchy.materials) {
+        material.name = in.GetString();
+        material.baseColor = in.Get<glm::vec4>();
+        material.baseColorTexture = in.GetString();
+    }
+
+    hierarchy.meshMaterials.assign(firstMesh, -1);
+    for (uint32_t i = 0; i < meshMaterialCount; ++i) {
+        const int32_t material = in.Get<int32_t>();
+        if (material < -1 || material >= static_cast<int32_t>(materialCount)) return false;
+        hierarchy.meshMaterials.push_back(material);
+    }
+    return in.ok;
+}
+
+} // namespace
+
+bool EMeshFormat::Write(const std::string& path, const std::vector<MeshData>& meshes,
+                        const ModelHierarchy* hierarchy) {
+    ENGINE_PROFILE_SCOPE("EMeshFormat::Write");
+
+    // Lay out the blobs first so the record table can point at them
+    std::vector<MeshRecord> records(meshes.size());
+    uint64_t offset = alignUp(sizeof(FileHeader) + sizeof(MeshRecord) * meshes.size());
+
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        const MeshData& mesh = meshes[i];
+        if (!mesh.HasBytes()) {
+            std::cerr << "EMeshFormat: mesh " << i << " has no CPU data to write: " << path << "\n";
+            return false;
+        }
+
+        MeshRecord& record = records[i];
+        record = MeshRecord{};
+        record.precision = static_cast<uint8_t>(mesh.format.precision);
+        record.hasNormals = mesh.format.hasNormals ? 1 : 0;
+        record.hasTexCoords = mesh.format.hasTexCoords ? 1 : 0;
+        record.indexType = mesh.indexType;
+        record.vertexCount = mesh.vertexCount;
+        record.indexCount = mesh.indexCount;
+        std::memcpy(record.boundsCenter, &mesh.boundsCenter[0], sizeof(record.boundsCenter));
+        record.boundsRadius = mesh.boundsRadius;
+        std::memcpy(record.posScale, &mesh.posScale[0], sizeof(record.posScale));
+        std::memcpy(record.posOffset, &mesh.posOffset[0], sizeof(record.posOffset));
+        record.drawRangeCount = static_cast<uint32_t>(mesh.drawRanges.size());
+        record.meshletCount = static_cast<uint32_t>(mesh.meshlets.size());
+
+        record.vertexOffset = offset;
+        record.vertexSize = mesh.vertexSize;
+        offset = alignUp(offset + mesh.vertexSize);
+        record.indexOffset = offset;
+        record.indexSize = mesh.indexSize;
+        offset = alignUp(offset + mesh.indexSize);
+        record.drawRangeOffset = offset;
+        offset = alignUp(offset + sizeof(DrawRangeRecord) * mesh.drawRanges.size());
+        record.meshletOffset = offset;
+        offset = alignUp(offset + sizeof(MeshletRecord) * mesh.meshlets.size());
+    }
+
+    const std::string hierarchyBytes = hierarchy && !hierarchy->Empty() ? writeHierarchy(*hierarchy) : std::string();
+
+    FileHeader header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.meshCount = static_cast<uint32_t>(meshes.size());
+    header.hierarchyOffset = offset;
+    header.hierarchySize = hierarchyBytes.size();
+    header.fileSize = alignUp(offset + hierarchyBytes.size());
+
+    // Write to a temp file and rename so a crash never leaves a torn file
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "EMeshFormat: cannot write " << tmpPath << "\n";
+            return false;
+        }
+
+        const char padding[kBlobAlignment] = {};
+        auto padTo = [&](uint64_t position) {
+            const uint64_t current = static_cast<uint64_t>(file.tellp());
+            file.write(padding, static_cast<std::streamsize>(position - current));
+        };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(records.data()),
+                   static_cast<std::streamsize>(sizeof(MeshRecord) * records.size()));
+
+        for (size_t i = 0; i < meshes.size(); ++i) {
+            const MeshData& mesh = meshes[i];
+            const MeshRecord& record = records[i];
+
+            padTo(record.vertexOffset);
+            file.write(reinterpret_cast<const char*>(mesh.vertexBytes), static_cast<std::streamsize>(mesh.vertexSize));
+            padTo(record.indexOffset);
+            file.write(reinterpret_cast<const char*>(mesh.indexBytes), static_cast<std::streamsize>(mesh.indexSize));
+
+            padTo(record.drawRangeOffset);
+            for (const MeshData::DrawRange& range : mesh.drawRanges) {
+                const DrawRangeRecord out{range.count, range.baseVertex, range.byteOffset};
+                file.write(reinterpret_cast<const char*>(&out), sizeof(out));
+            }
+
+            padTo(record.meshletOffset);
+            for (size_t m = 0; m < mesh.meshlets.size(); ++m) {
+                const Meshlet& meshlet = mesh.meshlets[m];
+                MeshletRecord out{};
+                out.firstIndex = meshlet.firstIndex;
+                out.indexCount = meshlet.indexCount;
+                out.baseVertex = m < mesh.meshletBaseVertex.size() ? mesh.meshletBaseVertex[m] : 0;
+                std::memcpy(out.center, &meshlet.center[0], sizeof(out.center));
+                out.radius = meshlet.radius;
+                std::memcpy(out.coneAxis, &meshlet.coneAxis[0], sizeof(out.coneAxis));
+                out.coneCutoff = meshlet.coneCutoff;
+                file.write(reinterpret_cast<const char*>(&out), sizeof(out));
+            }
+        }
+        padTo(header.hierarchyOffset);
+        file.write(hierarchyBytes.data(), static_cast<std::streamsize>(hierarchyBytes.size()));
+        padTo(header.fileSize);
+
+        if (!file) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+            std::cerr << "EMeshFormat: write failed: " << tmpPath << "\n";
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmpPath, ec);
+        std::cerr << "EMeshFormat: cannot replace " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool EMeshFormat::Read(const std::string& path, std::vector<MeshData>& meshes, ModelHierarchy* hierarchy) {
+    ENGINE_PROFILE_SCOPE("EMeshFormat::Read");
+
+    auto file = std::make_shared<MappedFile>();
+    if (!file->Open(path)) {
+        std::cerr << "EMeshFormat: cannot open " << path << "\n";
+        return false;
+    }
+
+    const uint8_t* base = file->Data();
+    const uint64_t fileSize = file->Size();
+
+    FileHeader header{};
+    if (fileSize < sizeof(header)) {
+        std::cerr << "EMeshFormat: truncated file: " << path << "\n";
+        return false;
+    }
+    std::memcpy(&header, base, sizeof(header));
+    if (header.magic != kMagic || header.version != kVersion) {
+        std::cerr << "EMeshFormat: not a version " << kVersion << " .emesh file: " << path << "\n";
+        return false;
+    }
+    if (header.fileSize != fileSize ||
+        !inFile(sizeof(header), sizeof(MeshRecord) * static_cast<uint64_t>(header.meshCount), fileSize) ||
+        !inFile(header.hierarchyOffset, header.hierarchySize, fileSize)) {
+        std::cerr << "EMeshFormat: truncated file: " << path << "\n";
+        return false;
+    }
+
+    std::vector<MeshData> loaded(header.meshCount);
+    for (uint32_t i = 0; i < header.meshCount; ++i) {
+        MeshRecord record{};
+        std::memcpy(&record, base + sizeof(header) + sizeof(MeshRecord) * i, sizeof(record));
+
+        const uint64_t rangeBytes = sizeof(DrawRangeRecord) * static_cast<uint64_t>(record.drawRangeCount);
+        const uint64_t meshletBytes = sizeof(MeshletRecord) * static_cast<uint64_t>(record.meshletCount);
+        VertexFormat format;
+        format.precision = static_cast<VertexFormat::Precision>(record.precision);
+        format.hasNormals = record.hasNormals != 0;
+        format.hasTexCoords = record.hasTexCoords != 0;
+
+        const bool valid =
+            record.precision <= static_cast<uint8_t>(VertexFormat::Precision::Full) &&
+            (record.indexType == GL_UNSIGNED_SHORT || record.indexType == GL_UNSIGNED_INT) &&
+            record.vertexSize == record.vertexCount * static_cast<uint64_t>(format.Stride()) &&
+            record.indexSize == record.indexCount * indexSizeOf(record.indexType) &&
+            inFile(record.vertexOffset, record.vertexSize, fileSize) &&
+            inFile(record.indexOffset, record.indexSize, fileSize) &&
+            inFile(record.drawRangeOffset, rangeBytes, fileSize) &&
+            inFile(record.meshletOffset, meshletBytes, fileSize);
+        if (!valid) {
+            std::cerr << "EMeshFormat: corrupt mesh record " << i << ": " << path << "\n";
+            return false;
+        }
+
+        MeshData& mesh = loaded[i];
+        mesh.format = format;
+        mesh.vertexCount = record.vertexCount;
+        mesh.indexCount = record.indexCount;
+        mesh.indexType = record.indexType;
+        std::memcpy(&mesh.boundsCenter[0], record.boundsCenter, sizeof(record.boundsCenter));
+        mesh.boundsRadius = record.boundsRadius;
+        std::memcpy(&mesh.posScale[0], record.posScale, sizeof(record.posScale));
+        std::memcpy(&mesh.posOffset[0], record.posOffset, sizeof(record.posOffset));
+
+        mesh.drawRanges.resize(record.drawRangeCount);
+        for (uint32_t r = 0; r < record.drawRangeCount; ++r) {
+            DrawRangeRecord in{};
+            std::memcpy(&in, base + record.drawRangeOffset + sizeof(in) * r, sizeof(in));
+            if (in.byteOffset + static_cast<uint64_t>(in.count) * indexSizeOf(record.indexType) > record.indexSize) {
+                std::cerr << "EMeshFormat: draw range outside the index data: " << path << "\n";
+                return false;
+            }
+            mesh.drawRanges[r] = MeshData::DrawRange{in.count, in.byteOffset, in.baseVertex};
+        }
+
+        mesh.meshlets.resize(record.meshletCount);
+        mesh.meshletBaseVertex.resize(record.meshletCount);
+        for (uint32_t m = 0; m < record.meshletCount; ++m) {
+            MeshletRecord in{};
+            std::memcpy(&in, base + record.meshletOffset + sizeof(in) * m, sizeof(in));
+            if (static_cast<uint64_t>(in.firstIndex) + in.indexCount > record.indexCount) {
+                std::cerr << "EMeshFormat: meshlet outside the index data: " << path << "\n";
+                return false;
+            }
+
+            Meshlet& meshlet = mesh.meshlets[m];
+            meshlet.firstIndex = in.firstIndex;
+            meshlet.indexCount = in.indexCount;
+            std::memcpy(&meshlet.center[0], in.center, sizeof(in.center));
+            meshlet.radius = in.radius;
+            std::memcpy(&meshlet.coneAxis[0], in.coneAxis, sizeof(in.coneAxis));
+            meshlet.coneCutoff = in.coneCutoff;
+            mesh.meshletBaseVertex[m] = in.baseVertex;
+        }
+
+        // Zero-copy: the GPU upload reads straight out of the mapping
+        mesh.vertexBytes = base + record.vertexOffset;
+        mesh.vertexSize = record.vertexSize;
+        mesh.indexBytes = base + record.indexOffset;
+        mesh.indexSize = record.indexSize;
+        mesh.storage = file;
+    }
+
+    if (hierarchy) {
+        SectionReader reader(base + header.hierarchyOffset, header.hierarchySize);
+        if (header.hierarchySize == 0) {
+            *hierarchy = ModelHierarchy{};
+        } else if (!readHierarchy(reader, header.meshCount, static_cast<uint32_t>(meshes.size()), *hierarchy)) {
+            *hierarchy = ModelHierarchy{};
+            std::cerr << "EMeshFormat: corrupt hierarchy: " << path << "\n";
+            return false;
+        }
+    }
+
+    for (MeshData& mesh : loaded) {
+        meshes.push_back(std::move(mesh));
+    }
+    return true;
+}
+
+} // namespace engine
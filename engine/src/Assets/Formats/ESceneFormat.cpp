@@ -0,0 +1,271 @@
+#include "Engine/Assets/Formats/ESceneFormat.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace engine {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x4E435345;  // "ESCN"
+constexpr uint32_t kVersion = 2;
+constexpr uint64_t kTableAlignment = 8;
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t fileSize;  // Catches truncated copies
+    uint32_t hasResidency;
+    uint32_t reserved;
+    double gpuBudgetMB;
+    double cpuBudgetMB;
+    uint32_t assetCount;
+    uint32_t keywordCount;
+    uint32_t variantCount;
+    uint32_t entityCount;
+    uint32_t componentCount;
+    uint32_t materialCount;
+    uint64_t assetOffset;
+    uint64_t keywordOffset;
+    uint64_t variantOffset;
+    uint64_t entityOffset;
+    uint64_t transformOffset;
+    uint64_t componentOffset;
+    uint64_t materialOffset;
+    uint64_t stringOffset;
+    uint64_t stringSize;
+};
+
+using Format = ESceneFormat;
+static_assert(sizeof(FileHeader) == 136, "FileHeader layout is part of the file format");
+static_assert(sizeof(Format::AssetRecord) == 48, "AssetRecord layout is part of the file format");
+static_assert(sizeof(Format::EntityRecord) == 24, "EntityRecord layout is part of the file format");
+static_assert(sizeof(Format::TransformRecord) == 36, "TransformRecord layout is part of the file format");
+static_assert(sizeof(Format::ComponentRecord) == 60, "ComponentRecord layout is part of the file format");
+static_assert(sizeof(Format::MaterialRecord) == 108, "MaterialRecord layout is part of the file format");
+
+uint64_t alignUp(uint64_t value) {
+    return (value + kTableAlignment - 1) & ~(kTableAlignment - 1);
+}
+
+// [offset, offset + size) lies inside a file of fileSize bytes
+bool inFile(uint64_t offset, uint64_t size, uint64_t fileSize) {
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+bool validString(Format::StringRef ref, uint64_t stringSize) {
+    return inFile(ref.offset, ref.size, stringSize);
+}
+
+template <typename T>
+bool mapTable(const MappedFile& file, uint64_t offset, uint32_t count, const T*& table) {
+    if (offset % alignof(T) != 0 || !inFile(offset, sizeof(T) * static_cast<uint64_t>(count), file.Size())) {
+        return false;
+    }
+    table = reinterpret_cast<const T*>(file.Data() + offset);
+    return true;
+}
+
+bool validate(const Format::View& view, uint64_t stringSize) {
+    for (uint32_t i = 0; i < view.assetCount; ++i) {
+        const Format::AssetRecord& asset = view.assets[i];
+        if (asset.type > Format::AssetType::Model || !validString(asset.name, stringSize) ||
+            !validString(asset.path, stringSize) || !validString(asset.fragmentPath, stringSize) ||
+            asset.firstKeyword > view.keywordCount || asset.keywordCount > view.keywordCount - asset.firstKeyword ||
+            asset.firstVariant > view.variantCount || asset.variantCount > view.variantCount - asset.firstVariant) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < view.keywordCount; ++i) {
+        if (!validString(view.keywords[i], stringSize)) return false;
+    }
+    // The loader reserves childCount slots, so it must match the parents recorded
+    std::vector<uint32_t> children(view.entityCount, 0);
+    for (uint32_t i = 0; i < view.entityCount; ++i) {
+        const Format::EntityRecord& entity = view.entities[i];
+        if (!validString(entity.name, stringSize) || entity.parent < -1 || entity.parent >= static_cast<int32_t>(i) ||
+            entity.firstComponent > view.componentCount ||
+            entity.componentCount > view.componentCount - entity.firstComponent) {
+            return false;
+        }
+        if (entity.parent >= 0) children[entity.parent]++;
+    }
+    for (uint32_t i = 0; i < view.entityCount; ++i) {
+        if (view.entities[i].childCount != children[i]) return false;
+    }
+    for (uint32_t i = 0; i < view.componentCount; ++i) {
+        const Format::ComponentRecord& component = view.components[i];
+        if (component.type > Format::ComponentType::Model || !validString(component.asset, stringSize) ||
+            component.material < -1 || component.material >= static_cast<int32_t>(view.materialCount)) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < view.materialCount; ++i) {
+        const Format::MaterialRecord& material = view.materials[i];
+        if (material.type > Format::MaterialType::Textured || !validString(material.shader, stringSize)) return false;
+        for (const Format::StringRef& map : material.maps) {
+            if (!validString(map, stringSize)) return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+ESceneFormat::StringRef ESceneFormat::Scene::AddString(const std::string& s) {
+    auto it = stringLookup.find(s);
+    if (it != stringLookup.end()) return it->second;
+
+    const StringRef ref{static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(s.size())};
+    strings += s;
+    stringLookup.emplace(s, ref);
+    return ref;
+}
+
+bool ESceneFormat::IsEScenePath(const std::string& path) {
+    const size_t length = std::strlen(Extension);
+    return path.size() >= length && path.compare(path.size() - length, length, Extension) == 0;
+}
+
+bool ESceneFormat::Write(const std::string& path, const Scene& scene) {
+    ENGINE_PROFILE_SCOPE("ESceneFormat::Write");
+
+    if (scene.transforms.size() != scene.entities.size()) {
+        std::cerr << "ESceneFormat: " << scene.entities.size() << " entities but " << scene.transforms.size()
+                  << " transforms for " << path << "\n";
+        return false;
+    }
+
+    FileHeader header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.hasResidency = scene.hasResidency ? 1 : 0;
+    header.gpuBudgetMB = scene.gpuBudgetMB;
+    header.cpuBudgetMB = scene.cpuBudgetMB;
+    header.assetCount = static_cast<uint32_t>(scene.assets.size());
+    header.keywordCount = static_cast<uint32_t>(scene.keywords.size());
+    header.variantCount = static_cast<uint32_t>(scene.variants.size());
+    header.entityCount = static_cast<uint32_t>(scene.entities.size());
+    header.componentCount = static_cast<uint32_t>(scene.components.size());
+    header.materialCount = static_cast<uint32_t>(scene.materials.size());
+
+    uint64_t offset = alignUp(sizeof(FileHeader));
+    auto place = [&offset](uint64_t& tableOffset, uint64_t bytes) {
+        tableOffset = offset;
+        offset = alignUp(offset + bytes);
+    };
+    place(header.assetOffset, sizeof(AssetRecord) * scene.assets.size());
+    place(header.keywordOffset, sizeof(StringRef) * scene.keywords.size());
+    place(header.variantOffset, sizeof(uint32_t) * scene.variants.size());
+    place(header.entityOffset, sizeof(EntityRecord) * scene.entities.size());
+    place(header.transformOffset, sizeof(TransformRecord) * scene.transforms.size());
+    place(header.componentOffset, sizeof(ComponentRecord) * scene.components.size());
+    place(header.materialOffset, sizeof(MaterialRecord) * scene.materials.size());
+    place(header.stringOffset, scene.strings.size());
+    header.stringSize = scene.strings.size();
+    header.fileSize = offset;
+
+    // Write to a temp file and rename so a crash never leaves a torn file
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "ESceneFormat: cannot write " << tmpPath << "\n";
+            return false;
+        }
+
+        const char padding[kTableAlignment] = {};
+        auto writeTable = [&](uint64_t tableOffset, const void* data, size_t bytes) {
+            const uint64_t current = static_cast<uint64_t>(file.tellp());
+            file.write(padding, static_cast<std::streamsize>(tableOffset - current));
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+        };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        writeTable(header.assetOffset, scene.assets.data(), sizeof(AssetRecord) * scene.assets.size());
+        writeTable(header.keywordOffset, scene.keywords.data(), sizeof(StringRef) * scene.keywords.size());
+        writeTable(header.variantOffset, scene.variants.data(), sizeof(uint32_t) * scene.variants.size());
+        writeTable(header.entityOffset, scene.entities.data(), sizeof(EntityRecord) * scene.entities.size());
+        writeTable(header.transformOffset, scene.transforms.data(), sizeof(TransformRecord) * scene.transforms.size());
+        writeTable(header.componentOffset, scene.components.data(), sizeof(ComponentRecord) * scene.components.size());
+        writeTable(header.materialOffset, scene.materials.data(), sizeof(MaterialRecord) * scene.materials.size());
+        writeTable(header.stringOffset, scene.strings.data(), scene.strings.size());
+        writeTable(header.fileSize, nullptr, 0);
+
+        if (!file) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+            std::cerr << "ESceneFormat: write failed: " << tmpPath << "\n";
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmpPath, ec);
+        std::cerr << "ESceneFormat: cannot replace " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool ESceneFormat::Read(const std::string& path, View& view) {
+    ENGINE_PROFILE_SCOPE("ESceneFormat::Read");
+
+    view = View();
+    if (!view.file.Open(path)) {
+        std::cerr << "ESceneFormat: cannot open " << path << "\n";
+        return false;
+    }
+
+    FileHeader header{};
+    if (view.file.Size() < sizeof(header)) {
+        std::cerr << "ESceneFormat: truncated file: " << path << "\n";
+        return false;
+    }
+    std::memcpy(&header, view.file.Data(), sizeof(header));
+    if (header.magic != kMagic || header.version != kVersion) {
+        std::cerr << "ESceneFormat: not a version " << kVersion << " .escene file: " << path << "\n";
+        return false;
+    }
+
+    const MappedFile& file = view.file;
+    const bool mapped = header.fileSize == file.Size() &&
+                        mapTable(file, header.assetOffset, header.assetCount, view.assets) &&
+                        mapTable(file, header.keywordOffset, header.keywordCount, view.keywords) &&
+                        mapTable(file, header.variantOffset, header.variantCount, view.variants) &&
+                        mapTable(file, header.entityOffset, header.entityCount, view.entities) &&
+                        mapTable(file, header.transformOffset, header.entityCount, view.transforms) &&
+                        mapTable(file, header.componentOffset, header.componentCount, view.components) &&
+                        mapTable(file, header.materialOffset, header.materialCount, view.materials) &&
+                        inFile(header.stringOffset, header.stringSize, file.Size());
+    if (!mapped) {
+        std::cerr << "ESceneFormat: truncated file: " << path << "\n";
+        return false;
+    }
+
+    view.hasResidency = header.hasResidency != 0;
+    view.gpuBudgetMB = header.gpuBudgetMB;
+    view.cpuBudgetMB = header.cpuBudgetMB;
+    view.assetCount = header.assetCount;
+    view.keywordCount = header.keywordCount;
+    view.variantCount = header.variantCount;
+    view.entityCount = header.entityCount;
+    view.componentCount = header.componentCount;
+    view.materialCount = header.materialCount;
+    view.strings = reinterpret_cast<const char*>(file.Data() + header.stringOffset);
+
+    if (!validate(view, header.stringSize)) {
+        std::cerr << "ESceneFormat: corrupt record table: " << path << "\n";
+        view = View();
+        return false;
+    }
+    return true;
+}
+
+} // namespace engine
@@ -0,0 +1,111 @@
+#include "Engine/Assets/Formats/ETexFormat.hpp"
+#include "Engine/Core/Utility/MappedFile.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace engine {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x58455445;  // "ETEX"
+constexpr uint32_t kVersion = 1;
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t width;
+    uint32_t height;
+    uint32_t channels;
+    uint32_t reserved;
+    uint64_t pixelBytes;
+};
+
+static_assert(sizeof(FileHeader) == 32, "FileHeader layout is part of the file format");
+
+} // namespace
+
+bool ETexFormat::IsETexPath(const std::string& path) {
+    const size_t length = std::strlen(Extension);
+    return path.size() >= length && path.compare(path.size() - length, length, Extension) == 0;
+}
+
+bool ETexFormat::Write(const std::string& path, const unsigned char* pixels, int width, int height, int channels) {
+    ENGINE_PROFILE_SCOPE("ETexFormat::Write");
+
+    if (!pixels || width <= 0 || height <= 0 || channels < 1 || channels > 4) {
+        std::cerr << "ETexFormat: invalid image for " << path << "\n";
+        return false;
+    }
+
+    FileHeader header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.width = static_cast<uint32_t>(width);
+    header.height = static_cast<uint32_t>(height);
+    header.channels = static_cast<uint32_t>(channels);
+    header.pixelBytes = static_cast<uint64_t>(width) * height * channels;
+
+    // Write to a temp file and rename so a crash never leaves a torn file
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(pixels), static_cast<std::streamsize>(header.pixelBytes));
+        if (!file) {
+            file.close();
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+            std::cerr << "ETexFormat: write failed: " << tmpPath << "\n";
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmpPath, ec);
+        std::cerr << "ETexFormat: cannot replace " << path << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool ETexFormat::Read(const std::string& path, Image& image) {
+    ENGINE_PROFILE_SCOPE("ETexFormat::Read");
+
+    auto file = std::make_shared<MappedFile>();
+    if (!file->Open(path)) {
+        std::cerr << "ETexFormat: cannot open " << path << "\n";
+        return false;
+    }
+
+    FileHeader header{};
+    if (file->Size() < sizeof(header)) {
+        std::cerr << "ETexFormat: truncated file: " << path << "\n";
+        return false;
+    }
+    std::memcpy(&header, file->Data(), sizeof(header));
+    if (header.magic != kMagic || header.version != kVersion) {
+        std::cerr << "ETexFormat: not a version " << kVersion << " .etex file: " << path << "\n";
+        return false;
+    }
+    if (header.width == 0 || header.height == 0 || header.channels < 1 || header.channels > 4 ||
+        header.pixelBytes != static_cast<uint64_t>(header.width) * header.height * header.channels ||
+        header.pixelBytes != file->Size() - sizeof(header)) {
+        std::cerr << "ETexFormat: corrupt header: " << path << "\n";
+        return false;
+    }
+
+    image.width = static_cast<int>(header.width);
+    image.height = static_cast<int>(header.height);
+    image.channels = static_cast<int>(header.channels);
+    const unsigned char* pixels = file->Data() + sizeof(header);
+    image.pixels = std::shared_ptr<const unsigned char>(file, pixels);
+    return true;
+}
+
+} // namespace engine
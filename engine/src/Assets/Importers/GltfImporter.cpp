@@ -1,9 +1,17 @@
 #include "Engine/Assets/Importers/GltfImporter.hpp"
+#include "Engine/Assets/Processing/MeshOptimizer.hpp"
+#include "Engine/Assets/Processing/MeshletBuilder.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include "Engine/Core/Utility/MappedFile.hpp"
 
 #define CGLTF_IMPLEMENTATION
 #include "cgltf.h"
 
+#include <glm/gtc/quaternion.hpp>
+#include <cstring>
 #include <iostream>
+#include <unordered_map>
 
 namespace engine {
 
@@ -21,102 +29,346 @@ static cgltf_accessor* findAttr(const cgltf_primitive& prim, cgltf_attribute_typ
     return nullptr;
 }
 
+// cgltf reads the .gltf/.glb and every external .bin through these, so
+// the files are memory-mapped: a .glb's BIN chunk and .bin buffers are
+// then decoded in place instead of being copied into heap blobs
+struct MappedFiles {
+    std::unordered_map<const void*, MappedFile> files;
+};
+
+static cgltf_result mapFile(const cgltf_memory_options*, const cgltf_file_options* fileOptions, const char* path,
+                            cgltf_size* size, void** data) {
+    MappedFile file;
+    if (!file.Open(path)) return cgltf_result_file_not_found;
+    if (file.Size() == 0) return cgltf_result_io_error;
+
+    *size = file.Size();
+    *data = const_cast<uint8_t*>(file.Data());  // cgltf only reads buffer data
+    static_cast<MappedFiles*>(fileOptions->user_data)->files.emplace(file.Data(), std::move(file));
+    return cgltf_result_success;
+}
+
+static void unmapFile(const cgltf_memory_options*, const cgltf_file_options* fileOptions, void* data, cgltf_size) {
+    static_cast<MappedFiles*>(fileOptions->user_data)->files.erase(data);
+}
+
+// Strided float view of an accessor: straight into the buffer when it is
+// plain float32, else unpacked once (normalized ints, sparse) into scratch
+struct FloatStream {
+    const uint8_t* data = nullptr;
+    size_t stride = 0;
+};
+
+static bool floatStream(const cgltf_accessor* acc, size_t components, std::vector<float>& scratch, FloatStream& out) {
+    if (!acc || cgltf_num_components(acc->type) != components) return false;
+
+    if (acc->component_type == cgltf_component_type_r_32f && !acc->is_sparse && acc->buffer_view) {
+        const uint8_t* view = cgltf_buffer_view_data(acc->buffer_view);
+        if (view) {
+            out.data = view + acc->offset;
+            out.stride = acc->stride;
+            return true;
+        }
+    }
+
+    scratch.resize(acc->count * components);
+    if (cgltf_accessor_unpack_floats(acc, scratch.data(), scratch.size()) != scratch.size()) return false;
+    out.data = reinterpret_cast<const uint8_t*>(scratch.data());
+    out.stride = components * sizeof(float);
+    return true;
+}
+
+// One triangle primitive -> packed mesh; false if it has no vertices or an
+// attribute has fewer elements than the positions
+static bool importPrimitive(const cgltf_primitive& prim, MeshData& out, MeshOptimizer::Report& report) {
+    const cgltf_accessor* posAcc = findAttr(prim, cgltf_attribute_type_position);
+    const cgltf_accessor* nrmAcc = findAttr(prim, cgltf_attribute_type_normal);
+    const cgltf_accessor* uvAcc = findAttr(prim, cgltf_attribute_type_texcoord, 0);
+
+    // Every attribute is read for each position; a shorter one would be read past its end
+    const size_t vertexCount = posAcc->count;
+    if ((nrmAcc && nrmAcc->count < vertexCount) || (uvAcc && uvAcc->count < vertexCount)) return false;
+
+    std::vector<float> posScratch, nrmScratch, uvScratch;
+    FloatStream pos, nrm, uv;
+    if (!floatStream(posAcc, 3, posScratch, pos)) return false;
+    const bool hasNormals = floatStream(nrmAcc, 3, nrmScratch, nrm);
+    const bool hasTexCoords = floatStream(uvAcc, 2, uvScratch, uv);
+
+    std::vector<Vertex> vertices(vertexCount);
+
+    // One tight loop per attribute; memcpy keeps unaligned sources legal
+    for (size_t v = 0; v < vertexCount; ++v) {
+        std::memcpy(&vertices[v].Position, pos.data + v * pos.stride, sizeof(glm::vec3));
+    }
+
+    if (hasNormals) {
+        for (size_t v = 0; v < vertexCount; ++v) {
+            std::memcpy(&vertices[v].Normal, nrm.data + v * nrm.stride, sizeof(glm::vec3));
+        }
+    } else {
+        for (Vertex& vert : vertices) vert.Normal = glm::vec3(0.0f);
+    }
+
+    if (hasTexCoords) {
+        // NOTE:
+        // The Texture loader flips image data vertically (stbi_set_flip_vertically_on_load).
+        // glTF texture coordinates assume a top-left image origin, so V is flipped here
+        // to match the global image-flip policy.
+        for (size_t v = 0; v < vertexCount; ++v) {
+            float texCoord[2];
+            std::memcpy(texCoord, uv.data + v * uv.stride, sizeof(texCoord));
+            vertices[v].TexCoords = glm::vec2(texCoord[0], 1.0f - texCoord[1]);
+        }
+    } else {
+        for (Vertex& vert : vertices) vert.TexCoords = glm::vec2(0.0f);
+    }
+
+    std::vector<unsigned int> indices;
+    if (prim.indices) {
+        // memcpy for tight uint32, one widening pass for uint8/uint16;
+        // sparse index accessors fall back to per-element reads
+        const cgltf_size count = prim.indices->count;
+        indices.resize(count);
+        if (cgltf_accessor_unpack_indices(prim.indices, indices.data(), sizeof(unsigned int), count) != count) {
+            for (cgltf_size i = 0; i < count; ++i) {
+                indices[i] = (unsigned int)cgltf_accessor_read_index(prim.indices, i);
+            }
+        }
+    } else {
+        // Non-indexed primitive: emit 0..N-1
+        indices.resize(vertices.size());
+        for (size_t i = 0; i < vertices.size(); ++i) indices[i] = (unsigned int)i;
+    }
+
+    if (vertices.empty()) return false;
+
+    // Don't spend vertex memory on attributes the primitive doesn't have
+    VertexFormat format;
+    format.hasNormals = hasNormals;
+    format.hasTexCoords = hasTexCoords;
+
+    report = MeshOptimizer::Optimize(vertices, indices);
+
+    // Large meshes are split into clusters the renderer can cull individually
+    std::vector<Meshlet> meshlets;
+    if (indices.size() / 3 >= MeshletBuilder::MinTriangles) {
+        meshlets = MeshletBuilder::Build(vertices, indices);
+        MeshOptimizer::OptimizeVertexFetch(vertices, indices);
+    }
+    out = MeshData::Pack(vertices, indices, format, std::move(meshlets));
+    return true;
+}
+
+// Local TRS of a node; a `matrix` is decomposed (no shear, as glTF requires)
+static void readNodeTransform(const cgltf_node& node, ModelNode& out) {
+    if (!node.has_matrix) {
+        if (node.has_translation) out.translation = glm::vec3(node.translation[0], node.translation[1], node.translation[2]);
+        if (node.has_rotation) out.rotation = glm::quat(node.rotation[3], node.rotation[0], node.rotation[1], node.rotation[2]);
+        if (node.has_scale) out.scale = glm::vec3(node.scale[0], node.scale[1], node.scale[2]);
+        return;
+    }
+
+    glm::mat4 m;
+    std::memcpy(&m[0][0], node.matrix, sizeof(node.matrix));
+    out.translation = glm::vec3(m[3]);
+
+    glm::mat3 basis(m);
+    out.scale = glm::vec3(glm::length(basis[0]), glm::length(basis[1]), glm::length(basis[2]));
+    if (glm::determinant(basis) < 0.0f) out.scale.x = -out.scale.x;  // Mirroring goes into the scale
+    for (int axis = 0; axis < 3; ++axis) {
+        if (out.scale[axis] != 0.0f) basis[axis] /= out.scale[axis];
+    }
+    out.rotation = glm::normalize(glm::quat_cast(basis));
+}
+
+static void readMaterial(const cgltf_material& material, ModelMaterial& out) {
+    if (material.name) out.name = material.name;
+    if (!material.has_pbr_metallic_roughness) return;
+
+    const cgltf_pbr_metallic_roughness& pbr = material.pbr_metallic_roughness;
+    out.baseColor = glm::vec4(pbr.base_color_factor[0], pbr.base_color_factor[1],
+                              pbr.base_color_factor[2], pbr.base_color_factor[3]);
+
+    // External image files only; embedded (data: / bufferView) images aren't extracted
+    const cgltf_texture* texture = pbr.base_color_texture.texture;
+    const cgltf_image* image = texture ? texture->image : nullptr;
+    if (image && image->uri && std::strncmp(image->uri, "data:", 5) != 0) {
+        std::vector<char> uri(image->uri, image->uri + std::strlen(image->uri) + 1);
+        cgltf_decode_uri(uri.data());
+        out.baseColorTexture = uri.data();
+    }
+}
+
+// Nodes of the default scene (or every parentless node), parents first.
+// primitiveMeshes[mesh][primitive] is the output mesh index, or -1 if skipped.
+static void importHierarchy(const cgltf_data* data, const std::vector<std::vector<int>>& primitiveMeshes,
+                            ModelHierarchy& hierarchy) {
+    for (cgltf_size i = 0; i < data->materials_count; ++i) {
+        readMaterial(data->materials[i], hierarchy.materials.emplace_back());
+    }
+
+    std::vector<const cgltf_node*> roots;
+    const cgltf_scene* scene = data->scene ? data->scene : (data->scenes_count > 0 ? &data->scenes[0] : nullptr);
+    if (scene) {
+        roots.assign(scene->nodes, scene->nodes + scene->nodes_count);
+    } else {
+        for (cgltf_size i = 0; i < data->nodes_count; ++i) {
+            if (!data->nodes[i].parent) roots.push_back(&data->nodes[i]);
+        }
+    }
+
+    // Depth-first; `visited` guards against malformed files with cycles
+    std::vector<char> visited(data->nodes_count, 0);
+    std::vector<std::pair<const cgltf_node*, int>> stack;
+    for (auto it = roots.rbegin(); it != roots.rend(); ++it) stack.emplace_back(*it, -1);
+
+    while (!stack.empty()) {
+        const auto [node, parent] = stack.back();
+        stack.pop_back();
+        const size_t nodeIndex = static_cast<size_t>(node - data->nodes);
+        if (nodeIndex >= data->nodes_count || visited[nodeIndex]) continue;
+        visited[nodeIndex] = 1;
+
+        const int index = static_cast<int>(hierarchy.nodes.size());
+        ModelNode& out = hierarchy.nodes.emplace_back();
+        out.parent = parent;
+        if (node->name) {
+            out.name = node->name;
+        } else if (node->mesh && node->mesh->name) {
+            out.name = node->mesh->name;
+        } else {
+            out.name = "Node_" + std::to_string(nodeIndex);
+        }
+        readNodeTransform(*node, out);
+
+        if (node->mesh) {
+            const size_t meshIndex = static_cast<size_t>(node->mesh - data->meshes);
+            for (int mesh : primitiveMeshes[meshIndex]) {
+                if (mesh >= 0) out.meshes.push_back(static_cast<uint32_t>(mesh));
+            }
+        }
+
+        for (cgltf_size c = node->children_count; c > 0; --c) {
+            stack.emplace_back(node->children[c - 1], index);
+        }
+    }
+}
+
 std::unique_ptr<Model> GltfImporter::Import(const std::string& path) {
+    std::vector<MeshData> meshes;
+    ModelHierarchy hierarchy;
+    if (!ImportMeshes(path, meshes, &hierarchy)) return nullptr;
+
+    auto model = std::make_unique<Model>();
+    model->hierarchy = std::move(hierarchy);
+    model->directory = getDirectory(path);
+    model->sourcePath = path;
+    model->meshes.reserve(meshes.size());
+    for (MeshData& mesh : meshes) {
+        model->meshes.emplace_back(std::move(mesh));
+    }
+    return model;
+}
+
+bool GltfImporter::ImportMeshes(const std::string& path, std::vector<MeshData>& meshes,
+                                ModelHierarchy* hierarchy) {
+    ENGINE_PROFILE_SCOPE("GltfImporter::Import");
+
+    MappedFiles mapped;
     cgltf_options options{};
+    options.file.read = mapFile;
+    options.file.release = unmapFile;
+    options.file.user_data = &mapped;
     cgltf_data* data = nullptr;
 
     cgltf_result res = cgltf_parse_file(&options, path.c_str(), &data);
     if (res != cgltf_result_success || !data) {
         std::cerr << "cgltf: failed to parse glTF file: " << path << "\n";
-        return nullptr;
+        return false;
     }
 
     res = cgltf_load_buffers(&options, data, path.c_str());
     if (res != cgltf_result_success) {
         std::cerr << "cgltf: failed to load buffers for: " << path << "\n";
         cgltf_free(data);
-        return nullptr;
+        return false;
     }
 
-    // Validation is helpful, but not strictly required
-    cgltf_validate(data);
-
-    auto model = std::make_unique<Model>();
-    model->directory = getDirectory(path);
-    model->sourcePath = path;
+    // Catches what the importer would otherwise read out of bounds: accessors
+    // past their buffers, attribute counts that disagree, indices past the vertices
+    res = cgltf_validate(data);
+    if (res != cgltf_result_success) {
+        std::cerr << "cgltf: invalid glTF file (error " << res << "): " << path << "\n";
+        cgltf_free(data);
+        return false;
+    }
 
+    // Every triangle primitive becomes one mesh; they're independent, so
+    // decode and process them in parallel and keep file order. Each mesh is
+    // imported once however many nodes reference it.
+    std::vector<const cgltf_primitive*> primitives;
+    std::vector<std::vector<int>> primitiveSlots(data->meshes_count);  // -> primitives index
     for (cgltf_size mi = 0; mi < data->meshes_count; ++mi) {
         const cgltf_mesh& mesh = data->meshes[mi];
-
+        primitiveSlots[mi].assign(mesh.primitives_count, -1);
         for (cgltf_size pi = 0; pi < mesh.primitives_count; ++pi) {
             const cgltf_primitive& prim = mesh.primitives[pi];
             if (prim.type != cgltf_primitive_type_triangles) continue;
+            if (!findAttr(prim, cgltf_attribute_type_position)) continue;
+            primitiveSlots[mi][pi] = static_cast<int>(primitives.size());
+            primitives.push_back(&prim);
+        }
+    }
 
-            cgltf_accessor* posAcc = findAttr(prim, cgltf_attribute_type_position);
-            if (!posAcc) continue;
-
-            cgltf_accessor* nrmAcc = findAttr(prim, cgltf_attribute_type_normal);
-            cgltf_accessor* uvAcc  = findAttr(prim, cgltf_attribute_type_texcoord, 0);
-
-            std::vector<Vertex> vertices;
-            vertices.resize(posAcc->count);
-
-            for (cgltf_size v = 0; v < posAcc->count; ++v) {
-                Vertex vert{};
-
-                float p[3] = {0,0,0};
-                cgltf_accessor_read_float(posAcc, v, p, 3);
-                vert.Position = glm::vec3(p[0], p[1], p[2]);
-
-                if (nrmAcc) {
-                    float n[3] = {0,0,0};
-                    cgltf_accessor_read_float(nrmAcc, v, n, 3);
-                    vert.Normal = glm::vec3(n[0], n[1], n[2]);
-                } else {
-                    vert.Normal = glm::vec3(0.0f);
-                }
-
-                if (uvAcc) {
-                    float uv[2] = {0,0};
-                    cgltf_accessor_read_float(uvAcc, v, uv, 2);
-
-                    // NOTE:
-                    // Your Texture loader flips image data vertically (stbi_set_flip_vertically_on_load(true)).
-                    // glTF texture coordinates are typically authored with a top-left image origin in mind,
-                    // so we flip V here to compensate and match your global image-flip policy.
-                    vert.TexCoords = glm::vec2(uv[0], 1.0f - uv[1]);
-                } else {
-                    vert.TexCoords = glm::vec2(0.0f);
-                }
+    std::vector<MeshData> packed(primitives.size());
+    std::vector<MeshOptimizer::Report> reports(primitives.size());
+    std::vector<char> produced(primitives.size(), 0);
+    JobSystem::Instance().ParallelFor(primitives.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            produced[i] = importPrimitive(*primitives[i], packed[i], reports[i]) ? 1 : 0;
+        }
+    });
 
-                vertices[v] = vert;
-            }
+    const size_t firstMesh = meshes.size();
+    MeshOptimizer::Report optimizeReport;
+    std::vector<int> meshIndex(primitives.size(), -1);
+    for (size_t i = 0; i < primitives.size(); ++i) {
+        if (!produced[i]) continue;
+        optimizeReport += reports[i];
+        meshIndex[i] = static_cast<int>(meshes.size());
+        meshes.push_back(std::move(packed[i]));
+    }
 
-            std::vector<unsigned int> indices;
-            if (prim.indices) {
-                indices.resize(prim.indices->count);
-                for (cgltf_size i = 0; i < prim.indices->count; ++i) {
-                    indices[i] = (unsigned int)cgltf_accessor_read_index(prim.indices, i);
+    if (hierarchy) {
+        std::vector<std::vector<int>> primitiveMeshes(data->meshes_count);
+        const int firstMaterial = static_cast<int>(hierarchy->materials.size());
+        hierarchy->meshMaterials.resize(meshes.size(), -1);
+        for (cgltf_size mi = 0; mi < data->meshes_count; ++mi) {
+            for (int slot : primitiveSlots[mi]) {
+                const int mesh = slot >= 0 ? meshIndex[slot] : -1;
+                primitiveMeshes[mi].push_back(mesh);
+                if (mesh >= 0 && primitives[slot]->material) {
+                    hierarchy->meshMaterials[mesh] =
+                        firstMaterial + static_cast<int>(primitives[slot]->material - data->materials);
                 }
-            } else {
-                // Non-indexed primitive: emit 0..N-1
-                indices.resize(vertices.size());
-                for (size_t i = 0; i < vertices.size(); ++i) indices[i] = (unsigned int)i;
-            }
-
-            if (!vertices.empty()) {
-                model->meshes.emplace_back(std::move(vertices), std::move(indices));
             }
         }
+        importHierarchy(data, primitiveMeshes, *hierarchy);
     }
 
     cgltf_free(data);
 
-    if (model->meshes.empty()) {
+    if (optimizeReport.meshes > 0) {
+        std::cout << "  Mesh optimization: ";
+        optimizeReport.Print(std::cout);
+    }
+
+    if (meshes.size() == firstMesh) {
         std::cerr << "GltfImporter: loaded glTF but found no triangle meshes: " << path << "\n";
     }
 
-    return model;
+    return true;
 }
 
 } // namespace engine
@@ -1,11 +1,11 @@
 #include "Engine/Assets/Importers/ObjImporter.hpp"
-
-#define TINYOBJLOADER_IMPLEMENTATION
-#include "tiny_obj_loader.h"
+#include "Engine/Assets/Importers/ObjParser.hpp"
+#include "Engine/Assets/Processing/MeshOptimizer.hpp"
+#include "Engine/Assets/Processing/MeshletBuilder.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
 
 #include <iostream>
-#include <unordered_map>
-#include <algorithm>
 
 namespace engine {
 
@@ -15,93 +15,78 @@ static std::string getDirectory(const std::string& path) {
     return path.substr(0, slash);
 }
 
-static std::string ensureTrailingSlash(std::string dir) {
-    if (!dir.empty() && dir.back() != '/' && dir.back() != '\\') dir.push_back('/');
-    return dir;
-}
+// One welded shape -> packed mesh
+static void importShape(ObjParser::Shape& shape, VertexFormat format, MeshData& out, MeshOptimizer::Report& report) {
+    std::vector<Vertex>& vertices = shape.vertices;
+    std::vector<unsigned int>& indices = shape.indices;
 
-std::unique_ptr<Model> ObjImporter::Import(const std::string& path) {
-    tinyobj::attrib_t attrib;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
-    std::string warn, err;
+    report = MeshOptimizer::Optimize(vertices, indices);
 
-    const std::string directory = getDirectory(path);
-    const std::string baseDir = ensureTrailingSlash(directory);
-
-    if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.c_str(), baseDir.c_str())) {
-        std::cerr << "TinyObjLoader Error: " << warn << err << "\n";
-        return nullptr;
+    // Large meshes are split into clusters the renderer can cull individually
+    std::vector<Meshlet> meshlets;
+    if (indices.size() / 3 >= MeshletBuilder::MinTriangles) {
+        meshlets = MeshletBuilder::Build(vertices, indices);
+        MeshOptimizer::OptimizeVertexFetch(vertices, indices);
     }
+    out = MeshData::Pack(vertices, indices, format, std::move(meshlets));
 
-    if (!warn.empty()) {
-        std::cout << "TinyObjLoader Warning: " << warn << "\n";
-    }
+    // The packed copy is all that's kept
+    vertices = {};
+    indices = {};
+}
+
+std::unique_ptr<Model> ObjImporter::Import(const std::string& path) {
+    std::vector<MeshData> meshes;
+    if (!ImportMeshes(path, meshes)) return nullptr;
 
     auto model = std::make_unique<Model>();
-    model->directory = directory;
+    model->directory = getDirectory(path);
     model->sourcePath = path;
+    model->meshes.reserve(meshes.size());
+    for (MeshData& mesh : meshes) {
+        model->meshes.emplace_back(std::move(mesh));
+    }
+    return model;
+}
 
-    // Process each shape (mesh)
-    for (const auto& shape : shapes) {
-        std::vector<Vertex> vertices;
-        std::vector<unsigned int> indices;
-        std::unordered_map<std::string, unsigned int> uniqueVertices;
-
-        // Process each face index
-        for (const auto& index : shape.mesh.indices) {
-            Vertex vertex{};
-
-            // Position
-            vertex.Position = glm::vec3(
-                attrib.vertices[3 * index.vertex_index + 0],
-                attrib.vertices[3 * index.vertex_index + 1],
-                attrib.vertices[3 * index.vertex_index + 2]
-            );
-
-            // Normal
-            if (index.normal_index >= 0) {
-                vertex.Normal = glm::vec3(
-                    attrib.normals[3 * index.normal_index + 0],
-                    attrib.normals[3 * index.normal_index + 1],
-                    attrib.normals[3 * index.normal_index + 2]
-                );
-            } else {
-                vertex.Normal = glm::vec3(0.0f);
-            }
-
-            // Texture coordinates
-            if (index.texcoord_index >= 0) {
-                vertex.TexCoords = glm::vec2(
-                    attrib.texcoords[2 * index.texcoord_index + 0],
-                    attrib.texcoords[2 * index.texcoord_index + 1]
-                );
-            } else {
-                vertex.TexCoords = glm::vec2(0.0f);
-            }
-
-            // Unique vertex key for deduplication (OBJ indices can be separate per attribute)
-            std::string key = std::to_string(index.vertex_index) + "/" +
-                              std::to_string(index.normal_index) + "/" +
-                              std::to_string(index.texcoord_index);
-
-            auto it = uniqueVertices.find(key);
-            if (it == uniqueVertices.end()) {
-                const unsigned int newIndex = static_cast<unsigned int>(vertices.size());
-                uniqueVertices.emplace(key, newIndex);
-                vertices.push_back(vertex);
-                indices.push_back(newIndex);
-            } else {
-                indices.push_back(it->second);
-            }
-        }
+bool ObjImporter::ImportMeshes(const std::string& path, std::vector<MeshData>& meshes) {
+    ENGINE_PROFILE_SCOPE("ObjImporter::Import");
+
+    ObjParser::Result obj;
+    if (!ObjParser::Load(path, obj)) return false;
+
+    if (obj.skippedTriangles > 0) {
+        std::cout << "ObjImporter Warning: skipped " << obj.skippedTriangles
+                  << " triangles with invalid position indices in: " << path << "\n";
+    }
 
-        if (!vertices.empty()) {
-            model->meshes.emplace_back(std::move(vertices), std::move(indices));
+    // Don't spend vertex memory on attributes the file doesn't have
+    VertexFormat format;
+    format.hasNormals = obj.hasNormals;
+    format.hasTexCoords = obj.hasTexCoords;
+
+    // Shapes are independent: build them in parallel and keep file order
+    const size_t shapeCount = obj.shapes.size();
+    std::vector<MeshData> packed(shapeCount);
+    std::vector<MeshOptimizer::Report> reports(shapeCount);
+    JobSystem::Instance().ParallelFor(shapeCount, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            importShape(obj.shapes[i], format, packed[i], reports[i]);
         }
+    });
+
+    MeshOptimizer::Report optimizeReport;
+    for (size_t i = 0; i < shapeCount; ++i) {
+        optimizeReport += reports[i];
+        meshes.push_back(std::move(packed[i]));
     }
 
-    return model;
+    if (optimizeReport.meshes > 0) {
+        std::cout << "  Mesh optimization: ";
+        optimizeReport.Print(std::cout);
+    }
+
+    return true;
 }
 
 } // namespace engine
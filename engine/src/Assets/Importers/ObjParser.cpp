@@ -0,0 +1,465 @@
+#include "Engine/Assets/Importers/ObjParser.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include "Engine/Core/Utility/MappedFile.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+
+namespace engine {
+
+namespace {
+
+constexpr size_t kMinChunkBytes = 1u << 20;  // Below this, splitting costs more than it saves
+constexpr size_t kChunksPerWorker = 4;       // Slack so uneven chunks still balance
+constexpr int kMaxFaceCorners = 64;          // Longer polygons are truncated
+
+// One triangle corner; 0-based attribute indices, -1 = absent
+struct Corner {
+    int32_t v, t, n;
+};
+
+struct ShapeMark {
+    size_t corner;  // Chunk-local corner where the shape starts
+    std::string name;
+};
+
+// Everything one newline-aligned slice of the file declares
+struct Chunk {
+    const char* begin = nullptr;
+    const char* end = nullptr;
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec2> texcoords;
+    std::vector<glm::vec3> normals;
+    std::vector<Corner> corners;  // 3 per triangle
+    std::vector<ShapeMark> marks;
+
+    // Corners holding negative (relative) indices, resolved against the
+    // chunk start; the chunk's global base is added once it is known
+    std::vector<size_t> relativeV, relativeT, relativeN;
+};
+
+inline bool isBlank(char c) {
+    return c == ' ' || c == '\t';
+}
+
+inline const char* skipBlanks(const char* p, const char* end) {
+    while (p < end && isBlank(*p)) ++p;
+    return p;
+}
+
+inline const char* skipToken(const char* p, const char* end) {
+    while (p < end && !isBlank(*p)) ++p;
+    return p;
+}
+
+inline float parseFloat(const char*& p, const char* end) {
+    p = skipBlanks(p, end);
+    if (p < end && *p == '+') ++p;  // from_chars rejects an explicit plus
+    float value = 0.0f;
+    const auto res = std::from_chars(p, end, value);
+    p = res.ec == std::errc() ? res.ptr : skipToken(p, end);
+    return value;
+}
+
+// Parses one OBJ index; false if there is none at p
+inline bool parseIndex(const char*& p, const char* end, long long& value) {
+    const char* start = p;
+    if (p < end && *p == '+') ++p;
+    const auto res = std::from_chars(p, end, value);
+    if (res.ec != std::errc()) {
+        p = start;
+        return false;
+    }
+    p = res.ptr;
+    return true;
+}
+
+// Turns a raw OBJ index into a chunk-relative 0-based one
+inline int32_t resolveIndex(long long raw, size_t declared, bool& relative) {
+    relative = raw < 0;
+    if (raw > 0) return static_cast<int32_t>(raw - 1);
+    if (raw < 0) return static_cast<int32_t>(static_cast<long long>(declared) + raw);
+    return -1;  // OBJ indices start at 1
+}
+
+void parseFace(const char* p, const char* end, Chunk& chunk) {
+    Corner polygon[kMaxFaceCorners];
+    bool relative[kMaxFaceCorners][3];
+    int count = 0;
+
+    for (;;) {
+        p = skipBlanks(p, end);
+        if (p >= end || count == kMaxFaceCorners) break;
+
+        Corner c{-1, -1, -1};
+        bool* rel = relative[count];
+        rel[0] = rel[1] = rel[2] = false;
+
+        long long raw = 0;
+        if (!parseIndex(p, end, raw)) break;
+        c.v = resolveIndex(raw, chunk.positions.size(), rel[0]);
+
+        if (p < end && *p == '/') {
+            ++p;
+            if (parseIndex(p, end, raw)) c.t = resolveIndex(raw, chunk.texcoords.size(), rel[1]);
+            if (p < end && *p == '/') {
+                ++p;
+                if (parseIndex(p, end, raw)) c.n = resolveIndex(raw, chunk.normals.size(), rel[2]);
+            }
+        }
+        p = skipToken(p, end);
+        polygon[count++] = c;
+    }
+
+    // Fan triangulation
+    for (int i = 1; i + 1 < count; ++i) {
+        const int fan[3] = {0, i, i + 1};
+        for (int k : fan) {
+            const size_t at = chunk.corners.size();
+            if (relative[k][0]) chunk.relativeV.push_back(at);
+            if (relative[k][1]) chunk.relativeT.push_back(at);
+            if (relative[k][2]) chunk.relativeN.push_back(at);
+            chunk.corners.push_back(polygon[k]);
+        }
+    }
+}
+
+void parseChunk(Chunk& chunk) {
+    const char* p = chunk.begin;
+    const char* const end = chunk.end;
+
+    while (p < end) {
+        // memchr is vectorized by the C library, so long lines cost little
+        const char* eol = static_cast<const char*>(std::memchr(p, '\n', static_cast<size_t>(end - p)));
+        if (!eol) eol = end;
+        const char* lineEnd = eol;
+        if (lineEnd > p && lineEnd[-1] == '\r') --lineEnd;
+
+        const char* s = skipBlanks(p, lineEnd);
+        p = eol + 1;
+        if (lineEnd - s < 2) continue;
+
+        if (s[0] == 'v') {
+            if (isBlank(s[1])) {
+                const char* q = s + 2;
+                glm::vec3 v;
+                v.x = parseFloat(q, lineEnd);
+                v.y = parseFloat(q, lineEnd);
+                v.z = parseFloat(q, lineEnd);
+                chunk.positions.push_back(v);
+            } else if (s[1] == 't' && lineEnd - s > 2 && isBlank(s[2])) {
+                const char* q = s + 3;
+                glm::vec2 t;
+                t.x = parseFloat(q, lineEnd);
+                t.y = parseFloat(q, lineEnd);
+                chunk.texcoords.push_back(t);
+            } else if (s[1] == 'n' && lineEnd - s > 2 && isBlank(s[2])) {
+                const char* q = s + 3;
+                glm::vec3 n;
+                n.x = parseFloat(q, lineEnd);
+                n.y = parseFloat(q, lineEnd);
+                n.z = parseFloat(q, lineEnd);
+                chunk.normals.push_back(n);
+            }
+        } else if (s[0] == 'f' && isBlank(s[1])) {
+            parseFace(s + 2, lineEnd, chunk);
+        } else if ((s[0] == 'o' || s[0] == 'g') && isBlank(s[1])) {
+            const char* name = skipBlanks(s + 2, lineEnd);
+            const char* nameEnd = lineEnd;
+            while (nameEnd > name && isBlank(nameEnd[-1])) --nameEnd;
+            chunk.marks.push_back(ShapeMark{chunk.corners.size(), std::string(name, nameEnd)});
+        }
+        // mtllib, usemtl, s, l, p and comments carry no geometry
+    }
+}
+
+// Murmur3 finalizer: cheap and mixes every key bit into the low bits
+inline uint64_t mix64(uint64_t k) {
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdull;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ull;
+    k ^= k >> 33;
+    return k;
+}
+
+// Fallback key when the three index ranges don't pack into 64 bits
+struct WideKey {
+    uint32_t v, t, n;
+    bool operator==(const WideKey& o) const { return v == o.v && t == o.t && n == o.n; }
+};
+
+inline uint64_t hashKey(uint64_t key) { return mix64(key); }
+inline uint64_t hashKey(const WideKey& key) {
+    return mix64((static_cast<uint64_t>(key.v) | (static_cast<uint64_t>(key.t) << 32)) ^ mix64(key.n));
+}
+
+/**
+ * Open-addressing corner -> vertex map: linear probing over a power-of-two
+ * slot array, grown at 50% load. A zero key marks an empty slot, which is
+ * safe because every stored key has a non-zero position field.
+ */
+template <typename Key>
+class WeldTable {
+public:
+    explicit WeldTable(size_t expected) {
+        size_t capacity = 16;
+        while (capacity < expected * 2) capacity <<= 1;
+        slots.assign(capacity, Slot{});
+    }
+
+    // Index already assigned to key, or `next` after recording it
+    uint32_t FindOrInsert(const Key& key, uint32_t next, bool& inserted) {
+        if ((count + 1) * 2 > slots.size()) grow();
+
+        const size_t mask = slots.size() - 1;
+        for (size_t i = hashKey(key) & mask;; i = (i + 1) & mask) {
+            Slot& slot = slots[i];
+            if (slot.key == Key{}) {
+                slot.key = key;
+                slot.index = next;
+                ++count;
+                inserted = true;
+                return next;
+            }
+            if (slot.key == key) {
+                inserted = false;
+                return slot.index;
+            }
+        }
+    }
+
+private:
+    struct Slot {
+        Key key{};
+        uint32_t index = 0;
+    };
+
+    void grow() {
+        std::vector<Slot> old(slots.size() * 2, Slot{});
+        old.swap(slots);
+        const size_t mask = slots.size() - 1;
+        for (const Slot& slot : old) {
+            if (slot.key == Key{}) continue;
+            size_t i = hashKey(slot.key) & mask;
+            while (!(slots[i].key == Key{})) i = (i + 1) & mask;
+            slots[i] = slot;
+        }
+    }
+
+    std::vector<Slot> slots;
+    size_t count = 0;
+};
+
+// Bits needed to store values 0..count (absent attributes encode as 0)
+inline unsigned bitsFor(size_t count) {
+    unsigned bits = 1;
+    while (bits < 64 && (static_cast<uint64_t>(count) >> bits) != 0) ++bits;
+    return bits;
+}
+
+struct Segment {
+    size_t chunk;
+    size_t begin, end;  // Chunk-local corner range
+};
+
+struct ShapeRange {
+    std::string name;
+    std::vector<Segment> segments;
+};
+
+struct Attributes {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec2> texcoords;
+    std::vector<glm::vec3> normals;
+};
+
+// Welds one shape's corners into unique vertices; returns the number of
+// triangles dropped because they reference a position that doesn't exist
+template <typename Key, typename MakeKey>
+size_t weldShape(const ShapeRange& range, const std::vector<Chunk>& chunks, const Attributes& attrs,
+                 MakeKey makeKey, ObjParser::Shape& out) {
+    const int32_t positionCount = static_cast<int32_t>(attrs.positions.size());
+    const int32_t texcoordCount = static_cast<int32_t>(attrs.texcoords.size());
+    const int32_t normalCount = static_cast<int32_t>(attrs.normals.size());
+
+    size_t corners = 0;
+    for (const Segment& seg : range.segments) corners += seg.end - seg.begin;
+
+    WeldTable<Key> table(corners / 4);
+    out.indices.reserve(corners);
+    size_t skipped = 0;
+
+    for (const Segment& seg : range.segments) {
+        const std::vector<Corner>& source = chunks[seg.chunk].corners;
+        for (size_t c = seg.begin; c + 3 <= seg.end; c += 3) {
+            const Corner* tri = &source[c];
+            if (tri[0].v < 0 || tri[0].v >= positionCount ||
+                tri[1].v < 0 || tri[1].v >= positionCount ||
+                tri[2].v < 0 || tri[2].v >= positionCount) {
+                ++skipped;
+                continue;
+            }
+
+            for (int k = 0; k < 3; ++k) {
+                const int32_t v = tri[k].v;
+                const int32_t t = (tri[k].t >= 0 && tri[k].t < texcoordCount) ? tri[k].t : -1;
+                const int32_t n = (tri[k].n >= 0 && tri[k].n < normalCount) ? tri[k].n : -1;
+
+                bool inserted = false;
+                const uint32_t index = table.FindOrInsert(makeKey(v, t, n),
+                                                          static_cast<uint32_t>(out.vertices.size()), inserted);
+                if (inserted) {
+                    Vertex vertex;
+                    vertex.Position = attrs.positions[v];
+                    vertex.Normal = n >= 0 ? attrs.normals[n] : glm::vec3(0.0f);
+                    vertex.TexCoords = t >= 0 ? attrs.texcoords[t] : glm::vec2(0.0f);
+                    out.vertices.push_back(vertex);
+                }
+                out.indices.push_back(index);
+            }
+        }
+    }
+    return skipped;
+}
+
+} // namespace
+
+bool ObjParser::Load(const std::string& path, Result& result) {
+    ENGINE_PROFILE_SCOPE("ObjParser::Load");
+
+    MappedFile file;
+    if (!file.Open(path)) {
+        std::cerr << "ObjParser: failed to open: " << path << "\n";
+        return false;
+    }
+
+    result = Result{};
+    const char* const data = reinterpret_cast<const char*>(file.Data());
+    const size_t size = file.Size();
+    if (size == 0) return true;
+
+    // Newline-aligned chunks, a few per worker so uneven ones still balance
+    JobSystem& jobs = JobSystem::Instance();
+    const size_t maxChunks = (static_cast<size_t>(jobs.GetWorkerCount()) + 1) * kChunksPerWorker;
+    const size_t chunkCount = std::max<size_t>(1, std::min(maxChunks, size / kMinChunkBytes));
+
+    std::vector<Chunk> chunks(chunkCount);
+    const char* cursor = data;
+    for (size_t i = 0; i < chunkCount; ++i) {
+        const char* target = data + size * (i + 1) / chunkCount;
+        if (i + 1 < chunkCount && target > cursor) {
+            const void* nl = std::memchr(target, '\n', static_cast<size_t>(data + size - target));
+            target = nl ? static_cast<const char*>(nl) + 1 : data + size;
+        }
+        chunks[i].begin = cursor;
+        chunks[i].end = std::max(cursor, target);
+        cursor = chunks[i].end;
+    }
+
+    {
+        ENGINE_PROFILE_SCOPE("ObjParser::Parse");
+        jobs.ParallelFor(chunkCount, 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) parseChunk(chunks[i]);
+        });
+    }
+
+    // Prefix sums give every chunk its global attribute base
+    std::vector<size_t> baseV(chunkCount), baseT(chunkCount), baseN(chunkCount);
+    size_t totalV = 0, totalT = 0, totalN = 0;
+    for (size_t i = 0; i < chunkCount; ++i) {
+        baseV[i] = totalV; totalV += chunks[i].positions.size();
+        baseT[i] = totalT; totalT += chunks[i].texcoords.size();
+        baseN[i] = totalN; totalN += chunks[i].normals.size();
+    }
+    if (totalV > static_cast<size_t>(INT32_MAX) - 1 || totalT > static_cast<size_t>(INT32_MAX) - 1 ||
+        totalN > static_cast<size_t>(INT32_MAX) - 1) {
+        std::cerr << "ObjParser: too many vertex attributes in: " << path << "\n";
+        return false;
+    }
+
+    Attributes attrs;
+    attrs.positions.resize(totalV);
+    attrs.texcoords.resize(totalT);
+    attrs.normals.resize(totalN);
+
+    jobs.ParallelFor(chunkCount, 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Chunk& chunk = chunks[i];
+            std::copy(chunk.positions.begin(), chunk.positions.end(), attrs.positions.begin() + baseV[i]);
+            std::copy(chunk.texcoords.begin(), chunk.texcoords.end(), attrs.texcoords.begin() + baseT[i]);
+            std::copy(chunk.normals.begin(), chunk.normals.end(), attrs.normals.begin() + baseN[i]);
+            chunk.positions = {};
+            chunk.texcoords = {};
+            chunk.normals = {};
+
+            for (size_t c : chunk.relativeV) chunk.corners[c].v += static_cast<int32_t>(baseV[i]);
+            for (size_t c : chunk.relativeT) chunk.corners[c].t += static_cast<int32_t>(baseT[i]);
+            for (size_t c : chunk.relativeN) chunk.corners[c].n += static_cast<int32_t>(baseN[i]);
+        }
+    });
+
+    // Shapes may span chunk boundaries: describe each as corner segments
+    std::vector<ShapeRange> ranges(1);
+    for (size_t i = 0; i < chunkCount; ++i) {
+        size_t start = 0;
+        for (ShapeMark& mark : chunks[i].marks) {
+            if (mark.corner > start) ranges.back().segments.push_back(Segment{i, start, mark.corner});
+            start = mark.corner;
+            if (ranges.back().segments.empty()) {
+                ranges.back().name = std::move(mark.name);  // Nothing emitted yet: rename
+            } else {
+                ranges.push_back(ShapeRange{std::move(mark.name), {}});
+            }
+        }
+        if (chunks[i].corners.size() > start) {
+            ranges.back().segments.push_back(Segment{i, start, chunks[i].corners.size()});
+        }
+    }
+    if (ranges.back().segments.empty()) ranges.pop_back();
+
+    // Pack (v, t, n) into 64 bits whenever the three index ranges fit
+    const unsigned bitsV = bitsFor(totalV), bitsT = bitsFor(totalT), bitsN = bitsFor(totalN);
+    const bool packed = bitsV + bitsT + bitsN <= 64;
+
+    std::vector<Shape> shapes(ranges.size());
+    std::vector<size_t> skipped(ranges.size(), 0);
+    {
+        ENGINE_PROFILE_SCOPE("ObjParser::Weld");
+        jobs.ParallelFor(ranges.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                shapes[i].name = ranges[i].name;
+                if (packed) {
+                    auto makeKey = [bitsV, bitsT](int32_t v, int32_t t, int32_t n) {
+                        return static_cast<uint64_t>(v + 1) |
+                               (static_cast<uint64_t>(t + 1) << bitsV) |
+                               (static_cast<uint64_t>(n + 1) << (bitsV + bitsT));
+                    };
+                    skipped[i] = weldShape<uint64_t>(ranges[i], chunks, attrs, makeKey, shapes[i]);
+                } else {
+                    auto makeKey = [](int32_t v, int32_t t, int32_t n) {
+                        return WideKey{static_cast<uint32_t>(v + 1), static_cast<uint32_t>(t + 1),
+                                       static_cast<uint32_t>(n + 1)};
+                    };
+                    skipped[i] = weldShape<WideKey>(ranges[i], chunks, attrs, makeKey, shapes[i]);
+                }
+            }
+        });
+    }
+
+    result.hasNormals = totalN > 0;
+    result.hasTexCoords = totalT > 0;
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        result.skippedTriangles += skipped[i];
+        if (shapes[i].indices.empty()) continue;
+        result.shapes.push_back(std::move(shapes[i]));
+    }
+    return true;
+}
+
+} // namespace engine
@@ -2,13 +2,21 @@
 
 #include "Engine/Assets/Importers/ObjImporter.hpp"
 #include "Engine/Assets/Importers/GltfImporter.hpp"
+#include "Engine/Assets/Formats/EMeshFormat.hpp"
+#include "Engine/Assets/Cache/AssetCache.hpp"
+#include "Engine/Assets/Residency/ResidencyManager.hpp"
 
 #include <algorithm>
 #include <cctype>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 
 namespace engine {
 
+// Bump when an importer's output changes so cached imports are redone
+static constexpr uint64_t kImportVersion = 1;
+
 static std::string toLower(std::string s) {
     std::transform(s.begin(), s.end(), s.begin(),
                    [](unsigned char c) { return (char)std::tolower(c); });
@@ -21,55 +29,153 @@ static std::string getExtension(const std::string& path) {
     return toLower(path.substr(dot + 1));
 }
 
+static std::string getDirectory(const std::string& path) {
+    const auto slash = path.find_last_of("/\\");
+    if (slash == std::string::npos) return ".";
+    return path.substr(0, slash);
+}
+
+static bool importSource(const std::string& path, const std::string& ext, std::vector<MeshData>& meshes,
+                         ModelHierarchy* hierarchy) {
+    if (ext == "obj") {
+        return ObjImporter::ImportMeshes(path, meshes);
+    }
+    return GltfImporter::ImportMeshes(path, meshes, hierarchy);
+}
+
+bool MeshLoader::ImportMeshData(const std::string& path, std::vector<MeshData>& meshes,
+                                ModelHierarchy* hierarchy) {
+    const std::string ext = getExtension(path);
+
+    // Cooked files are mapped, not parsed
+    if ("." + ext == EMeshFormat::Extension) {
+        return EMeshFormat::Read(path, meshes, hierarchy);
+    } else if (ext != "obj" && ext != "gltf" && ext != "glb") {
+        std::cerr << "MeshLoader::Load: unsupported model extension '" << ext
+                  << "' for path: " << path << "\n";
+        return false;
+    }
+
+    // Same content imported before (any path, earlier run): map that instead
+    AssetCache& cache = AssetCache::Instance();
+    const uint64_t key = cache.IsEnabled() ? cache.ComputeKey(AssetCache::AssetType::Model, path, kImportVersion) : 0;
+    const std::string derived = cache.FindDerived(key, EMeshFormat::Extension);
+    if (!derived.empty() && EMeshFormat::Read(derived, meshes, hierarchy)) {
+        return true;
+    }
+
+    // The derived file always carries the hierarchy, whether or not the caller wants it
+    ModelHierarchy imported;
+    ModelHierarchy* target = hierarchy ? hierarchy : &imported;
+    const bool fresh = meshes.empty() && target->Empty();
+    if (!importSource(path, ext, meshes, target)) {
+        return false;
+    }
+    if (fresh) {
+        cache.StoreDerived(key, EMeshFormat::Extension, [&](const std::string& out) {
+            return EMeshFormat::Write(out, meshes, target);
+        });
+    }
+    return true;
+}
+
 MeshLoader& MeshLoader::Instance() {
     static MeshLoader instance;
     return instance;
 }
 
+MeshLoader::MeshLoader() {
+    // Construct the ResidencyManager first so it outlives our meshes
+    ResidencyManager::Instance();
+}
+
 MeshLoader::~MeshLoader() {
     Clear();
 }
 
-Model* MeshLoader::Load(const std::string& name, const std::string& path) {
+Model* MeshLoader::Load(const std::string& name, const std::string& path, bool keepCpuData) {
+    // Already loaded under this name or path: Add() resolves it without importing
+    if (IsLoaded(name, path)) {
+        return Add(name, path, {}, keepCpuData);
+    }
+
+    // Same content under another path: alias it without importing
+    const uint64_t contentKey = AssetCache::Instance().ComputeKey(AssetCache::AssetType::Model, path, kImportVersion);
+    if (contentKey) {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        if (modelsByContent.count(contentKey) > 0) {
+            lock.unlock();
+            return add(name, path, contentKey, {}, keepCpuData, {});
+        }
+    }
+
+    std::vector<MeshData> meshes;
+    ModelHierarchy hierarchy;
+    if (!ImportMeshData(path, meshes, &hierarchy)) {
+        std::cerr << "MeshLoader::Load: failed to import model: " << path << "\n";
+        return nullptr;
+    }
+    return add(name, path, contentKey, std::move(meshes), keepCpuData, std::move(hierarchy));
+}
+
+Model* MeshLoader::Add(const std::string& name, const std::string& path, std::vector<MeshData> meshes,
+                       bool keepCpuData, ModelHierarchy hierarchy) {
+    const uint64_t contentKey = AssetCache::Instance().ComputeKey(AssetCache::AssetType::Model, path, kImportVersion);
+    return add(name, path, contentKey, std::move(meshes), keepCpuData, std::move(hierarchy));
+}
+
+Model* MeshLoader::add(const std::string& name, const std::string& path, uint64_t contentKey,
+                       std::vector<MeshData> meshes, bool keepCpuData, ModelHierarchy hierarchy) {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+
     // If this name already exists, return it.
     auto nameIt = modelsByName.find(name);
     if (nameIt != modelsByName.end()) {
         return nameIt->second;
     }
 
-    // If this path is already loaded, alias it with this name.
+    // If this path or content is already loaded, alias it with this name.
     auto pathIt = modelsByPath.find(path);
     if (pathIt != modelsByPath.end()) {
-        modelsByName[name] = pathIt->second.get();
-        return pathIt->second.get();
+        modelsByName[name] = pathIt->second;
+        return pathIt->second;
     }
-
-    // Choose importer by extension
-    std::unique_ptr<Model> imported;
-    const std::string ext = getExtension(path);
-
-    if (ext == "obj") {
-        imported = ObjImporter::Import(path);
-    } else if (ext == "gltf" || ext == "glb") {
-        imported = GltfImporter::Import(path);
-    } else {
-        std::cerr << "MeshLoader::Load: unsupported model extension '" << ext
-                  << "' for path: " << path << "\n";
-        return nullptr;
+    auto contentIt = contentKey ? modelsByContent.find(contentKey) : modelsByContent.end();
+    if (contentIt != modelsByContent.end()) {
+        modelsByPath[path] = contentIt->second;
+        modelsByName[name] = contentIt->second;
+        return contentIt->second;
     }
 
-    if (!imported) {
-        std::cerr << "MeshLoader::Load: failed to import model: " << path << "\n";
-        return nullptr;
+    auto imported = std::make_unique<Model>();
+    imported->directory = getDirectory(path);
+    imported->sourcePath = path;
+    imported->hierarchy = std::move(hierarchy);
+    imported->meshes.reserve(meshes.size());
+
+    // The file is the reload source for evicted meshes, so the CPU copies can go
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        Mesh& mesh = imported->meshes.emplace_back(std::move(meshes[i]));
+        mesh.SetKeepCpuData(keepCpuData);
+        mesh.SetReloadSource([path, i](std::vector<uint8_t>& vertexData, std::vector<uint8_t>& indexData) {
+            std::vector<MeshData> reloaded;
+            if (!ImportMeshData(path, reloaded) || i >= reloaded.size()) return false;
+            const MeshData& data = reloaded[i];
+            vertexData.assign(data.vertexBytes, data.vertexBytes + data.vertexSize);
+            indexData.assign(data.indexBytes, data.indexBytes + data.indexSize);
+            return true;
+        });
     }
 
-    Model* raw = imported.get();
-    modelsByPath.emplace(path, std::move(imported));
+    Model* raw = models.emplace_back(std::move(imported)).get();
+    modelsByPath[path] = raw;
     modelsByName[name] = raw;
+    if (contentKey) modelsByContent[contentKey] = raw;
     return raw;
 }
 
 Model* MeshLoader::Get(const std::string& name) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     auto it = modelsByName.find(name);
     if (it != modelsByName.end()) {
         return it->second;
@@ -77,9 +183,44 @@ Model* MeshLoader::Get(const std::string& name) {
     return nullptr;
 }
 
+bool MeshLoader::IsLoaded(const std::string& name, const std::string& path) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return modelsByName.count(name) > 0 || modelsByPath.count(path) > 0;
+}
+
+void MeshLoader::Unload(const std::string& name) {
+    std::unique_ptr<Model> doomed;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto nameIt = modelsByName.find(name);
+        if (nameIt == modelsByName.end()) return;
+        Model* model = nameIt->second;
+        modelsByName.erase(nameIt);
+
+        for (const auto& [otherName, other] : modelsByName) {
+            if (other == model) return;  // Still loaded under another name
+        }
+        for (auto it = modelsByPath.begin(); it != modelsByPath.end();) {
+            it = it->second == model ? modelsByPath.erase(it) : std::next(it);
+        }
+        for (auto it = modelsByContent.begin(); it != modelsByContent.end();) {
+            it = it->second == model ? modelsByContent.erase(it) : std::next(it);
+        }
+
+        auto owner = std::find_if(models.begin(), models.end(),
+                                  [model](const std::unique_ptr<Model>& m) { return m.get() == model; });
+        doomed = std::move(*owner);
+        models.erase(owner);
+    }
+    // GL buffers are freed outside the lock
+}
+
 void MeshLoader::Clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex);
     modelsByName.clear();
-    modelsByPath.clear(); // unique_ptr frees models
+    modelsByPath.clear();
+    modelsByContent.clear();
+    models.clear(); // unique_ptr frees models
 }
 
 } // namespace engine
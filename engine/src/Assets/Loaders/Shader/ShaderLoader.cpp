@@ -1,5 +1,9 @@
 #include "Engine/Assets/Loaders/Shader/ShaderLoader.hpp"
+#include "Engine/Core/Graphics/Shader/ShaderPreprocessor.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include "Engine/Core/Utility/Hash.hpp"
 #include <iostream>
+#include <mutex>
 
 namespace engine {
 
@@ -15,22 +19,172 @@ ShaderLoader::~ShaderLoader() {
 Shader* ShaderLoader::Load(const std::string& name,
                            const std::string& vertPath,
                            const std::string& fragPath) {
-    auto shader = std::make_shared<Shader>(vertPath.c_str(), fragPath.c_str());
-    shaders[name] = shader;
-    std::cout << "✓ Loaded shader: " << name << "\n";
+    return Load(name, vertPath, fragPath, {});
+}
+
+bool ShaderLoader::Preprocess(const std::string& vertPath, const std::string& fragPath, Sources& sources) {
+    ENGINE_PROFILE_SCOPE("ShaderLoader::Preprocess");
+    const bool vertexOk = ShaderPreprocessor::Process(vertPath, {}, sources.vertex);
+    const bool fragmentOk = ShaderPreprocessor::Process(fragPath, {}, sources.fragment);
+    return vertexOk && fragmentOk;
+}
+
+Shader* ShaderLoader::Load(const std::string& name,
+                           const std::string& vertPath,
+                           const std::string& fragPath,
+                           const std::vector<std::string>& keywords) {
+    Sources sources;
+    if (!Preprocess(vertPath, fragPath, sources)) {
+        std::cerr << "Shader " << name << " could not be read\n";
+        return nullptr;
+    }
+    return Load(name, vertPath, fragPath, keywords, sources);
+}
+
+Shader* ShaderLoader::Load(const std::string& name,
+                           const std::string& vertPath,
+                           const std::string& fragPath,
+                           const std::vector<std::string>& keywords,
+                           const Sources& sources) {
+    ENGINE_PROFILE_SCOPE("ShaderLoader::Load");
+
+    if (keywords.size() > MaxKeywords) {
+        std::cerr << "Shader " << name << " declares " << keywords.size()
+                  << " keywords (max " << MaxKeywords << ")\n";
+        return nullptr;
+    }
+
+    uint64_t contentKey = HashString(sources.vertex);
+    contentKey = HashString(sources.fragment, contentKey);
+    for (const auto& keyword : keywords) {
+        contentKey = HashString(keyword, contentKey);
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+
+        // Reloading unchanged sources keeps the program (and its variants)
+        auto it = shaders.find(name);
+        if (it != shaders.end() && it->second->contentKey == contentKey) {
+            return it->second->variants[0].get();
+        }
+
+        // Identical sources under another name: alias that entry
+        auto contentIt = shadersByContent.find(contentKey);
+        if (contentIt != shadersByContent.end()) {
+            if (std::shared_ptr<ShaderEntry> existing = contentIt->second.lock()) {
+                shaders[name] = existing;
+                std::cout << "✓ Shared shader: " << name << "\n";
+                return existing->variants[0].get();
+            }
+        }
+    }
+
+    auto entry = std::make_shared<ShaderEntry>();
+    entry->vertPath = vertPath;
+    entry->fragPath = fragPath;
+    entry->keywords = keywords;
+    entry->contentKey = contentKey;
+
+    std::shared_ptr<Shader> shader = Shader::FromSource(sources.vertex, sources.fragment);
+    entry->variants[0] = shader;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        shaders[name] = entry;
+        shadersByContent[contentKey] = entry;
+    }
+
+    // Compile/link status is checked on first use (see Shader)
+    std::cout << "✓ Submitted shader: " << name;
+    if (!keywords.empty()) std::cout << " (" << keywords.size() << " keywords)";
+    std::cout << "\n";
     return shader.get();  // Return raw pointer for compatibility
 }
 
 Shader* ShaderLoader::Get(const std::string& name) {
+    return GetVariant(name, 0);
+}
+
+uint32_t ShaderLoader::GetKeywordBit(const std::string& name, const std::string& keyword) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     auto it = shaders.find(name);
-    if (it != shaders.end()) {
-        return it->second.get();
+    if (it == shaders.end()) return 0;
+
+    const auto& keywords = it->second->keywords;
+    for (size_t i = 0; i < keywords.size(); ++i) {
+        if (keywords[i] == keyword) return 1u << i;
+    }
+    return 0;
+}
+
+Shader* ShaderLoader::GetVariant(const std::string& name, uint32_t featureMask) {
+    std::vector<std::string> defines;
+    std::string vertPath;
+    std::string fragPath;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        auto it = shaders.find(name);
+        if (it == shaders.end()) {
+            return nullptr;
+        }
+        const ShaderEntry& entry = *it->second;
+
+        // Drop bits for keywords the shader never declared
+        const size_t keywordCount = entry.keywords.size();
+        if (keywordCount < MaxKeywords) {
+            featureMask &= (1u << keywordCount) - 1u;
+        }
+
+        auto variant = entry.variants.find(featureMask);
+        if (variant != entry.variants.end()) {
+            return variant->second.get();
+        }
+
+        for (size_t i = 0; i < keywordCount; ++i) {
+            if (featureMask & (1u << i)) defines.push_back(entry.keywords[i]);
+        }
+        vertPath = entry.vertPath;
+        fragPath = entry.fragPath;
+    }
+
+    ENGINE_PROFILE_SCOPE("ShaderLoader::GetVariant");
+    auto shader = std::make_shared<Shader>(vertPath.c_str(), fragPath.c_str(), defines);
+    {
+        // Another caller may have built the same variant meanwhile; keep the first
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto it = shaders.find(name);
+        if (it == shaders.end()) return nullptr;  // Cleared meanwhile
+        auto inserted = it->second->variants.emplace(featureMask, shader);
+        if (!inserted.second) return inserted.first->second.get();
+    }
+
+    std::cout << "✓ Submitted shader variant: " << name;
+    for (const auto& define : defines) std::cout << " " << define;
+    std::cout << "\n";
+    return shader.get();
+}
+
+void ShaderLoader::ResolvePending() {
+    ENGINE_PROFILE_SCOPE("ShaderLoader::ResolvePending");
+
+    // Collected first: resolving must not hold the lock GetVariant takes
+    std::vector<std::shared_ptr<Shader>> programs;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        for (const auto& [name, entry] : shaders) {
+            for (const auto& [mask, shader] : entry->variants) programs.push_back(shader);
+        }
+    }
+
+    for (const auto& shader : programs) {
+        shader->Resolve();
     }
-    return nullptr;
 }
 
 void ShaderLoader::Clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    shadersByContent.clear();
     shaders.clear();   // shared_ptr counts drop to 0 -> ~Shader() deletes GL program
 }
 
-}
\ No newline at end of file
+}
@@ -1,5 +1,12 @@
 #include "Engine/Assets/Loaders/Texture/TextureLoader.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include "Engine/Assets/Residency/ResidencyManager.hpp"
+#include "Engine/Assets/Cache/AssetCache.hpp"
+#include <algorithm>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 
 namespace engine {
 
@@ -8,32 +15,79 @@ TextureLoader& TextureLoader::Instance() {
     return instance;
 }
 
+TextureLoader::TextureLoader() {
+    // Construct the ResidencyManager first so it outlives our textures
+    ResidencyManager::Instance();
+}
+
 TextureLoader::~TextureLoader() {
     Clear();
 }
 
-Texture* TextureLoader::Load(const std::string& name, const std::string& path) {
-    auto it = textures.find(name);
-    if (it != textures.end()) {
-        return it->second;
+Texture* TextureLoader::Load(const std::string& name, const std::string& path, uint64_t contentKey) {
+    ENGINE_PROFILE_SCOPE("TextureLoader::Load");
+
+    if (Texture* existing = Get(name)) {
+        return existing;
     }
     
-    Texture* texture = new Texture();
-    texture->LoadFromFile(path);
-    
-    // FIX: Add validation to ensure texture was loaded
-    // Check if file was found by verifying texture ID is valid
-    if (texture->GetID() == 0) {
+    // Missing files fail here; decode errors surface later as LoadState::Failed
+    if (!std::ifstream(path, std::ios::binary)) {
         std::cerr << "ERROR:  Texture '" << name << "' failed to load from:  " << path << "\n";
-        delete texture;
         return nullptr;
     }
+
+    // Same bytes under another name or path: share that texture. Hashing the
+    // file here would stall the GL thread, so only a known key is looked up.
+    if (!contentKey) {
+        contentKey = AssetCache::Instance().FindKey(AssetCache::AssetType::Texture, path);
+    }
+    if (contentKey) {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto it = texturesByContent.find(contentKey);
+        if (it == texturesByContent.end() && !unkeyed.empty()) {
+            keyDecodedLocked();
+            it = texturesByContent.find(contentKey);
+        }
+        if (it != texturesByContent.end()) {
+            return textures.emplace(name, it->second).first->second;
+        }
+    }
+
+    // Returns at once with a placeholder; TextureStreamer swaps the image in
+    auto texture = std::make_unique<Texture>();
+    texture->LoadFromFileAsync(path);
     
-    textures[name] = texture;
-    return texture;
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    auto inserted = textures.emplace(name, texture.get());
+    if (!inserted.second) {
+        // Loaded under the same name meanwhile; keep the first
+        return inserted.first->second;
+    }
+    if (contentKey) {
+        texturesByContent.emplace(contentKey, texture.get());
+    } else {
+        unkeyed.emplace(texture.get(), path);
+    }
+    return owned.emplace_back(std::move(texture)).get();
+}
+
+void TextureLoader::keyDecodedLocked() {
+    // The decode hashes the file, after which its key is a stat away
+    auto& cache = AssetCache::Instance();
+    for (auto it = unkeyed.begin(); it != unkeyed.end();) {
+        const uint64_t key = cache.FindKey(AssetCache::AssetType::Texture, it->second);
+        if (key == 0) {
+            ++it;
+            continue;
+        }
+        texturesByContent.emplace(key, it->first);
+        it = unkeyed.erase(it);
+    }
 }
 
 Texture* TextureLoader::Get(const std::string& name) {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     auto it = textures.find(name);
     if (it != textures.end()) {
         return it->second;
@@ -41,11 +95,37 @@ Texture* TextureLoader::Get(const std::string& name) {
     return nullptr;
 }
 
-void TextureLoader::Clear() {
-    for (auto& pair : textures) {
-        delete pair.second;
+void TextureLoader::Unload(const std::string& name) {
+    std::unique_ptr<Texture> doomed;
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        auto it = textures.find(name);
+        if (it == textures.end()) return;
+        Texture* texture = it->second;
+        textures.erase(it);
+
+        for (const auto& [otherName, other] : textures) {
+            if (other == texture) return;  // Still loaded under another name
+        }
+        for (auto c = texturesByContent.begin(); c != texturesByContent.end();) {
+            c = c->second == texture ? texturesByContent.erase(c) : std::next(c);
+        }
+        unkeyed.erase(texture);
+
+        auto owner = std::find_if(owned.begin(), owned.end(),
+                                  [texture](const std::unique_ptr<Texture>& t) { return t.get() == texture; });
+        doomed = std::move(*owner);
+        owned.erase(owner);
     }
+    // The GL object (and any pending decode) is released outside the lock
+}
+
+void TextureLoader::Clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex);
     textures.clear();
+    texturesByContent.clear();
+    unkeyed.clear();
+    owned.clear();
 }
 
 }
\ No newline at end of file
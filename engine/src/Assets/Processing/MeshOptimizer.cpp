@@ -0,0 +1,421 @@
+#include "Engine/Assets/Processing/MeshOptimizer.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include "Engine/Core/Utility/Hash.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <ostream>
+#include <unordered_map>
+
+namespace engine {
+
+namespace {
+
+static_assert(sizeof(Vertex) == 8 * sizeof(float), "Vertex must stay tightly packed for welding");
+
+struct VertexBitsHash {
+    size_t operator()(const Vertex& v) const {
+        return static_cast<size_t>(HashBytes(&v, sizeof(Vertex)));
+    }
+};
+
+struct VertexBitsEqual {
+    bool operator()(const Vertex& a, const Vertex& b) const {
+        return std::memcmp(&a, &b, sizeof(Vertex)) == 0;
+    }
+};
+
+// ---- Forsyth scoring ----
+constexpr int kCacheSize = 32;
+constexpr float kCacheDecayPower = 1.5f;
+constexpr float kLastTriScore = 0.75f;
+constexpr float kValenceBoostScale = 2.0f;
+constexpr float kValenceBoostPower = 0.5f;
+
+float vertexScore(int cachePosition, uint32_t remainingValence) {
+    if (remainingValence == 0) return -1.0f;  // No triangles left to help
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // Used by the last triangle: fixed score so it isn't favoured too much
+            score = kLastTriScore;
+        } else {
+            const float scaler = 1.0f / (kCacheSize - 3);
+            score = std::pow(1.0f - (cachePosition - 3) * scaler, kCacheDecayPower);
+        }
+    }
+
+    // Favour finishing off vertices with few triangles left
+    score += kValenceBoostScale * std::pow(static_cast<float>(remainingValence), -kValenceBoostPower);
+    return score;
+}
+
+// Overdraw clusters shorter than this aren't worth splitting
+constexpr size_t kMinClusterTriangles = 64;
+
+} // namespace
+
+// ============================================================
+// Report
+// ============================================================
+
+float MeshOptimizer::Report::AcmrBefore() const {
+    return triangles ? static_cast<float>(transformsBefore) / triangles : 0.0f;
+}
+
+float MeshOptimizer::Report::AcmrAfter() const {
+    return triangles ? static_cast<float>(transformsAfter) / triangles : 0.0f;
+}
+
+float MeshOptimizer::Report::AtvrBefore() const {
+    return verticesBefore ? static_cast<float>(transformsBefore) / verticesBefore : 0.0f;
+}
+
+float MeshOptimizer::Report::AtvrAfter() const {
+    return verticesAfter ? static_cast<float>(transformsAfter) / verticesAfter : 0.0f;
+}
+
+MeshOptimizer::Report& MeshOptimizer::Report::operator+=(const Report& other) {
+    meshes += other.meshes;
+    triangles += other.triangles;
+    verticesBefore += other.verticesBefore;
+    verticesAfter += other.verticesAfter;
+    transformsBefore += other.transformsBefore;
+    transformsAfter += other.transformsAfter;
+    return *this;
+}
+
+void MeshOptimizer::Report::Print(std::ostream& out) const {
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+
+    out << std::fixed << std::setprecision(3)
+        << meshes << " meshes, " << triangles << " tris"
+        << " | vertices " << verticesBefore << " -> " << verticesAfter
+        << " | ACMR " << AcmrBefore() << " -> " << AcmrAfter()
+        << " | ATVR " << AtvrBefore() << " -> " << AtvrAfter() << "\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+// ============================================================
+// Pipeline
+// ============================================================
+
+MeshOptimizer::Options& MeshOptimizer::Settings() {
+    static Options options;
+    return options;
+}
+
+MeshOptimizer::Report MeshOptimizer::Optimize(std::vector<Vertex>& vertices,
+                                              std::vector<unsigned int>& indices,
+                                              const Options& options) {
+    ENGINE_PROFILE_SCOPE("MeshOptimizer::Optimize");
+
+    Report report;
+    report.meshes = 1;
+    report.triangles = indices.size() / 3;
+    report.verticesBefore = vertices.size();
+    report.transformsBefore = SimulateTransforms(indices, vertices.size(), options.fifoCacheSize);
+
+    if (options.enabled) {
+        if (options.weld) {
+            WeldVertices(vertices, indices);
+        }
+        if (options.vertexCache) {
+            OptimizeVertexCache(indices, vertices.size());
+        }
+        if (options.overdraw) {
+            OptimizeOverdraw(indices, vertices, options.overdrawThreshold);
+        }
+        if (options.vertexFetch) {
+            OptimizeVertexFetch(vertices, indices);
+        }
+    }
+
+    report.verticesAfter = vertices.size();
+    report.transformsAfter = SimulateTransforms(indices, vertices.size(), options.fifoCacheSize);
+    return report;
+}
+
+// ============================================================
+// Passes
+// ============================================================
+
+size_t MeshOptimizer::WeldVertices(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices) {
+    std::unordered_map<Vertex, unsigned int, VertexBitsHash, VertexBitsEqual> unique;
+    unique.reserve(vertices.size());
+
+    std::vector<Vertex> welded;
+    welded.reserve(vertices.size());
+    std::vector<unsigned int> remap(vertices.size());
+
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        auto [it, inserted] = unique.emplace(vertices[i], static_cast<unsigned int>(welded.size()));
+        if (inserted) {
+            welded.push_back(vertices[i]);
+        }
+        remap[i] = it->second;
+    }
+
+    for (auto& index : indices) {
+        index = remap[index];
+    }
+
+    vertices.swap(welded);
+    return vertices.size();
+}
+
+void MeshOptimizer::OptimizeVertexCache(std::vector<unsigned int>& indices, size_t vertexCount) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) return;
+
+    // Vertex -> triangle adjacency (CSR); the first `remaining[v]` entries stay live
+    std::vector<uint32_t> remaining(vertexCount, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i) remaining[indices[i]]++;
+
+    std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+    for (size_t v = 0; v < vertexCount; ++v) adjacencyOffset[v + 1] = adjacencyOffset[v] + remaining[v];
+
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    {
+        std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            for (int k = 0; k < 3; ++k) {
+                adjacency[fill[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+            }
+        }
+    }
+
+    std::vector<int> cachePosition(vertexCount, -1);
+    std::vector<float> vScore(vertexCount);
+    for (size_t v = 0; v < vertexCount; ++v) vScore[v] = vertexScore(-1, remaining[v]);
+
+    std::vector<float> tScore(triangleCount);
+    std::vector<char> emitted(triangleCount, 0);
+    int best = -1;
+    float bestScore = -1.0f;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        tScore[t] = vScore[indices[t * 3]] + vScore[indices[t * 3 + 1]] + vScore[indices[t * 3 + 2]];
+        if (tScore[t] > bestScore) {
+            bestScore = tScore[t];
+            best = static_cast<int>(t);
+        }
+    }
+
+    std::vector<unsigned int> output;
+    output.reserve(triangleCount * 3);
+
+    uint32_t cache[kCacheSize + 3];
+    int cacheCount = 0;
+    size_t cursor = 0;  // Dead-end fallback: next unemitted triangle in input order
+
+    while (output.size() < triangleCount * 3) {
+        if (best < 0) {
+            while (cursor < triangleCount && emitted[cursor]) ++cursor;
+            if (cursor == triangleCount) break;
+            best = static_cast<int>(cursor);
+        }
+
+        const uint32_t tri = static_cast<uint32_t>(best);
+        emitted[tri] = 1;
+
+        uint32_t newCache[kCacheSize + 3];
+        int newCount = 0;
+
+        for (int k = 0; k < 3; ++k) {
+            const uint32_t v = indices[tri * 3 + k];
+            output.push_back(v);
+            newCache[newCount++] = v;
+
+            // Drop the triangle from the vertex's live adjacency
+            uint32_t* begin = &adjacency[adjacencyOffset[v]];
+            uint32_t* end = begin + remaining[v];
+            uint32_t* found = std::find(begin, end, tri);
+            if (found != end) {
+                std::swap(*found, *(end - 1));
+                remaining[v]--;
+            }
+        }
+
+        // LRU: this triangle's vertices move to the front
+        for (int i = 0; i < cacheCount; ++i) {
+            const uint32_t v = cache[i];
+            if (v != newCache[0] && v != newCache[1] && v != newCache[2]) {
+                newCache[newCount++] = v;
+            }
+        }
+
+        // Rescore everything that was or is in the cache
+        for (int i = 0; i < newCount; ++i) {
+            const uint32_t v = newCache[i];
+            cachePosition[v] = i < kCacheSize ? i : -1;
+
+            const float score = vertexScore(cachePosition[v], remaining[v]);
+            const float delta = score - vScore[v];
+            vScore[v] = score;
+
+            if (delta != 0.0f) {
+                for (uint32_t a = 0; a < remaining[v]; ++a) {
+                    tScore[adjacency[adjacencyOffset[v] + a]] += delta;
+                }
+            }
+        }
+
+        cacheCount = std::min(newCount, kCacheSize);
+        for (int i = 0; i < cacheCount; ++i) cache[i] = newCache[i];
+
+        // Next triangle: best live triangle touching the cache
+        best = -1;
+        bestScore = -1.0f;
+        for (int i = 0; i < cacheCount; ++i) {
+            const uint32_t v = cache[i];
+            for (uint32_t a = 0; a < remaining[v]; ++a) {
+                const uint32_t t = adjacency[adjacencyOffset[v] + a];
+                if (tScore[t] > bestScore) {
+                    bestScore = tScore[t];
+                    best = static_cast<int>(t);
+                }
+            }
+        }
+    }
+
+    // Preserve any trailing non-triangle indices untouched
+    std::copy(output.begin(), output.end(), indices.begin());
+}
+
+bool MeshOptimizer::OptimizeOverdraw(std::vector<unsigned int>& indices,
+                                     const std::vector<Vertex>& vertices,
+                                     float threshold) {
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount < kMinClusterTriangles * 2) return false;
+
+    // Clusters start where the cache order goes fully cold (3 misses in a
+    // row), so reordering them barely disturbs cache locality
+    std::vector<size_t> clusterStart;
+    {
+        const unsigned int cacheSize = 16;
+        std::vector<uint32_t> timestamp(vertices.size(), 0);
+        uint32_t time = cacheSize + 1;
+
+        for (size_t t = 0; t < triangleCount; ++t) {
+            int misses = 0;
+            for (int k = 0; k < 3; ++k) {
+                const unsigned int v = indices[t * 3 + k];
+                if (time - timestamp[v] > cacheSize) {
+                    timestamp[v] = time++;
+                    misses++;
+                }
+            }
+
+            const size_t lastStart = clusterStart.empty() ? 0 : clusterStart.back();
+            if (t == 0 || (misses == 3 && t - lastStart >= kMinClusterTriangles)) {
+                clusterStart.push_back(t);
+            }
+        }
+    }
+    if (clusterStart.size() < 2) return false;
+    clusterStart.push_back(triangleCount);
+
+    // Mesh centroid (area-weighted)
+    glm::vec3 meshCentroid(0.0f);
+    float meshArea = 0.0f;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        const glm::vec3& a = vertices[indices[t * 3]].Position;
+        const glm::vec3& b = vertices[indices[t * 3 + 1]].Position;
+        const glm::vec3& c = vertices[indices[t * 3 + 2]].Position;
+        const float area = glm::length(glm::cross(b - a, c - a));
+        meshCentroid += (a + b + c) * (area / 3.0f);
+        meshArea += area;
+    }
+    if (meshArea > 0.0f) meshCentroid /= meshArea;
+
+    // Outward-facing clusters are likely occluders: draw them first
+    struct Cluster { size_t begin, end; float sortKey; };
+    std::vector<Cluster> clusters;
+    clusters.reserve(clusterStart.size() - 1);
+
+    for (size_t c = 0; c + 1 < clusterStart.size(); ++c) {
+        glm::vec3 centroid(0.0f), normal(0.0f);
+        float area = 0.0f;
+        for (size_t t = clusterStart[c]; t < clusterStart[c + 1]; ++t) {
+            const glm::vec3& a = vertices[indices[t * 3]].Position;
+            const glm::vec3& b = vertices[indices[t * 3 + 1]].Position;
+            const glm::vec3& d = vertices[indices[t * 3 + 2]].Position;
+            const glm::vec3 n = glm::cross(b - a, d - a);  // Length = 2 * area
+            const float triArea = glm::length(n);
+            centroid += (a + b + d) * (triArea / 3.0f);
+            normal += n;
+            area += triArea;
+        }
+        if (area > 0.0f) centroid /= area;
+        const float normalLength = glm::length(normal);
+        if (normalLength > 0.0f) normal /= normalLength;
+
+        clusters.push_back({clusterStart[c], clusterStart[c + 1], glm::dot(centroid - meshCentroid, normal)});
+    }
+
+    std::stable_sort(clusters.begin(), clusters.end(),
+                     [](const Cluster& a, const Cluster& b) { return a.sortKey > b.sortKey; });
+
+    std::vector<unsigned int> reordered;
+    reordered.reserve(indices.size());
+    for (const Cluster& cluster : clusters) {
+        reordered.insert(reordered.end(), indices.begin() + cluster.begin * 3, indices.begin() + cluster.end * 3);
+    }
+    reordered.insert(reordered.end(), indices.begin() + triangleCount * 3, indices.end());
+
+    // Keep the new order only if it doesn't cost too much vertex reuse
+    const size_t before = SimulateTransforms(indices, vertices.size(), 16);
+    const size_t after = SimulateTransforms(reordered, vertices.size(), 16);
+    if (static_cast<float>(after) > static_cast<float>(before) * threshold) {
+        return false;
+    }
+
+    indices.swap(reordered);
+    return true;
+}
+
+size_t MeshOptimizer::OptimizeVertexFetch(std::vector<Vertex>& vertices, std::vector<unsigned int>& indices) {
+    const unsigned int unused = ~0u;
+    std::vector<unsigned int> remap(vertices.size(), unused);
+
+    std::vector<Vertex> reordered;
+    reordered.reserve(vertices.size());
+
+    // First-use order; unreferenced vertices are dropped
+    for (auto& index : indices) {
+        if (remap[index] == unused) {
+            remap[index] = static_cast<unsigned int>(reordered.size());
+            reordered.push_back(vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    vertices.swap(reordered);
+    return vertices.size();
+}
+
+size_t MeshOptimizer::SimulateTransforms(const std::vector<unsigned int>& indices,
+                                         size_t vertexCount,
+                                         unsigned int cacheSize) {
+    // FIFO via timestamps: a vertex is cached if fewer than cacheSize
+    // misses happened since it was last loaded
+    std::vector<uint32_t> timestamp(vertexCount, 0);
+    uint32_t time = cacheSize + 1;
+    size_t misses = 0;
+
+    for (unsigned int v : indices) {
+        if (time - timestamp[v] > cacheSize) {
+            timestamp[v] = time++;
+            misses++;
+        }
+    }
+    return misses;
+}
+
+} // namespace engine
@@ -0,0 +1,201 @@
+#include "Engine/Assets/Processing/MeshletBuilder.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace engine {
+
+namespace {
+
+// Normal cones wider than this (min dot to the axis) are not worth testing
+constexpr float kMinConeDot = 0.1f;
+
+glm::vec3 triangleCentroid(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices, size_t t) {
+    return (vertices[indices[t * 3]].Position +
+            vertices[indices[t * 3 + 1]].Position +
+            vertices[indices[t * 3 + 2]].Position) / 3.0f;
+}
+
+} // namespace
+
+std::vector<Meshlet> MeshletBuilder::Build(const std::vector<Vertex>& vertices,
+                                           std::vector<unsigned int>& indices,
+                                           size_t maxTriangles,
+                                           size_t maxVertices) {
+    ENGINE_PROFILE_SCOPE("MeshletBuilder::Build");
+
+    std::vector<Meshlet> meshlets;
+    const size_t triangleCount = indices.size() / 3;
+    const size_t vertexCount = vertices.size();
+    if (triangleCount == 0) return meshlets;
+
+    // Vertex -> triangle adjacency (CSR)
+    std::vector<uint32_t> adjacencyOffset(vertexCount + 1, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i) adjacencyOffset[indices[i] + 1]++;
+    for (size_t v = 0; v < vertexCount; ++v) adjacencyOffset[v + 1] += adjacencyOffset[v];
+
+    std::vector<uint32_t> adjacency(triangleCount * 3);
+    {
+        std::vector<uint32_t> fill(adjacencyOffset.begin(), adjacencyOffset.end() - 1);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            for (int k = 0; k < 3; ++k) {
+                adjacency[fill[indices[t * 3 + k]]++] = static_cast<uint32_t>(t);
+            }
+        }
+    }
+
+    // Per-cluster stamps avoid clearing sets between clusters
+    const uint32_t none = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> vertexStamp(vertexCount, none);
+    std::vector<uint32_t> candidateStamp(triangleCount, none);
+    std::vector<char> assigned(triangleCount, 0);
+
+    std::vector<unsigned int> output;
+    output.reserve(indices.size());
+
+    std::vector<uint32_t> clusterTriangles;
+    std::vector<uint32_t> candidates;
+    size_t cursor = 0;
+    uint32_t clusterId = 0;
+
+    while (true) {
+        while (cursor < triangleCount && assigned[cursor]) ++cursor;
+        if (cursor == triangleCount) break;
+
+        clusterTriangles.clear();
+        candidates.clear();
+        size_t clusterVertices = 0;
+        const glm::vec3 seedCentroid = triangleCentroid(vertices, indices, cursor);
+
+        auto addTriangle = [&](uint32_t t) {
+            assigned[t] = 1;
+            clusterTriangles.push_back(t);
+            for (int k = 0; k < 3; ++k) {
+                const unsigned int v = indices[t * 3 + k];
+                if (vertexStamp[v] == clusterId) continue;
+                vertexStamp[v] = clusterId;
+                clusterVertices++;
+
+                // Neighbours through this vertex become candidates
+                for (uint32_t a = adjacencyOffset[v]; a < adjacencyOffset[v + 1]; ++a) {
+                    const uint32_t n = adjacency[a];
+                    if (!assigned[n] && candidateStamp[n] != clusterId) {
+                        candidateStamp[n] = clusterId;
+                        candidates.push_back(n);
+                    }
+                }
+            }
+        };
+
+        addTriangle(static_cast<uint32_t>(cursor));
+
+        while (clusterTriangles.size() < maxTriangles) {
+            // Fewest new vertices first, then closest to the seed
+            size_t bestSlot = candidates.size();
+            int bestNew = 4;
+            float bestDistance = std::numeric_limits<float>::max();
+
+            for (size_t c = 0; c < candidates.size(); ++c) {
+                const uint32_t t = candidates[c];
+                if (assigned[t]) continue;
+
+                int newVertices = 0;
+                for (int k = 0; k < 3; ++k) {
+                    if (vertexStamp[indices[t * 3 + k]] != clusterId) newVertices++;
+                }
+                if (clusterVertices + newVertices > maxVertices) continue;
+
+                const glm::vec3 d = triangleCentroid(vertices, indices, t) - seedCentroid;
+                const float distance = glm::dot(d, d);
+                if (newVertices < bestNew || (newVertices == bestNew && distance < bestDistance)) {
+                    bestNew = newVertices;
+                    bestDistance = distance;
+                    bestSlot = c;
+                }
+            }
+
+            if (bestSlot == candidates.size()) break;  // Full or no connected neighbours left
+
+            const uint32_t chosen = candidates[bestSlot];
+            candidates[bestSlot] = candidates.back();
+            candidates.pop_back();
+            addTriangle(chosen);
+        }
+
+        // Keep the incoming (cache-optimized) order inside the cluster
+        std::sort(clusterTriangles.begin(), clusterTriangles.end());
+
+        Meshlet meshlet;
+        meshlet.firstIndex = static_cast<uint32_t>(output.size());
+        meshlet.indexCount = static_cast<uint32_t>(clusterTriangles.size() * 3);
+        for (uint32_t t : clusterTriangles) {
+            output.push_back(indices[t * 3]);
+            output.push_back(indices[t * 3 + 1]);
+            output.push_back(indices[t * 3 + 2]);
+        }
+        meshlets.push_back(meshlet);
+        clusterId++;
+    }
+
+    std::copy(output.begin(), output.end(), indices.begin());
+
+    for (auto& meshlet : meshlets) {
+        ComputeBounds(vertices, indices, meshlet);
+    }
+    return meshlets;
+}
+
+void MeshletBuilder::ComputeBounds(const std::vector<Vertex>& vertices,
+                                   const std::vector<unsigned int>& indices,
+                                   Meshlet& meshlet) {
+    const size_t first = meshlet.firstIndex;
+    const size_t end = first + meshlet.indexCount;
+    if (first >= end) return;
+
+    // Sphere around the AABB
+    glm::vec3 boundsMin = vertices[indices[first]].Position;
+    glm::vec3 boundsMax = boundsMin;
+    for (size_t i = first; i < end; ++i) {
+        boundsMin = glm::min(boundsMin, vertices[indices[i]].Position);
+        boundsMax = glm::max(boundsMax, vertices[indices[i]].Position);
+    }
+    meshlet.center = (boundsMin + boundsMax) * 0.5f;
+
+    float radiusSq = 0.0f;
+    for (size_t i = first; i < end; ++i) {
+        const glm::vec3 d = vertices[indices[i]].Position - meshlet.center;
+        radiusSq = std::max(radiusSq, glm::dot(d, d));
+    }
+    meshlet.radius = std::sqrt(radiusSq);
+
+    // Normal cone from face normals (CCW winding = front face)
+    glm::vec3 axis(0.0f);
+    std::vector<glm::vec3> normals;
+    normals.reserve(meshlet.indexCount / 3);
+    for (size_t i = first; i + 2 < end; i += 3) {
+        const glm::vec3& a = vertices[indices[i]].Position;
+        const glm::vec3& b = vertices[indices[i + 1]].Position;
+        const glm::vec3& c = vertices[indices[i + 2]].Position;
+        const glm::vec3 n = glm::cross(b - a, c - a);
+        const float length = glm::length(n);
+        if (length <= 0.0f) continue;  // Degenerate: no facing to speak of
+        normals.push_back(n / length);
+        axis += normals.back();
+    }
+
+    meshlet.coneCutoff = 1.0f;
+    const float axisLength = glm::length(axis);
+    if (normals.empty() || axisLength <= 0.0f) return;
+    axis /= axisLength;
+
+    float minDot = 1.0f;
+    for (const auto& n : normals) minDot = std::min(minDot, glm::dot(n, axis));
+    if (minDot <= kMinConeDot) return;
+
+    meshlet.coneAxis = axis;
+    meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+}
+
+} // namespace engine
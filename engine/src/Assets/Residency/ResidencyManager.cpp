@@ -0,0 +1,192 @@
+#include "Engine/Assets/Residency/ResidencyManager.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+namespace engine {
+
+namespace {
+
+double toMB(size_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+} // namespace
+
+const char* AssetCategoryName(AssetCategory category) {
+    switch (category) {
+        case AssetCategory::Mesh:    return "Meshes";
+        case AssetCategory::Texture: return "Textures";
+        default:                     return "Unknown";
+    }
+}
+
+// ---- ResidentAsset ----
+
+ResidentAsset::ResidentAsset(AssetCategory category) : m_Category(category) {
+    ResidencyManager::Instance().Register(this);
+}
+
+ResidentAsset::ResidentAsset(ResidentAsset&& other) noexcept
+    : m_Category(other.m_Category),
+      m_Resident(other.m_Resident),
+      m_LastUsedFrame(other.m_LastUsedFrame) {
+    // Take over the registration; the moved-from object no longer counts
+    ResidencyManager& manager = ResidencyManager::Instance();
+    manager.Unregister(&other);
+    manager.Register(this);
+    other.m_Resident = false;
+}
+
+ResidentAsset::~ResidentAsset() {
+    ResidencyManager::Instance().Unregister(this);
+}
+
+bool ResidentAsset::MarkUsed() {
+    ResidencyManager& manager = ResidencyManager::Instance();
+    m_LastUsedFrame = manager.GetFrame();
+    if (!m_Resident) {
+        manager.Restore(this);
+    }
+    return m_Resident;
+}
+
+// ---- ResidencyManager ----
+
+ResidencyManager& ResidencyManager::Instance() {
+    static ResidencyManager instance;
+    return instance;
+}
+
+void ResidencyManager::Register(ResidentAsset* asset) {
+    asset->m_Slot = assets.size();
+    assets.push_back(asset);
+}
+
+void ResidencyManager::Unregister(ResidentAsset* asset) {
+    const size_t slot = asset->m_Slot;
+    if (slot >= assets.size() || assets[slot] != asset) return;  // Already handed over
+
+    assets[slot] = assets.back();
+    assets[slot]->m_Slot = slot;
+    assets.pop_back();
+}
+
+void ResidencyManager::Restore(ResidentAsset* asset) {
+    ENGINE_PROFILE_SCOPE("ResidencyManager::Restore");
+    if (asset->RestoreGpu()) {
+        asset->m_Resident = true;
+        m_Counters[static_cast<size_t>(asset->m_Category)].restores++;
+    }
+}
+
+void ResidencyManager::EndFrame() {
+    ENGINE_PROFILE_SCOPE("ResidencyManager::EndFrame");
+
+    auto leastRecentlyUsed = [](const ResidentAsset* a, const ResidentAsset* b) {
+        return a->m_LastUsedFrame < b->m_LastUsedFrame;
+    };
+
+    if (m_Budget.gpuBytes > 0) {
+        size_t total = GetTotalGpuBytes();
+        if (total > m_Budget.gpuBytes) {
+            std::vector<ResidentAsset*> candidates;
+            for (ResidentAsset* asset : assets) {
+                if (asset->m_Resident && asset->m_LastUsedFrame < m_Frame && asset->CanEvictGpu()) {
+                    candidates.push_back(asset);
+                }
+            }
+            std::sort(candidates.begin(), candidates.end(), leastRecentlyUsed);
+
+            for (ResidentAsset* asset : candidates) {
+                if (total <= m_Budget.gpuBytes) break;
+                const size_t bytes = asset->GetGpuBytes();
+                asset->EvictGpu();
+                asset->m_Resident = false;
+                total -= std::min(total, bytes);
+                m_Counters[static_cast<size_t>(asset->m_Category)].evictions++;
+            }
+        }
+    }
+
+    if (m_Budget.cpuBytes > 0) {
+        size_t total = GetTotalCpuBytes();
+        if (total > m_Budget.cpuBytes) {
+            std::vector<ResidentAsset*> candidates;
+            for (ResidentAsset* asset : assets) {
+                if (asset->m_LastUsedFrame < m_Frame && asset->GetCpuBytes() > 0) {
+                    candidates.push_back(asset);
+                }
+            }
+            std::sort(candidates.begin(), candidates.end(), leastRecentlyUsed);
+
+            for (ResidentAsset* asset : candidates) {
+                if (total <= m_Budget.cpuBytes) break;
+                const size_t freed = asset->ReleaseCpu();
+                if (freed == 0) continue;  // Pinned or not reloadable
+                total -= std::min(total, freed);
+                m_Counters[static_cast<size_t>(asset->m_Category)].cpuReleases++;
+            }
+        }
+    }
+
+    m_Frame++;
+}
+
+ResidencyManager::CategoryUsage ResidencyManager::GetUsage(AssetCategory category) const {
+    CategoryUsage usage;
+    for (const ResidentAsset* asset : assets) {
+        if (asset->m_Category != category) continue;
+        usage.assets++;
+        if (asset->m_Resident) usage.resident++;
+        usage.gpuBytes += asset->GetGpuBytes();
+        usage.cpuBytes += asset->GetCpuBytes();
+    }
+
+    const Counters& counters = m_Counters[static_cast<size_t>(category)];
+    usage.evictions = counters.evictions;
+    usage.restores = counters.restores;
+    usage.cpuReleases = counters.cpuReleases;
+    return usage;
+}
+
+size_t ResidencyManager::GetTotalGpuBytes() const {
+    size_t total = 0;
+    for (const ResidentAsset* asset : assets) total += asset->GetGpuBytes();
+    return total;
+}
+
+size_t ResidencyManager::GetTotalCpuBytes() const {
+    size_t total = 0;
+    for (const ResidentAsset* asset : assets) total += asset->GetCpuBytes();
+    return total;
+}
+
+void ResidencyManager::PrintReport(std::ostream& out) const {
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+
+    out << "--- Asset Memory ---\n" << std::fixed << std::setprecision(2);
+    for (size_t c = 0; c < static_cast<size_t>(AssetCategory::Count); ++c) {
+        const auto category = static_cast<AssetCategory>(c);
+        const CategoryUsage usage = GetUsage(category);
+        out << "  " << std::left << std::setw(10) << AssetCategoryName(category) << std::right
+            << usage.resident << "/" << usage.assets << " resident, "
+            << "GPU " << toMB(usage.gpuBytes) << " MB, "
+            << "CPU " << toMB(usage.cpuBytes) << " MB "
+            << "(" << usage.evictions << " evicted, " << usage.restores << " restored, "
+            << usage.cpuReleases << " CPU released)\n";
+    }
+
+    out << "  Total     GPU " << toMB(GetTotalGpuBytes()) << " MB";
+    if (m_Budget.gpuBytes > 0) out << " / " << toMB(m_Budget.gpuBytes) << " MB";
+    out << ", CPU " << toMB(GetTotalCpuBytes()) << " MB";
+    if (m_Budget.cpuBytes > 0) out << " / " << toMB(m_Budget.cpuBytes) << " MB";
+    out << "\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+} // namespace engine
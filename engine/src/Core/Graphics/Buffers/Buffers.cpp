@@ -1,6 +1,7 @@
 #include <glad/glad.h>
 #include "Engine/Core/Graphics/Buffers/Buffers.hpp"
 #include "Engine/Core/Graphics/Shader/Shader.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
 
 using namespace engine;
 
@@ -24,6 +25,7 @@ void VBO::Unbind() {
 void VBO::SetData(const void* data, GLsizeiptr size, GLenum usage) {
     glBindBuffer(GL_ARRAY_BUFFER, ID);
     glBufferData(GL_ARRAY_BUFFER, size, data, usage);
+    RenderStats::Current().bytesUploaded += static_cast<uint64_t>(size);
 }
 
 VAO::VAO() {
@@ -36,6 +38,7 @@ VAO::~VAO() {
 
 void VAO::Bind() {
     glBindVertexArray(ID);
+    RenderStats::Current().vaoBinds++;
 }
 
 void VAO::Unbind() {
@@ -90,6 +93,43 @@ void VAO::AddAttribute(const Shader& shader,
     }
 }
 
+void VAO::AddAttribute(const Shader& shader,
+                       const std::string& attribName,
+                       GLint components,
+                       GLenum type,
+                       GLboolean normalized,
+                       GLsizei stride,
+                       std::size_t offset)
+{
+    const Shader::ReflectedAttribs* attr = shader.getAttrib(attribName);
+    if (!attr) {
+        // attribute not found in shader
+        return;
+    }
+
+    glEnableVertexAttribArray(attr->location);
+
+    if (attr->baseType == GL_FLOAT) {
+        // Integer sources are converted (and normalized if asked) by the fetcher
+        glVertexAttribPointer(
+            attr->location,
+            components,
+            type,
+            normalized,
+            stride,
+            reinterpret_cast<const void*>(offset)
+        );
+    } else {
+        glVertexAttribIPointer(
+            attr->location,
+            components,
+            type,
+            stride,
+            reinterpret_cast<const void*>(offset)
+        );
+    }
+}
+
 EBO::EBO() {
     glGenBuffers(1, &ID);
 }
@@ -109,4 +149,5 @@ void EBO::Unbind() {
 void EBO::SetData(const void* data, GLsizeiptr size, GLenum usage) {
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ID);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, usage);
+    RenderStats::Current().bytesUploaded += static_cast<uint64_t>(size);
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "Engine/Core/Graphics/Extensions/GLExtensions.hpp"
+#include <cstring>
+#include <iostream>
+
+namespace engine {
+
+bool GLExtensions::programBinary = false;
+PFNENGINEGETPROGRAMBINARYPROC GLExtensions::GetProgramBinary = nullptr;
+PFNENGINEPROGRAMBINARYPROC GLExtensions::ProgramBinary = nullptr;
+PFNENGINEPROGRAMPARAMETERIPROC GLExtensions::ProgramParameteri = nullptr;
+bool GLExtensions::parallelShaderCompile = false;
+PFNENGINEMAXSHADERCOMPILERTHREADSPROC GLExtensions::MaxShaderCompilerThreads = nullptr;
+
+bool GLExtensions::HasExtension(const char* name) {
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; ++i) {
+        const char* ext = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (ext && std::strcmp(ext, name) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void GLExtensions::Load(GLADloadproc loader) {
+    const bool core41 = GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 1);
+
+    // ---- Program binaries ----
+    if (core41 || HasExtension("GL_ARB_get_program_binary")) {
+        GetProgramBinary  = reinterpret_cast<PFNENGINEGETPROGRAMBINARYPROC>(loader("glGetProgramBinary"));
+        ProgramBinary     = reinterpret_cast<PFNENGINEPROGRAMBINARYPROC>(loader("glProgramBinary"));
+        ProgramParameteri = reinterpret_cast<PFNENGINEPROGRAMPARAMETERIPROC>(loader("glProgramParameteri"));
+
+        // Some drivers expose the entry points but accept zero binary formats
+        GLint formats = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+        programBinary = GetProgramBinary && ProgramBinary && ProgramParameteri && formats > 0;
+    }
+
+    // ---- Parallel shader compile ----
+    if (HasExtension("GL_KHR_parallel_shader_compile")) {
+        MaxShaderCompilerThreads = reinterpret_cast<PFNENGINEMAXSHADERCOMPILERTHREADSPROC>(
+            loader("glMaxShaderCompilerThreadsKHR"));
+    } else if (HasExtension("GL_ARB_parallel_shader_compile")) {
+        MaxShaderCompilerThreads = reinterpret_cast<PFNENGINEMAXSHADERCOMPILERTHREADSPROC>(
+            loader("glMaxShaderCompilerThreadsARB"));
+    }
+    parallelShaderCompile = MaxShaderCompilerThreads != nullptr;
+    if (parallelShaderCompile) {
+        // 0xFFFFFFFF = let the driver pick its own thread count
+        MaxShaderCompilerThreads(0xFFFFFFFFu);
+    }
+
+    std::cout << "GL extensions: program binary " << (programBinary ? "yes" : "no")
+              << ", parallel shader compile " << (parallelShaderCompile ? "yes" : "no") << "\n";
+}
+
+} // namespace engine
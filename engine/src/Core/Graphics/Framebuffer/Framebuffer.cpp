@@ -0,0 +1,116 @@
+#include "Engine/Core/Graphics/Framebuffer/Framebuffer.hpp"
+#include <iostream>
+
+namespace engine {
+
+Framebuffer::Framebuffer()
+    : ID(0), hasDepth(false), depthTexture(0), width(0), height(0) {
+    glGenFramebuffers(1, &ID);
+}
+
+Framebuffer::~Framebuffer() {
+    releaseStorage();
+    if (ID != 0) {
+        glDeleteFramebuffers(1, &ID);
+        ID = 0;
+    }
+}
+
+void Framebuffer::Bind() {
+    glBindFramebuffer(GL_FRAMEBUFFER, ID);
+}
+
+void Framebuffer::Unbind() {
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+int Framebuffer::AddColorAttachment(GLenum internalFormat, GLenum format, GLenum type) {
+    colorAttachments.push_back({0, internalFormat, format, type});
+    return static_cast<int>(colorAttachments.size()) - 1;
+}
+
+void Framebuffer::EnableDepthAttachment() {
+    hasDepth = true;
+}
+
+void Framebuffer::Resize(int w, int h) {
+    if (w <= 0 || h <= 0) return;
+    if (w == width && h == height) return;  // Nothing to do
+
+    width = w;
+    height = h;
+
+    releaseStorage();
+    allocateStorage();
+
+    if (!IsComplete()) {
+        std::cerr << "ERROR: Framebuffer incomplete after resize to "
+                  << width << "x" << height << "\n";
+    }
+}
+
+bool Framebuffer::IsComplete() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, ID);
+    const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    return status == GL_FRAMEBUFFER_COMPLETE;
+}
+
+void Framebuffer::allocateStorage() {
+    glBindFramebuffer(GL_FRAMEBUFFER, ID);
+
+    std::vector<GLenum> drawBuffers;
+    drawBuffers.reserve(colorAttachments.size());
+
+    for (size_t i = 0; i < colorAttachments.size(); ++i) {
+        ColorAttachment& att = colorAttachments[i];
+
+        glGenTextures(1, &att.texture);
+        glBindTexture(GL_TEXTURE_2D, att.texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, att.internalFormat, width, height, 0,
+                     att.format, att.type, nullptr);
+
+        // Post passes read attachments texel-exact; no filtering, no mips
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        const GLenum attachment = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, att.texture, 0);
+        drawBuffers.push_back(attachment);
+    }
+
+    if (hasDepth) {
+        glGenTextures(1, &depthTexture);
+        glBindTexture(GL_TEXTURE_2D, depthTexture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0,
+                     GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, depthTexture, 0);
+    }
+
+    if (!drawBuffers.empty()) {
+        glDrawBuffers(static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data());
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Framebuffer::releaseStorage() {
+    for (auto& att : colorAttachments) {
+        if (att.texture != 0) {
+            glDeleteTextures(1, &att.texture);
+            att.texture = 0;
+        }
+    }
+    if (depthTexture != 0) {
+        glDeleteTextures(1, &depthTexture);
+        depthTexture = 0;
+    }
+}
+
+} // namespace engine
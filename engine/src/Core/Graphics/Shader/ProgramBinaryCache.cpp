@@ -0,0 +1,167 @@
+#include "Engine/Core/Graphics/Shader/ProgramBinaryCache.hpp"
+#include "Engine/Core/Graphics/Extensions/GLExtensions.hpp"
+#include "Engine/Core/Utility/Hash.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace engine {
+
+namespace {
+
+constexpr uint32_t kMagic = 0x47525045;  // "EPRG"
+constexpr uint32_t kVersion = 1;
+
+struct EntryHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;          // Repeated so a renamed/copied file can't alias
+    uint32_t binaryFormat;
+    uint32_t binaryLength;
+};
+
+std::string glString(GLenum name) {
+    const GLubyte* s = glGetString(name);
+    return s ? reinterpret_cast<const char*>(s) : "";
+}
+
+} // namespace
+
+ProgramBinaryCache& ProgramBinaryCache::Instance() {
+    static ProgramBinaryCache instance;
+    return instance;
+}
+
+bool ProgramBinaryCache::IsActive() const {
+    return m_Enabled && GLExtensions::programBinary;
+}
+
+uint64_t ProgramBinaryCache::computeKey(const std::string& vertexCode, const std::string& fragmentCode) {
+    // Driver identity can't change while the context lives, so hash it once
+    if (!driverHashValid) {
+        driverHash = HashString(glString(GL_VENDOR));
+        driverHash = HashString(glString(GL_RENDERER), driverHash);
+        driverHash = HashString(glString(GL_VERSION), driverHash);
+        driverHashValid = true;
+    }
+
+    uint64_t key = HashString(vertexCode, driverHash);
+    return HashString(fragmentCode, key);
+}
+
+std::string ProgramBinaryCache::entryPath(uint64_t key) const {
+    return (std::filesystem::path(directory) / (HashToHex(key) + ".bin")).string();
+}
+
+GLuint ProgramBinaryCache::TryLoad(const std::string& vertexCode, const std::string& fragmentCode) {
+    if (!IsActive()) return 0;
+
+    const uint64_t key = computeKey(vertexCode, fragmentCode);
+    const std::string path = entryPath(key);
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        stats.misses++;
+        return 0;
+    }
+
+    EntryHeader header{};
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    std::vector<char> binary;
+    bool valid = file && header.magic == kMagic && header.version == kVersion &&
+                 header.key == key && header.binaryLength > 0;
+    if (valid) {
+        binary.resize(header.binaryLength);
+        file.read(binary.data(), binary.size());
+        valid = static_cast<bool>(file);
+    }
+    file.close();
+
+    GLuint program = 0;
+    if (valid) {
+        program = glCreateProgram();
+        GLExtensions::ProgramBinary(program, header.binaryFormat, binary.data(),
+                                    static_cast<GLsizei>(binary.size()));
+
+        // Drivers reject binaries from other builds by failing the link
+        GLint linked = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (!linked) {
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    if (!program) {
+        stats.rejected++;
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return 0;
+    }
+
+    stats.hits++;
+    return program;
+}
+
+void ProgramBinaryCache::PrepareForLink(GLuint program) const {
+    if (!IsActive()) return;
+    GLExtensions::ProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+void ProgramBinaryCache::Store(GLuint program, const std::string& vertexCode, const std::string& fragmentCode) {
+    if (!IsActive()) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    GLsizei written = 0;
+    GLExtensions::GetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) return;
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        std::cerr << "Shader cache: cannot create " << directory << ": " << ec.message() << "\n";
+        return;
+    }
+
+    EntryHeader header{};
+    header.magic = kMagic;
+    header.version = kVersion;
+    header.key = computeKey(vertexCode, fragmentCode);
+    header.binaryFormat = format;
+    header.binaryLength = static_cast<uint32_t>(written);
+
+    // Write to a temp file and rename so a crash never leaves a torn entry
+    const std::string path = entryPath(header.key);
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "Shader cache: cannot write " << tmpPath << "\n";
+            return;
+        }
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), written);
+        if (!file) {
+            file.close();
+            std::filesystem::remove(tmpPath, ec);
+            return;
+        }
+    }
+
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmpPath, ec);
+        return;
+    }
+
+    stats.stored++;
+}
+
+} // namespace engine
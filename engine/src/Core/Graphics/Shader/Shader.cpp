@@ -1,108 +1,195 @@
 #include "Engine/Core/Graphics/Shader/Shader.hpp"
-#include <fstream>
-#include <sstream>
+#include "Engine/Core/Graphics/Shader/ProgramBinaryCache.hpp"
+#include "Engine/Core/Graphics/Shader/ShaderPreprocessor.hpp"
+#include "Engine/Core/Graphics/Extensions/GLExtensions.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
 #include <iostream>
 #include <vector>
 #include <glm/gtc/type_ptr.hpp>
 
 namespace engine {
 
-std::string Shader::readFile(const char* path) {
-    std::ifstream file(path, std::ios::in);
-    if (!file) {
-        std::cerr << "Shader has not been read successfully " << path << "\n";
-        return "";
-    }
-
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    return buffer.str();
-}
-
 unsigned int Shader::compileShader(GLenum type, const std::string& source) {
+    // Submit only - querying GL_COMPILE_STATUS here would wait for the compiler
     unsigned int shader = glCreateShader(type);
     const char* src = source.c_str();
     glShaderSource(shader, 1, &src, nullptr);
     glCompileShader(shader);
+    return shader;
+}
 
+void Shader::printCompileLog(GLuint shader, const char* stage) {
     int success;
     char infoLog[512];
     glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
     if (!success) {
         glGetShaderInfoLog(shader, 512, nullptr, infoLog);
-        std::cerr << "COMPILATION FAILED\n" << infoLog << "\n";
+        std::cerr << stage << " COMPILATION FAILED\n" << infoLog << "\n";
     }
+}
 
+Shader::Shader(const char* vertexPath, const char* fragmentPath)
+    : Shader(vertexPath, fragmentPath, {}) {
+}
+
+Shader::Shader(const char* vertexPath, const char* fragmentPath, const std::vector<std::string>& defines)
+    : ID(0) {
+    std::string vertexCode;
+    std::string fragmentCode;
+    ShaderPreprocessor::Process(vertexPath, defines, vertexCode);
+    ShaderPreprocessor::Process(fragmentPath, defines, fragmentCode);
+
+    build(vertexCode, fragmentCode);
+}
+
+std::unique_ptr<Shader> Shader::FromSource(const std::string& vertexSource,
+                                           const std::string& fragmentSource) {
+    std::unique_ptr<Shader> shader(new Shader());
+    shader->build(vertexSource, fragmentSource);
     return shader;
 }
 
-Shader::Shader(const char* vertexPath, const char* fragmentPath) {
-    std::string vertexCode   = readFile(vertexPath);
-    std::string fragmentCode = readFile(fragmentPath);
+void Shader::build(const std::string& vertexCode, const std::string& fragmentCode) {
+    auto& cache = ProgramBinaryCache::Instance();
+
+    // Warm path: skip compile + link entirely
+    ID = cache.TryLoad(vertexCode, fragmentCode);
+    if (ID != 0) {
+        ReflectAttribs();
+        return;
+    }
 
-    unsigned int vertex   = compileShader(GL_VERTEX_SHADER,   vertexCode);
-    unsigned int fragment = compileShader(GL_FRAGMENT_SHADER, fragmentCode);
+    // Phase 1: hand the work to the driver and return without waiting
+    auto pending = std::make_unique<PendingBuild>();
+    pending->vertex   = compileShader(GL_VERTEX_SHADER,   vertexCode);
+    pending->fragment = compileShader(GL_FRAGMENT_SHADER, fragmentCode);
 
     ID = glCreateProgram();
-    glAttachShader(ID, vertex);
-    glAttachShader(ID, fragment);
+    glAttachShader(ID, pending->vertex);
+    glAttachShader(ID, pending->fragment);
+    cache.PrepareForLink(ID);
     glLinkProgram(ID);
 
+    if (cache.IsActive()) {
+        pending->vertexCode = vertexCode;
+        pending->fragmentCode = fragmentCode;
+    }
+    m_Pending = std::move(pending);
+}
+
+void Shader::resolve() const {
+    // Phase 2: first real use - this is where a still-running compile blocks
+    std::unique_ptr<PendingBuild> pending = std::move(m_Pending);
+
     int success;
     char infoLog[512];
     glGetProgramiv(ID, GL_LINK_STATUS, &success);
     if (!success) {
+        // Per-stage logs are only worth fetching when something went wrong
+        printCompileLog(pending->vertex, "VERTEX");
+        printCompileLog(pending->fragment, "FRAGMENT");
         glGetProgramInfoLog(ID, 512, nullptr, infoLog);
         std::cerr << "ERROR::SHADER::PROGRAM_LINKING_FAILED\n" << infoLog << "\n";
+    } else {
+        ProgramBinaryCache::Instance().Store(ID, pending->vertexCode, pending->fragmentCode);
     }
 
     ReflectAttribs();
 
-    glDeleteShader(vertex);
-    glDeleteShader(fragment);
+    glDeleteShader(pending->vertex);
+    glDeleteShader(pending->fragment);
+}
+
+void Shader::releasePending() {
+    if (!m_Pending) return;
+    glDeleteShader(m_Pending->vertex);
+    glDeleteShader(m_Pending->fragment);
+    m_Pending.reset();
+}
+
+bool Shader::IsReady() const {
+    if (!m_Pending) return true;
+    if (!GLExtensions::parallelShaderCompile) return false;
+
+    GLint done = GL_FALSE;
+    glGetProgramiv(ID, GL_COMPLETION_STATUS_KHR, &done);
+    return done == GL_TRUE;
 }
 
 void Shader::use() const {
+    ensureBuilt();
     glUseProgram(ID);
+    RenderStats::Current().programBinds++;
 }
 
 void Shader::setBool(const std::string &name, bool value) const {
-    glUniform1i(getUniformLocation(name), (int)value);
+    const GLint location = getUniformLocation(name);
+    if (location < 0) return;  // Uniform not in this program: nothing is uploaded
+    glUniform1i(location, (int)value);
+    RenderStats::Current().uniformUploads++;
 }
 
 void Shader::setInt(const std::string &name, int value) const {
-    glUniform1i(getUniformLocation(name), value);
+    const GLint location = getUniformLocation(name);
+    if (location < 0) return;
+    glUniform1i(location, value);
+    RenderStats::Current().uniformUploads++;
+}
+
+void Shader::setUInt(const std::string &name, unsigned int value) const {
+    const GLint location = getUniformLocation(name);
+    if (location < 0) return;
+    glUniform1ui(location, value);
+    RenderStats::Current().uniformUploads++;
 }
 
 void Shader::setFloat(const std::string &name, float value) const {
-    glUniform1f(getUniformLocation(name), value);
+    const GLint location = getUniformLocation(name);
+    if (location < 0) return;
+    glUniform1f(location, value);
+    RenderStats::Current().uniformUploads++;
 }
 
 void Shader::setMat4(const std::string& name, const float* value) const {
-    glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, value);
+    const GLint location = getUniformLocation(name);
+    if (location < 0) return;
+    glUniformMatrix4fv(location, 1, GL_FALSE, value);
+    RenderStats::Current().uniformUploads++;
 }
 
 void Shader::setVec4(const std::string& name, const glm::vec4& v) const {
-    glUniform4fv(getUniformLocation(name), 1, glm::value_ptr(v)); 
+    const GLint location = getUniformLocation(name);
+    if (location < 0) return;
+    glUniform4fv(location, 1, glm::value_ptr(v));
+    RenderStats::Current().uniformUploads++;
 }
 
 void Shader::setVec3(const std::string& name, const glm::vec3& v) const {
-    glUniform3fv(getUniformLocation(name), 1, glm::value_ptr(v));
+    const GLint location = getUniformLocation(name);
+    if (location < 0) return;
+    glUniform3fv(location, 1, glm::value_ptr(v));
+    RenderStats::Current().uniformUploads++;
 }
 
 void Shader::setVec2(const std::string& name, const glm::vec2& v) const {
-    glUniform2fv(getUniformLocation(name), 1, glm::value_ptr(v));
+    const GLint location = getUniformLocation(name);
+    if (location < 0) return;
+    glUniform2fv(location, 1, glm::value_ptr(v));
+    RenderStats::Current().uniformUploads++;
 }
 
 GLint Shader::getAttribLocation(const std::string& name) const {
+    ensureBuilt();
     return glGetAttribLocation(ID, name.c_str());
 }
 
 GLint Shader::getUniformLocation(const std::string& name) const {
+    ensureBuilt();
     return glGetUniformLocation(ID, name.c_str());
 }
 
 const Shader::ReflectedAttribs* Shader::getAttrib(const std::string& name) const {
+    ensureBuilt();
     auto it = m_Attributes.find(name);
 
     if (it == m_Attributes.end()) {
@@ -112,7 +199,8 @@ const Shader::ReflectedAttribs* Shader::getAttrib(const std::string& name) const
     return &it->second; 
 }
 
-void Shader::ReflectAttribs() {
+void Shader::ReflectAttribs() const {
+    ensureBuilt();
     GLint count = 0;
     glGetProgramiv(ID, GL_ACTIVE_ATTRIBUTES, &count);
 
@@ -234,6 +322,7 @@ void Shader::ReflectAttribs() {
 }
 
 Shader::~Shader() {
+    releasePending();
     if (ID != 0) {
         glDeleteProgram(ID);
         ID = 0;
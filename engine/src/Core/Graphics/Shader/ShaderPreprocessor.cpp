@@ -0,0 +1,118 @@
+#include "Engine/Core/Graphics/Shader/ShaderPreprocessor.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <unordered_set>
+
+namespace engine {
+
+namespace {
+
+bool readFile(const std::string& path, std::string& out) {
+    std::ifstream file(path, std::ios::in);
+    if (!file) return false;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    out = buffer.str();
+    return true;
+}
+
+// Matches `#include "name"` (leading whitespace allowed); returns the name
+bool parseInclude(const std::string& line, std::string& name) {
+    size_t pos = line.find_first_not_of(" \t");
+    if (pos == std::string::npos || line.compare(pos, 8, "#include") != 0) return false;
+
+    const size_t open = line.find('"', pos + 8);
+    if (open == std::string::npos) return false;
+    const size_t close = line.find('"', open + 1);
+    if (close == std::string::npos) return false;
+
+    name = line.substr(open + 1, close - open - 1);
+    return true;
+}
+
+bool isVersionLine(const std::string& line) {
+    size_t pos = line.find_first_not_of(" \t");
+    return pos != std::string::npos && line.compare(pos, 8, "#version") == 0;
+}
+
+bool expand(const std::string& source,
+            const std::filesystem::path& dir,
+            std::unordered_set<std::string>& included,
+            const std::vector<std::string>* defines,  // Non-null only for the main file
+            std::string& out) {
+    std::istringstream in(source);
+    std::string line;
+    int lineNumber = 0;
+    bool ok = true;
+
+    while (std::getline(in, line)) {
+        ++lineNumber;
+
+        std::string includeName;
+        if (parseInclude(line, includeName)) {
+            const std::filesystem::path includePath = (dir / includeName).lexically_normal();
+            const std::string key = includePath.generic_string();
+
+            if (!included.insert(key).second) {
+                continue;  // Already pasted once
+            }
+
+            std::string includeSource;
+            if (!readFile(key, includeSource)) {
+                std::cerr << "Shader preprocessor: cannot open include " << key << "\n";
+                ok = false;
+                continue;
+            }
+
+            out += "#line 1\n";
+            ok = expand(includeSource, includePath.parent_path(), included, nullptr, out) && ok;
+            out += "#line " + std::to_string(lineNumber + 1) + "\n";
+            continue;
+        }
+
+        out += line;
+        out += '\n';
+
+        if (defines && isVersionLine(line)) {
+            for (const auto& define : *defines) {
+                out += "#define " + define + " 1\n";
+            }
+            if (!defines->empty()) {
+                out += "#line " + std::to_string(lineNumber + 1) + "\n";
+            }
+            defines = nullptr;
+        }
+    }
+
+    return ok;
+}
+
+} // namespace
+
+bool ShaderPreprocessor::Process(const std::string& path,
+                                 const std::vector<std::string>& defines,
+                                 std::string& out) {
+    std::string source;
+    if (!readFile(path, source)) {
+        std::cerr << "Shader has not been read successfully " << path << "\n";
+        return false;
+    }
+
+    const std::filesystem::path filePath(path);
+    return ProcessSource(source, filePath.parent_path().string(), defines, out);
+}
+
+bool ShaderPreprocessor::ProcessSource(const std::string& source,
+                                       const std::string& includeDir,
+                                       const std::vector<std::string>& defines,
+                                       std::string& out) {
+    out.clear();
+    out.reserve(source.size() + defines.size() * 32);
+
+    std::unordered_set<std::string> included;
+    return expand(source, std::filesystem::path(includeDir), included, &defines, out);
+}
+
+} // namespace engine
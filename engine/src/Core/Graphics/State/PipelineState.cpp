@@ -1,4 +1,5 @@
 #include "Engine/Core/Graphics/State/PipelineState.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
 
 namespace engine {
 
@@ -65,6 +66,7 @@ void PipelineState::Apply() const {
     
     // Mark this state as current
     currentState = this;
+    RenderStats::Current().pipelineStateChanges++;
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include "Engine/Core/Graphics/Stats/FrameTimeHistogram.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <string>
+#include <ostream>
+
+namespace engine {
+
+namespace {
+
+// Upper bucket edges (ms); the last bucket is open-ended
+constexpr double kBucketEdges[] = {4.0, 8.0, 16.7, 33.3, 50.0, 100.0};
+constexpr size_t kBucketCount = sizeof(kBucketEdges) / sizeof(kBucketEdges[0]) + 1;
+constexpr int kBarWidth = 40;
+
+} // namespace
+
+double FrameTimeHistogram::GetPercentile(double percent) const {
+    if (samples.empty()) return 0.0;
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+    const double rank = std::clamp(percent, 0.0, 100.0) / 100.0 * static_cast<double>(sorted.size() - 1);
+    return sorted[static_cast<size_t>(std::lround(rank))];
+}
+
+double FrameTimeHistogram::GetMax() const {
+    return samples.empty() ? 0.0 : *std::max_element(samples.begin(), samples.end());
+}
+
+void FrameTimeHistogram::Print(std::ostream& out) const {
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+
+    size_t counts[kBucketCount] = {};
+    for (double ms : samples) {
+        size_t bucket = 0;
+        while (bucket < kBucketCount - 1 && ms >= kBucketEdges[bucket]) bucket++;
+        counts[bucket]++;
+    }
+    const size_t largest = *std::max_element(counts, counts + kBucketCount);
+
+    out << "--- Frame Times (" << samples.size() << " frames) ---\n" << std::fixed << std::setprecision(1);
+    for (size_t b = 0; b < kBucketCount; ++b) {
+        out << "  ";
+        if (b == 0) {
+            out << "      < " << std::setw(5) << kBucketEdges[0];
+        } else if (b == kBucketCount - 1) {
+            out << "     >= " << std::setw(5) << kBucketEdges[b - 1];
+        } else {
+            out << std::setw(5) << kBucketEdges[b - 1] << " - " << std::setw(5) << kBucketEdges[b];
+        }
+        const int bar = largest ? static_cast<int>(counts[b] * kBarWidth / largest) : 0;
+        out << " ms | " << std::string(static_cast<size_t>(bar), '#')
+            << std::string(static_cast<size_t>(kBarWidth - bar), ' ') << " " << counts[b] << "\n";
+    }
+
+    out << std::setprecision(2)
+        << "  p50 " << GetPercentile(50.0) << " ms, p95 " << GetPercentile(95.0)
+        << " ms, p99 " << GetPercentile(99.0) << " ms, max " << GetMax() << " ms\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+} // namespace engine
@@ -0,0 +1,56 @@
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
+#include <iomanip>
+#include <ostream>
+
+namespace engine {
+
+RenderStats& RenderStats::Current() {
+    static RenderStats current;
+    return current;
+}
+
+RenderStats& RenderStats::operator+=(const RenderStats& other) {
+    drawCalls += other.drawCalls;
+    instances += other.instances;
+    triangles += other.triangles;
+    programBinds += other.programBinds;
+    vaoBinds += other.vaoBinds;
+    textureBinds += other.textureBinds;
+    samplerBinds += other.samplerBinds;
+    uniformUploads += other.uniformUploads;
+    pipelineStateChanges += other.pipelineStateChanges;
+    bytesUploaded += other.bytesUploaded;
+    uploadMs += other.uploadMs;
+    visibleObjects += other.visibleObjects;
+    culledObjects += other.culledObjects;
+    clustersTested += other.clustersTested;
+    clustersCulled += other.clustersCulled;
+    cpuSubmitMs += other.cpuSubmitMs;
+    return *this;
+}
+
+void RenderStats::Print(std::ostream& out) const {
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+
+    out << "--- Render Stats ---\n"
+        << "  Draw calls:        " << drawCalls << "\n"
+        << "  Instances:         " << instances << "\n"
+        << "  Triangles:         " << triangles << "\n"
+        << "  Program binds:     " << programBinds << "\n"
+        << "  VAO binds:         " << vaoBinds << "\n"
+        << "  Texture binds:     " << textureBinds << "\n"
+        << "  Sampler binds:     " << samplerBinds << "\n"
+        << "  Uniform uploads:   " << uniformUploads << "\n"
+        << "  Pipeline changes:  " << pipelineStateChanges << "\n"
+        << "  Bytes uploaded:    " << bytesUploaded << "\n"
+        << "  Upload queue:      " << std::fixed << std::setprecision(3) << uploadMs << " ms\n"
+        << "  Visible / culled:  " << visibleObjects << " / " << culledObjects << "\n"
+        << "  Clusters culled:   " << clustersCulled << " / " << clustersTested << "\n"
+        << "  CPU submit:        " << std::fixed << std::setprecision(3) << cpuSubmitMs << " ms\n";
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+} // namespace engine
@@ -1,51 +1,60 @@
 #include "Engine/Core/Graphics/Texture/Sampler.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
 
 namespace engine {
 
-Sampler::Sampler() {
+namespace {
+
+constexpr int kTrackedUnits = 32;
+
+// Sampler bound to each texture unit, as far as Bind()/ClearBinding() know
+GLuint boundSamplers[kTrackedUnits] = {};
+
+bool tracked(int unit) {
+    return unit >= 0 && unit < kTrackedUnits;
+}
+
+} // namespace
+
+Sampler::Sampler() : Sampler(State()) {
+}
+
+Sampler::Sampler(const State& initialState) : state(initialState) {
     glGenSamplers(1, &ID);
 
-    // default sampling
-    glSamplerParameteri(ID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glSamplerParameteri(ID, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glSamplerParameteri(ID, GL_TEXTURE_WRAP_R, GL_REPEAT);
+    glSamplerParameteri(ID, GL_TEXTURE_WRAP_S, state.wrapS);
+    glSamplerParameteri(ID, GL_TEXTURE_WRAP_T, state.wrapT);
+    glSamplerParameteri(ID, GL_TEXTURE_WRAP_R, state.wrapR);
 
-    // degault filtering
-    glSamplerParameteri(ID, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-    glSamplerParameteri(ID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glSamplerParameteri(ID, GL_TEXTURE_MIN_FILTER, state.minFilter);
+    glSamplerParameteri(ID, GL_TEXTURE_MAG_FILTER, state.magFilter);
 }
 
 
 Sampler::~Sampler() {
+    // GL unbinds a deleted sampler from every unit
+    for (GLuint& bound : boundSamplers) {
+        if (bound == ID) bound = 0;
+    }
     glDeleteSamplers(1, &ID);
 }
 
 void Sampler::Bind(int unit) {
+    if (tracked(unit)) {
+        if (boundSamplers[unit] == ID) return;
+        boundSamplers[unit] = ID;
+    }
     glBindSampler(unit, ID);
+    RenderStats::Current().samplerBinds++;
 }
 
 void Sampler::Unbind(int unit) {
-    glBindSampler(unit, 0);
+    ClearBinding(unit);
 }
 
-void Sampler::SetMinFilter(GLenum filter) {
-    glSamplerParameteri(ID, GL_TEXTURE_MIN_FILTER, filter);
-}
-
-void Sampler::SetMagFilter(GLenum filter) {
-    glSamplerParameteri(ID, GL_TEXTURE_MAG_FILTER, filter);
-}
-
-void Sampler::SetWrapS(GLenum wrap) {
-    glSamplerParameteri(ID, GL_TEXTURE_WRAP_S, wrap);
-}
-
-void Sampler::SetWrapT(GLenum wrap) {
-    glSamplerParameteri(ID, GL_TEXTURE_WRAP_T, wrap);
+void Sampler::ClearBinding(int unit) {
+    if (tracked(unit)) boundSamplers[unit] = 0;
+    glBindSampler(unit, 0);
 }
 
-void Sampler::SetWrapR(GLenum wrap) {
-    glSamplerParameteri(ID, GL_TEXTURE_WRAP_R, wrap);
 }
-
-}
\ No newline at end of file
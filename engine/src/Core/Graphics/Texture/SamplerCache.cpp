@@ -0,0 +1,38 @@
+#include "Engine/Core/Graphics/Texture/SamplerCache.hpp"
+
+namespace engine {
+
+SamplerCache& SamplerCache::Instance() {
+    static SamplerCache instance;
+    return instance;
+}
+
+std::shared_ptr<Sampler> SamplerCache::Get(const Sampler::State& state) {
+    Entry* reusable = nullptr;
+    for (Entry& entry : entries) {
+        if (entry.state == state) {
+            if (auto sampler = entry.sampler.lock()) return sampler;
+            reusable = &entry;
+            break;
+        }
+        if (!reusable && entry.sampler.expired()) reusable = &entry;
+    }
+
+    auto sampler = std::make_shared<Sampler>(state);
+    if (reusable) {
+        *reusable = Entry{state, sampler};
+    } else {
+        entries.push_back(Entry{state, sampler});
+    }
+    return sampler;
+}
+
+size_t SamplerCache::GetLiveCount() const {
+    size_t live = 0;
+    for (const Entry& entry : entries) {
+        if (!entry.sampler.expired()) ++live;
+    }
+    return live;
+}
+
+} // namespace engine
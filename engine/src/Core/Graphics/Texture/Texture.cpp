@@ -1,69 +1,209 @@
 #include "Engine/Core/Graphics/Texture/Texture.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
+#include "Engine/Core/Graphics/Texture/TextureStreamer.hpp"
+#include "Engine/Core/Graphics/Upload/UploadQueue.hpp"
+#include "Engine/Assets/Cache/AssetCache.hpp"
 #include <stb_image.h>
 #include <iostream>
 
 namespace engine {
 
-Texture::Texture(GLenum target) : target(target) {
+namespace {
+
+// Decode settings baked into cached images; bump when they change
+constexpr uint64_t kDecodeVersion = 1;  // 8 bits per channel, bottom row first
+
+// Determine format based on number of channels
+GLenum formatForChannels(int channels) {
+    switch (channels) {
+        case 1: return GL_RED;
+        case 2: return GL_RG;
+        case 4: return GL_RGBA;
+        default: return GL_RGB;
+    }
+}
+
+} // namespace
+
+Texture::Texture(GLenum target) : ResidentAsset(AssetCategory::Texture), target(target) {
     glGenTextures(1, &ID);
 }
 
 Texture::~Texture() {
+    if (streamRequest) {
+        TextureStreamer::Instance().Cancel(streamRequest);
+    }
     glDeleteTextures(1, &ID);
 }
 
 void Texture::Bind(int unit) {
+    MarkUsed();  // Reloads from disk if evicted
     glActiveTexture(GL_TEXTURE0 + unit);
     glBindTexture(target, ID);
+    RenderStats::Current().textureBinds++;
 }
 
 void Texture::Unbind() {
     glBindTexture(target, 0);
 }
 
-void Texture::LoadFromFile(const std::string& path, bool generateMipmap) {
-    int width, height, channels;
+bool Texture::LoadFromFile(const std::string& filePath, bool generateMipmap) {
+    if (streamRequest) {
+        TextureStreamer::Instance().Cancel(streamRequest);
+        streamRequest = 0;
+    }
+
+    ETexFormat::Image image;
+    if (!readImage(filePath, image)) {
+        std::cerr << "Failed to load texture: " << filePath << std::endl;
+        width = height = channels = 0;
+        state = LoadState::Failed;
+        return false;
+    }
     
+    path = filePath;
+    hasMipmaps = generateMipmap;
+    uploadImage(image.pixels.get(), image.width, image.height, image.channels, hasMipmaps);
+    state = LoadState::Ready;
+
+    std::cout << "Loaded texture: " << path 
+              << " (" << width << "x" << height << ", " 
+              << channels << " channels)" << std::endl;
+    return true;
+}
+
+void Texture::LoadFromFileAsync(const std::string& filePath, bool generateMipmap) {
+    if (streamRequest) {
+        TextureStreamer::Instance().Cancel(streamRequest);
+    }
+
+    path = filePath;
+    hasMipmaps = generateMipmap;
+
+    // Mid-grey stand-in until the real image arrives
+    const unsigned char placeholder[4] = {128, 128, 128, 255};
+    uploadImage(placeholder, 1, 1, 4, false);
+    width = height = channels = 0;  // Placeholder isn't worth counting
+
+    state = LoadState::Loading;
+    streamRequest = TextureStreamer::Instance().Request(this, path);
+}
+
+bool Texture::readImage(const std::string& filePath, ETexFormat::Image& image) {
+    if (ETexFormat::IsETexPath(filePath)) {
+        return ETexFormat::Read(filePath, image);
+    }
+
+    // Decoded before (same bytes, any path): map that instead of decoding again.
+    // Hashed even with the cache off: TextureLoader shares textures by content
+    // and relies on this worker-side hash rather than hashing on the GL thread.
+    AssetCache& cache = AssetCache::Instance();
+    const uint64_t key = cache.ComputeKey(AssetCache::AssetType::Texture, filePath, kDecodeVersion);
+    const std::string derived = cache.FindDerived(key, ETexFormat::Extension);
+    if (!derived.empty() && ETexFormat::Read(derived, image)) {
+        return true;
+    }
+
     // Flip textures vertically to match OpenGL's texture coordinate system
     // OpenGL expects (0,0) at bottom-left, but image formats use top-left
-    stbi_set_flip_vertically_on_load(true);
-    
-    unsigned char* data = stbi_load(path.c_str(), &width, &height, &channels, 0);
-    
+    stbi_set_flip_vertically_on_load_thread(true);
+    unsigned char* data = stbi_load(filePath.c_str(), &image.width, &image.height, &image.channels, 0);
     if (!data) {
-        std::cerr << "Failed to load texture: " << path << std::endl;
         std::cerr << "STB Error: " << stbi_failure_reason() << std::endl;
-        return;
-    }
-    
-    // Determine format based on number of channels
-    GLenum format = GL_RGB;
-    if (channels == 1) {
-        format = GL_RED;
-    } else if (channels == 3) {
-        format = GL_RGB;
-    } else if (channels == 4) {
-        format = GL_RGBA;
+        return false;
     }
+    image.pixels = std::shared_ptr<const unsigned char>(data, [](const unsigned char* pixels) {
+        stbi_image_free(const_cast<unsigned char*>(pixels));
+    });
+
+    cache.StoreDerived(key, ETexFormat::Extension, [&](const std::string& out) {
+        return ETexFormat::Write(out, image.pixels.get(), image.width, image.height, image.channels);
+    });
+    return true;
+}
+
+void Texture::uploadImage(const void* pixels, int imageWidth, int imageHeight, int imageChannels,
+                          bool generateMipmap) {
+    width = imageWidth;
+    height = imageHeight;
+    channels = imageChannels;
+
+    uploadImageTo(target, ID, pixels, width, height, channels, generateMipmap);
+    RenderStats::Current().bytesUploaded += static_cast<uint64_t>(width) * height * channels;
+}
+
+void Texture::uploadImageTo(GLenum target, GLuint id, const void* pixels,
+                            int imageWidth, int imageHeight, int imageChannels, bool generateMipmap) {
+    const GLenum format = formatForChannels(imageChannels);
     
-    // Upload texture data to GPU
-    glBindTexture(target, ID);
-    glTexImage2D(target, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+    // Upload texture data to GPU (rows are tightly packed)
+    glBindTexture(target, id);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(target, 0, format, imageWidth, imageHeight, 0, format, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
     
+    finishImageTo(target, id, generateMipmap);
+}
+
+void Texture::uploadRowsTo(GLenum target, GLuint id, const void* pixels,
+                           int firstRow, int rowCount, int imageWidth, int imageChannels) {
+    const GLenum format = formatForChannels(imageChannels);
+
+    glBindTexture(target, id);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(target, 0, 0, firstRow, imageWidth, rowCount, format, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+}
+
+void Texture::finishImageTo(GLenum target, GLuint id, bool generateMipmap) {
+    glBindTexture(target, id);
+
     // Generate mipmaps if requested (improves quality at distance)
     if (generateMipmap) {
         glGenerateMipmap(target);
     }
     
-   glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0);
-   glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, generateMipmap ? 1000 : 0);
-    
-    // Free image data from CPU memory
-    stbi_image_free(data);
-    
-    std::cout << "Loaded texture: " << path 
-              << " (" << width << "x" << height << ", " 
-              << channels << " channels)" << std::endl;
+    glTexParameteri(target, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(target, GL_TEXTURE_MAX_LEVEL, generateMipmap ? 1000 : 0);
+}
+
+void Texture::adoptImage(GLuint id, int imageWidth, int imageHeight, int imageChannels) {
+    glDeleteTextures(1, &ID);
+    ID = id;
+    width = imageWidth;
+    height = imageHeight;
+    channels = imageChannels;
+    RenderStats::Current().bytesUploaded += static_cast<uint64_t>(width) * height * channels;
+}
+
+void Texture::finishAsyncLoad(bool succeeded) {
+    streamRequest = 0;
+    state = succeeded ? LoadState::Ready : LoadState::Failed;
+}
+
+void Texture::PrioritizeUpload(float importance) const {
+    if (state == LoadState::Loading) {
+        UploadQueue::Instance().SetImportance(this, importance);
+    }
+}
+
+size_t Texture::GetGpuBytes() const {
+    if (!IsResident()) return 0;
+    const size_t base = static_cast<size_t>(width) * height * channels;
+    return hasMipmaps ? base + base / 3 : base;  // Full mip chain adds ~1/3
+}
+
+void Texture::EvictGpu() {
+    glDeleteTextures(1, &ID);
+    ID = 0;
+}
+
+bool Texture::RestoreGpu() {
+    if (ID == 0) glGenTextures(1, &ID);
+
+    // Placeholder now, real image streams back in
+    LoadFromFileAsync(path, hasMipmaps);
+    return true;
 }
 
 } // namespace engine
\ No newline at end of file
@@ -0,0 +1,225 @@
+#include "Engine/Core/Graphics/Texture/TextureStreamer.hpp"
+#include "Engine/Assets/Cache/AssetCache.hpp"
+#include "Engine/Core/Graphics/Texture/Texture.hpp"
+#include "Engine/Core/Graphics/Upload/UploadQueue.hpp"
+#include "Engine/Core/Graphics/Upload/UploadThread.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace engine {
+
+TextureStreamer& TextureStreamer::Instance() {
+    static TextureStreamer instance;
+    return instance;
+}
+
+TextureStreamer::TextureStreamer() : completed(std::make_shared<Completed>()) {
+    // Decodes use the AssetCache: construct it first so it outlives the workers
+    AssetCache::Instance();
+    // Construct the JobSystem first so its workers are joined after we're destroyed
+    JobSystem::Instance();
+}
+
+TextureStreamer::~TextureStreamer() {
+    // Any GL resources should already be gone (ReleaseGLResources); in-flight
+    // decodes keep `completed` alive on their own
+}
+
+uint64_t TextureStreamer::Request(Texture* texture, const std::string& path) {
+    const uint64_t request = nextRequest++;
+    requests[request] = texture;
+
+    std::shared_ptr<Completed> sink = completed;
+    JobSystem::Instance().Submit([sink, request, path]() {
+        ENGINE_PROFILE_SCOPE("TextureStreamer::Decode");
+
+        DecodedImage image;
+        image.request = request;
+        image.path = path;
+
+        // Same reader as Texture::LoadFromFile (bottom row first)
+        ETexFormat::Image decoded;
+        if (Texture::readImage(path, decoded)) {
+            image.width = decoded.width;
+            image.height = decoded.height;
+            image.channels = decoded.channels;
+            image.pixels = std::move(decoded.pixels);
+        }
+
+        std::lock_guard<std::mutex> lock(sink->mutex);
+        sink->images.push_back(std::move(image));
+    });
+    return request;
+}
+
+void TextureStreamer::Cancel(uint64_t request) {
+    requests.erase(request);
+}
+
+void TextureStreamer::Update() {
+    ENGINE_PROFILE_SCOPE("TextureStreamer::Update");
+    dispatchDecoded();
+}
+
+void TextureStreamer::Flush() {
+    ENGINE_PROFILE_SCOPE("TextureStreamer::Flush");
+    while (!requests.empty()) {
+        const size_t dispatched = dispatchDecoded();
+        UploadQueue::Instance().Flush();
+        UploadThread::Instance().Poll();
+        if (dispatched == 0) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+size_t TextureStreamer::dispatchDecoded() {
+    size_t dispatched = 0;
+
+    for (;;) {
+        DecodedImage image;
+        {
+            std::lock_guard<std::mutex> lock(completed->mutex);
+            if (completed->images.empty()) break;
+            image = std::move(completed->images.front());
+            completed->images.pop_front();
+        }
+
+        auto it = requests.find(image.request);
+        if (it == requests.end()) continue;  // Cancelled; pixels freed with `image`
+        Texture* texture = it->second;
+        dispatched++;
+
+        if (!image.pixels) {
+            std::cerr << "Failed to load texture: " << image.path << std::endl;
+            requests.erase(it);
+            texture->finishAsyncLoad(false);
+            continue;
+        }
+
+        // Both stay pending (in `requests`) until the image is swapped in
+        if (UploadThread::Instance().IsRunning()) {
+            submitToUploadThread(texture, std::move(image));
+        } else {
+            enqueueUpload(texture, std::move(image));
+        }
+    }
+    return dispatched;
+}
+
+void TextureStreamer::enqueueUpload(Texture* texture, DecodedImage&& image) {
+    auto upload = std::make_shared<ChunkedUpload>();
+    upload->image = std::move(image);
+
+    UploadQueue::Instance().Enqueue(texture, [this, upload](bool& done) -> size_t {
+        return uploadRows(*upload, done);
+    });
+}
+
+size_t TextureStreamer::uploadRows(ChunkedUpload& upload, bool& done) {
+    ENGINE_PROFILE_SCOPE("TextureStreamer::UploadRows");
+    const DecodedImage& image = upload.image;
+
+    // The texture may have been destroyed (or re-requested) since it was queued
+    auto it = requests.find(image.request);
+    if (it == requests.end()) {
+        if (upload.id) glDeleteTextures(1, &upload.id);
+        done = true;
+        return 0;
+    }
+    Texture* texture = it->second;
+    const GLenum target = texture->GetTarget();
+
+    if (upload.id == 0) {
+        // Storage only; filled band by band below
+        glGenTextures(1, &upload.id);
+        Texture::uploadImageTo(target, upload.id, nullptr, image.width, image.height, image.channels, false);
+    }
+
+    const size_t rowBytes = static_cast<size_t>(image.width) * image.channels;
+    const int rows = std::min(image.height - upload.nextRow,
+                              static_cast<int>(std::max<size_t>(1, UploadQueue::ChunkBytes / rowBytes)));
+    const size_t size = rowBytes * rows;
+    const unsigned char* src = image.pixels.get() + rowBytes * upload.nextRow;
+    if (pbo == 0) glGenBuffers(1, &pbo);
+
+    // Orphan the previous contents so the driver never waits on an earlier
+    // transfer, copy into the mapping, then let glTexSubImage2D source from it
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+    void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, static_cast<GLsizeiptr>(size),
+                                    GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+    if (mapped) {
+        std::memcpy(mapped, src, size);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+        Texture::uploadRowsTo(target, upload.id, nullptr, upload.nextRow, rows, image.width, image.channels);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    } else {
+        // Mapping failed: plain client-memory upload
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        Texture::uploadRowsTo(target, upload.id, src, upload.nextRow, rows, image.width, image.channels);
+    }
+    upload.nextRow += rows;
+
+    if (upload.nextRow < image.height) {
+        glBindTexture(target, 0);
+        return size;
+    }
+
+    // Last band: build the mip chain and swap out the placeholder
+    Texture::finishImageTo(target, upload.id, texture->hasMipmaps);
+    glBindTexture(target, 0);
+    requests.erase(it);
+    texture->adoptImage(upload.id, image.width, image.height, image.channels);
+    texture->finishAsyncLoad(true);
+    upload.id = 0;
+    done = true;
+
+    std::cout << "Streamed texture: " << image.path
+              << " (" << image.width << "x" << image.height << ", "
+              << image.channels << " channels)" << std::endl;
+    return size;
+}
+
+void TextureStreamer::submitToUploadThread(Texture* texture, DecodedImage&& decoded) {
+    auto image = std::make_shared<DecodedImage>(std::move(decoded));
+    auto id = std::make_shared<GLuint>(0);
+    const GLenum target = texture->GetTarget();
+    const bool generateMipmap = texture->hasMipmaps;
+
+    UploadThread::Instance().Submit([image, id, target, generateMipmap]() {
+        glGenTextures(1, id.get());
+        Texture::uploadImageTo(target, *id, image->pixels.get(),
+                               image->width, image->height, image->channels, generateMipmap);
+        glBindTexture(target, 0);
+    }, [this, image, id]() {
+        // The texture may have been destroyed (or re-requested) while we uploaded
+        auto it = requests.find(image->request);
+        if (it == requests.end()) {
+            glDeleteTextures(1, id.get());
+            return;
+        }
+        Texture* texture = it->second;
+        requests.erase(it);
+
+        texture->adoptImage(*id, image->width, image->height, image->channels);
+        texture->finishAsyncLoad(true);
+        std::cout << "Streamed texture: " << image->path
+                  << " (" << image->width << "x" << image->height << ", "
+                  << image->channels << " channels, upload thread)" << std::endl;
+    });
+}
+
+void TextureStreamer::ReleaseGLResources() {
+    if (pbo) {
+        glDeleteBuffers(1, &pbo);
+        pbo = 0;
+    }
+}
+
+} // namespace engine
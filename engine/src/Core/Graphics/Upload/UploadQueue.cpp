@@ -0,0 +1,82 @@
+#include "Engine/Core/Graphics/Upload/UploadQueue.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+
+namespace engine {
+
+UploadQueue& UploadQueue::Instance() {
+    static UploadQueue instance;
+    return instance;
+}
+
+void UploadQueue::Enqueue(const void* owner, Step step) {
+    incoming.push_back(Item{owner, std::move(step)});
+}
+
+void UploadQueue::SetImportance(const void* owner, float value) {
+    float& current = importance[owner];
+    current = std::max(current, value);
+}
+
+void UploadQueue::Process() {
+    ENGINE_PROFILE_SCOPE("UploadQueue::Process");
+    run(m_Budget.maxBytes, m_Budget.maxMilliseconds);
+}
+
+void UploadQueue::Flush() {
+    ENGINE_PROFILE_SCOPE("UploadQueue::Flush");
+    while (GetPendingCount() > 0) {
+        run(0, 0.0);
+    }
+}
+
+void UploadQueue::run(size_t maxBytes, double maxMilliseconds) {
+    std::move(incoming.begin(), incoming.end(), std::back_inserter(items));
+    incoming.clear();
+
+    lastFrameBytes = 0;
+    lastFrameMs = 0.0;
+    if (items.empty()) {
+        importance.clear();
+        return;
+    }
+
+    // Most important first; stable so equal (e.g. off-screen) work stays FIFO
+    for (Item& item : items) {
+        auto it = importance.find(item.owner);
+        item.importance = it != importance.end() ? it->second : 0.0f;
+    }
+    importance.clear();
+    std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+        return a.importance > b.importance;
+    });
+
+    // Finish one item before starting the next, so the most important
+    // object becomes drawable as early as possible
+    const auto start = std::chrono::steady_clock::now();
+    for (Item& item : items) {
+        bool overBudget = false;
+        while (!item.done) {
+            lastFrameBytes += item.step(item.done);
+
+            const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+            lastFrameMs = elapsed.count();
+            if ((maxBytes > 0 && lastFrameBytes >= maxBytes) ||
+                (maxMilliseconds > 0.0 && lastFrameMs >= maxMilliseconds)) {
+                overBudget = true;
+                break;
+            }
+        }
+        if (overBudget) break;
+    }
+
+    items.erase(std::remove_if(items.begin(), items.end(), [](const Item& item) { return item.done; }),
+                items.end());
+
+    RenderStats::Current().uploadMs += lastFrameMs;
+}
+
+} // namespace engine
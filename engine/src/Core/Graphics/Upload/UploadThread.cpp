@@ -0,0 +1,175 @@
+#include "Engine/Core/Graphics/Upload/UploadThread.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <GLFW/glfw3.h>
+#include <iostream>
+
+namespace engine {
+
+namespace {
+
+// glClientWaitSync timeout for blocking waits (ns); re-waited until signalled
+constexpr GLuint64 kBlockingWaitNs = 100'000'000;
+
+} // namespace
+
+UploadThread& UploadThread::Instance() {
+    static UploadThread instance;
+    return instance;
+}
+
+UploadThread::~UploadThread() {
+    // The GL context is long gone at static destruction; Stop() must have run
+    if (thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        thread.join();
+    }
+}
+
+bool UploadThread::Start(GLFWwindow* mainWindow) {
+    if (running || !mainWindow) return running;
+
+    // Same context version as the renderer, no visible surface
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    uploadWindow = glfwCreateWindow(1, 1, "Upload", nullptr, mainWindow);
+    glfwDefaultWindowHints();
+
+    if (!uploadWindow) {
+        std::cerr << "UploadThread: shared context unavailable, uploading on the render thread\n";
+        return false;
+    }
+
+    stopping = false;
+    running = true;
+    thread = std::thread(&UploadThread::threadLoop, this);
+    return true;
+}
+
+void UploadThread::Stop() {
+    if (!running) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    condition.notify_all();
+    thread.join();  // Drains `queued` first
+
+    // Publish (or clean up) everything the thread finished
+    publishReady(true);
+
+    glfwDestroyWindow(uploadWindow);
+    uploadWindow = nullptr;
+    running = false;
+}
+
+void UploadThread::Submit(std::function<void()> work, std::function<void()> publish) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queued.push_back(Task{std::move(work), std::move(publish), nullptr});
+    }
+    condition.notify_one();
+}
+
+void UploadThread::threadLoop() {
+    ENGINE_PROFILE_THREAD_NAME("Upload");
+    glfwMakeContextCurrent(uploadWindow);
+
+    std::cout << "✓ Upload thread: shared context on "
+              << reinterpret_cast<const char*>(glGetString(GL_RENDERER)) << "\n";
+
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return stopping || !queued.empty(); });
+            if (queued.empty()) break;  // Stopping and drained
+            task = std::move(queued.front());
+            queued.pop_front();
+            inFlight++;
+        }
+
+        {
+            ENGINE_PROFILE_SCOPE("UploadThread::Work");
+            task.work();
+        }
+
+        // Flush so the fence actually reaches the GPU and other contexts can see it
+        task.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            submitted.push_back(std::move(task));
+            inFlight--;
+        }
+        condition.notify_all();
+    }
+
+    glfwMakeContextCurrent(nullptr);
+}
+
+void UploadThread::Poll() {
+    if (!running) return;
+    ENGINE_PROFILE_SCOPE("UploadThread::Poll");
+    publishReady(false);
+}
+
+void UploadThread::Flush() {
+    if (!running) return;
+    ENGINE_PROFILE_SCOPE("UploadThread::Flush");
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return queued.empty() && inFlight == 0; });
+        }
+        publishReady(true);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queued.empty() && inFlight == 0 && submitted.empty()) return;
+    }
+}
+
+size_t UploadThread::publishReady(bool wait) {
+    size_t published = 0;
+
+    for (;;) {
+        // Taken off the queue so the upload thread can keep pushing while we wait
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (submitted.empty()) break;
+            task = std::move(submitted.front());
+            submitted.pop_front();
+        }
+
+        // Fences from one context signal in order: stop at the first pending one
+        GLenum status = glClientWaitSync(task.fence, 0, wait ? kBlockingWaitNs : 0);
+        while (wait && status == GL_TIMEOUT_EXPIRED) {
+            status = glClientWaitSync(task.fence, 0, kBlockingWaitNs);
+        }
+        if (status == GL_TIMEOUT_EXPIRED) {
+            // Only this thread pops, so the front is still where it belongs
+            std::lock_guard<std::mutex> lock(mutex);
+            submitted.push_front(std::move(task));
+            break;
+        }
+        if (status == GL_WAIT_FAILED) {
+            std::cerr << "UploadThread: fence wait failed, publishing anyway\n";
+        }
+
+        glDeleteSync(task.fence);
+        if (task.publish) task.publish();
+        published++;
+    }
+    return published;
+}
+
+} // namespace engine
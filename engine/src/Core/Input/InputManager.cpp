@@ -1,4 +1,5 @@
 #include "Engine/Core/Input/InputManager.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
 #include <iostream>
 
 namespace engine {
@@ -29,6 +30,8 @@ void InputManager::Init(GLFWwindow* window) {
 }
 
 void InputManager::Update() {
+    ENGINE_PROFILE_SCOPE("InputManager::Update");
+
     if (!m_Window) return;
     
     // Update previous state for "just pressed/released" detection
@@ -0,0 +1,176 @@
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <algorithm>
+#include <string>
+
+namespace engine {
+
+namespace {
+
+// Set while this thread runs a background job, so the jobs it spawns stay
+// background too and never land on a frame's Wait()
+thread_local bool tl_InBackgroundJob = false;
+
+} // namespace
+
+JobSystem& JobSystem::Instance() {
+    static JobSystem instance;
+    return instance;
+}
+
+JobSystem::~JobSystem() {
+    Shutdown();
+}
+
+void JobSystem::Init(unsigned int workerCount) {
+    std::lock_guard<std::mutex> startLock(startMutex);
+    if (running.load(std::memory_order_relaxed)) return;
+
+    unsigned int count = workerCount;
+    if (count == 0) {
+        const unsigned int hardware = std::thread::hardware_concurrency();
+        count = hardware > 1 ? hardware - 1 : 1;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = false;
+    }
+    workers.reserve(count);
+    for (unsigned int i = 0; i < count; ++i) {
+        workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+    running.store(true, std::memory_order_release);
+}
+
+void JobSystem::ensureStarted() {
+    if (!running.load(std::memory_order_acquire)) {
+        Init(0);
+    }
+}
+
+void JobSystem::Shutdown() {
+    std::lock_guard<std::mutex> startLock(startMutex);
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    queueCondition.notify_all();
+
+    for (auto& worker : workers) {
+        if (worker.joinable()) worker.join();
+    }
+    workers.clear();
+    running.store(false, std::memory_order_release);
+}
+
+void JobSystem::workerLoop(unsigned int index) {
+    const std::string name = "Worker " + std::to_string(index);
+    ENGINE_PROFILE_THREAD_NAME(name.c_str());
+
+    for (;;) {
+        Job job;
+        bool background;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondition.wait(lock, [this]() { return stopping || !queue.empty() || !backgroundQueue.empty(); });
+            background = queue.empty();
+            std::deque<Job>& source = background ? backgroundQueue : queue;
+            if (source.empty()) return;  // Stopping and drained
+            job = std::move(source.front());
+            source.pop_front();
+        }
+
+        run(job, background);
+    }
+}
+
+bool JobSystem::runOne() {
+    // Only a thread already inside a background job may help with background
+    // work; anything else (the render thread) sticks to regular jobs
+    const bool helpBackground = tl_InBackgroundJob;
+
+    Job job;
+    bool background;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        background = queue.empty();
+        if (background && (!helpBackground || backgroundQueue.empty())) return false;
+        std::deque<Job>& source = background ? backgroundQueue : queue;
+        job = std::move(source.front());
+        source.pop_front();
+    }
+
+    run(job, background);
+    return true;
+}
+
+void JobSystem::run(Job& job, bool background) {
+    const bool outer = tl_InBackgroundJob;
+    tl_InBackgroundJob = background;
+    job.fn();
+    tl_InBackgroundJob = outer;
+    job.counter->fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void JobSystem::enqueue(std::function<void()> fn, const std::shared_ptr<std::atomic<int>>& counter,
+                        bool background) {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        (background || tl_InBackgroundJob ? backgroundQueue : queue).push_back(Job{std::move(fn), counter});
+    }
+    queueCondition.notify_one();
+}
+
+JobHandle JobSystem::Submit(std::function<void()> job) {
+    ensureStarted();
+
+    JobHandle handle;
+    handle.m_Pending = std::make_shared<std::atomic<int>>(1);
+    enqueue(std::move(job), handle.m_Pending);
+    return handle;
+}
+
+JobHandle JobSystem::SubmitBackground(std::function<void()> job) {
+    ensureStarted();
+
+    JobHandle handle;
+    handle.m_Pending = std::make_shared<std::atomic<int>>(1);
+    enqueue(std::move(job), handle.m_Pending, true);
+    return handle;
+}
+
+void JobSystem::Wait(const JobHandle& handle) {
+    while (!handle.IsDone()) {
+        if (!runOne()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::ParallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t)>& fn) {
+    if (count == 0) return;
+    grain = std::max<size_t>(grain, 1);
+
+    const size_t batches = (count + grain - 1) / grain;
+    if (batches == 1) {
+        fn(0, count);
+        return;
+    }
+
+    ensureStarted();
+
+    // The caller takes batch 0 itself; the rest go to the queue
+    JobHandle handle;
+    handle.m_Pending = std::make_shared<std::atomic<int>>(static_cast<int>(batches - 1));
+    for (size_t b = 1; b < batches; ++b) {
+        const size_t begin = b * grain;
+        const size_t end = std::min(count, begin + grain);
+        enqueue([&fn, begin, end]() { fn(begin, end); }, handle.m_Pending);
+    }
+
+    fn(0, std::min(count, grain));
+    Wait(handle);
+}
+
+} // namespace engine
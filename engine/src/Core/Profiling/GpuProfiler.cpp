@@ -0,0 +1,78 @@
+#include "Engine/Core/Profiling/GpuProfiler.hpp"
+
+#if ENGINE_ENABLE_PROFILING
+
+namespace engine {
+
+GpuProfiler::GpuProfiler() {
+}
+
+GpuProfiler::~GpuProfiler() {
+    for (auto& slot : frames) {
+        for (const auto& p : slot.pending) {
+            glDeleteQueries(1, &p.query);
+        }
+        if (!slot.freeQueries.empty()) {
+            glDeleteQueries(static_cast<GLsizei>(slot.freeQueries.size()), slot.freeQueries.data());
+        }
+    }
+}
+
+void GpuProfiler::BeginFrame() {
+    frameIndex = (frameIndex + 1) % FrameLatency;
+    FrameSlot& slot = frames[frameIndex];
+
+    // These queries were issued FrameLatency frames ago
+    for (const auto& p : slot.pending) {
+        GLint available = 0;
+        glGetQueryObjectiv(p.query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available) {
+            GLuint64 elapsedNs = 0;
+            glGetQueryObjectui64v(p.query, GL_QUERY_RESULT, &elapsedNs);
+            Profiler::RecordEvent(p.name, "gpu", p.cpuStartNs,
+                                  static_cast<uint64_t>(elapsedNs), Profiler::GpuThreadId);
+        }
+        // Not ready after FrameLatency frames: drop the sample rather than stall
+        slot.freeQueries.push_back(p.query);
+    }
+    slot.pending.clear();
+}
+
+GLuint GpuProfiler::acquireQuery(FrameSlot& slot) {
+    if (slot.freeQueries.empty()) {
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        return query;
+    }
+    GLuint query = slot.freeQueries.back();
+    slot.freeQueries.pop_back();
+    return query;
+}
+
+void GpuProfiler::BeginPass(const char* name) {
+    if (passActive) {
+        ++ignoredDepth;  // GL_TIME_ELAPSED queries cannot nest
+        return;
+    }
+
+    FrameSlot& slot = frames[frameIndex];
+    const GLuint query = acquireQuery(slot);
+    slot.pending.push_back({name, query, Profiler::NowNs()});
+
+    glBeginQuery(GL_TIME_ELAPSED, query);
+    passActive = true;
+}
+
+void GpuProfiler::EndPass() {
+    if (ignoredDepth > 0) {
+        --ignoredDepth;
+        return;
+    }
+    if (!passActive) return;
+    glEndQuery(GL_TIME_ELAPSED);
+    passActive = false;
+}
+
+} // namespace engine
+
+#endif // ENGINE_ENABLE_PROFILING
@@ -0,0 +1,174 @@
+#include "Engine/Core/Profiling/Profiler.hpp"
+
+#if ENGINE_ENABLE_PROFILING
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace engine {
+
+namespace {
+
+struct ProfileEvent {
+    const char* name;
+    const char* category;
+    uint64_t startNs;
+    uint64_t durationNs;
+    uint32_t threadId;
+};
+
+// Ring of events owned by exactly one writer thread.
+// The writer publishes with a release store; the dumper reads with acquire.
+struct ThreadBuffer {
+    static constexpr uint32_t Capacity = 1u << 16;
+
+    uint32_t threadId = 0;
+    std::string threadName;
+    std::unique_ptr<ProfileEvent[]> events{new ProfileEvent[Capacity]};
+    std::atomic<uint64_t> written{0};
+
+    void Push(const ProfileEvent& e) {
+        const uint64_t n = written.load(std::memory_order_relaxed);
+        events[n & (Capacity - 1)] = e;
+        written.store(n + 1, std::memory_order_release);
+    }
+};
+
+struct Registry {
+    std::mutex mutex;  // Guards registration and export only
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    uint32_t nextThreadId = 1;
+};
+
+Registry& GetRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+ThreadBuffer& GetThreadBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        Registry& reg = GetRegistry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.buffers.push_back(std::make_unique<ThreadBuffer>());
+        buffer = reg.buffers.back().get();
+        buffer->threadId = reg.nextThreadId++;
+    }
+    return *buffer;
+}
+
+void WriteEscaped(std::ostream& out, const char* s) {
+    for (; s && *s; ++s) {
+        switch (*s) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            default:   out << *s; break;
+        }
+    }
+}
+
+} // namespace
+
+uint64_t Profiler::NowNs() {
+    using Clock = std::chrono::steady_clock;
+    static const Clock::time_point epoch = Clock::now();
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch).count());
+}
+
+void Profiler::RecordEvent(const char* name, const char* category,
+                           uint64_t startNs, uint64_t durationNs) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    buffer.Push({name, category, startNs, durationNs, buffer.threadId});
+}
+
+void Profiler::RecordEvent(const char* name, const char* category,
+                           uint64_t startNs, uint64_t durationNs, uint32_t threadId) {
+    GetThreadBuffer().Push({name, category, startNs, durationNs, threadId});
+}
+
+void Profiler::SetThreadName(const char* name) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(GetRegistry().mutex);
+    buffer.threadName = name ? name : "";
+}
+
+bool Profiler::WriteChromeTrace(const std::string& path) {
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Profiler: failed to open trace file: " << path << "\n";
+        return false;
+    }
+
+    Registry& reg = GetRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    size_t eventCount = 0;
+
+    auto separator = [&]() {
+        if (!first) out << ",\n";
+        first = false;
+    };
+
+    // Track names
+    for (const auto& buffer : reg.buffers) {
+        separator();
+        out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+            << ",\"args\":{\"name\":\"";
+        if (buffer->threadName.empty()) {
+            out << "Thread " << buffer->threadId;
+        } else {
+            WriteEscaped(out, buffer->threadName.c_str());
+        }
+        out << "\"}}";
+    }
+    separator();
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << GpuThreadId
+        << ",\"args\":{\"name\":\"GPU\"}}";
+
+    // Complete ("X") events, timestamps in microseconds
+    for (const auto& buffer : reg.buffers) {
+        const uint64_t written = buffer->written.load(std::memory_order_acquire);
+        const uint64_t count = std::min<uint64_t>(written, ThreadBuffer::Capacity);
+        for (uint64_t i = written - count; i < written; ++i) {
+            const ProfileEvent& e = buffer->events[i & (ThreadBuffer::Capacity - 1)];
+            separator();
+            out << "{\"name\":\"";
+            WriteEscaped(out, e.name);
+            out << "\",\"cat\":\"";
+            WriteEscaped(out, e.category);
+            out << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << e.threadId
+                << ",\"ts\":" << (e.startNs / 1000.0)
+                << ",\"dur\":" << (e.durationNs / 1000.0) << "}";
+            ++eventCount;
+        }
+    }
+
+    out << "\n]}\n";
+
+    std::cout << "✓ Wrote profile trace: " << path << " (" << eventCount << " events)\n";
+    return true;
+}
+
+void Profiler::Clear() {
+    Registry& reg = GetRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    for (auto& buffer : reg.buffers) {
+        buffer->written.store(0, std::memory_order_release);
+    }
+}
+
+} // namespace engine
+
+#endif // ENGINE_ENABLE_PROFILING
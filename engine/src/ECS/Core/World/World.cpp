@@ -1,4 +1,8 @@
 #include "Engine/ECS/Core/World/World.hpp"
+#include "Engine/ECS/Core/Component/Component.hpp"
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
 
 namespace engine {
 
@@ -10,11 +14,23 @@ World::~World() {
 }
 
 Entity* World::CreateEntity(const std::string& name) {
-    Entity* entity = new Entity(name);
-    entities.push_back(entity);
+    Entity* entity = CreateEntities(1);
+    entity->name = name;
     return entity;
 }
 
+Entity* World::CreateEntities(size_t count) {
+    if (count == 0) return nullptr;
+    Entity* block = new Entity[count];
+    entityBlocks.emplace(block, EntityBlock{std::unique_ptr<Entity[]>(block), count});
+    const size_t first = entities.size();
+    entities.resize(first + count);
+    for (size_t i = 0; i < count; ++i) {
+        entities[first + i] = block + i;
+    }
+    return block;
+}
+
 Entity* World::FindByName(const std::string& name) {
     for (auto* entity : entities) {
         if (entity->name == name) {
@@ -24,11 +40,39 @@ Entity* World::FindByName(const std::string& name) {
     return nullptr;
 }
 
-void World::Clear() {
-    for (auto* entity : entities) {
-        delete entity;
+void World::DestroyEntity(Entity* entity) {
+    if (!entity) return;
+    if (entity->parent) {
+        entity->parent->RemoveChild(entity);
+    }
+
+    // The subtree, parents first
+    std::vector<Entity*> doomed{entity};
+    for (size_t i = 0; i < doomed.size(); ++i) {
+        doomed.insert(doomed.end(), doomed[i]->children.begin(), doomed[i]->children.end());
     }
+
+    const std::unordered_set<Entity*> lookup(doomed.begin(), doomed.end());
+    entities.erase(std::remove_if(entities.begin(), entities.end(),
+                                  [&lookup](Entity* e) { return lookup.count(e) > 0; }),
+                   entities.end());
+
+    for (Entity* e : doomed) {
+        // Components (and the materials they own) go now, the memory with the block
+        e->components.clear();
+        e->children.clear();
+        e->parent = nullptr;
+
+        auto block = std::prev(entityBlocks.upper_bound(e));
+        if (--block->second.alive == 0) {
+            entityBlocks.erase(block);
+        }
+    }
+}
+
+void World::Clear() {
     entities.clear();
+    entityBlocks.clear();
 }
 
 }
\ No newline at end of file
@@ -2,8 +2,18 @@
 #include "Engine/ECS/Core/World/World.hpp"                // so we can access world->entities
 #include "Engine/ECS/Core/Entity/Entity.hpp"
 #include "Engine/ECS/Components/Rendering/MeshRendererComponent.hpp"
+#include "Engine/Rendering/Geometry/Mesh/Mesh.hpp"
 #include "Engine/ECS/Components/Camera/CameraComponent.hpp"      // so we can call GetProjectionMatrix / GetViewMatrix
 #include "Engine/Core/Graphics/Shader/Shader.hpp"
+#include "Engine/Core/Graphics/Extensions/GLExtensions.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Core/Graphics/Texture/TextureStreamer.hpp"
+#include "Engine/Core/Graphics/Upload/UploadQueue.hpp"
+#include "Engine/Core/Graphics/Upload/UploadThread.hpp"
+#include "Engine/Assets/Residency/ResidencyManager.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
@@ -13,15 +23,34 @@
 
 namespace engine {
 
+namespace {
+
+// Meshlets per culling job
+constexpr size_t kClusterBatchSize = 128;
+
+// Smallest/largest axis scale ratio still treated as uniform for cone culling
+constexpr float kUniformScaleTolerance = 0.999f;
+
+} // namespace
+
         Renderer::Renderer()
     : width(320), height(240), initialized(false), m_Window(nullptr) {
     // vao/vbo are nullptr initially
 }
 
 Renderer::~Renderer() {
+    // Finish (and publish) background uploads while both contexts still exist
+    UploadThread::Instance().Stop();
+
     // Destroy GL objects *before* killing the context
     vao.reset();
     vbo.reset();
+    instanceVbo.reset();
+    postPass.reset();
+    TextureStreamer::Instance().ReleaseGLResources();
+#if ENGINE_ENABLE_PROFILING
+    gpuProfiler.reset();
+#endif
 
     if (m_Window) {
         glfwDestroyWindow(m_Window);
@@ -54,11 +83,24 @@ bool Renderer::Init() {
         return false;
     }
 
+    // Optional entry points (program binaries, ...) - after glad, before any shader is built
+    GLExtensions::Load((GLADloadproc)glfwGetProcAddress);
+
     glEnable(GL_DEPTH_TEST);
 
     // NOW OpenGL + GLAD are ready -> safe to create RAII GL objects
     vao = std::make_unique<VAO>();
     vbo = std::make_unique<VBO>();
+    instanceVbo = std::make_unique<VBO>();
+    postPass = std::make_unique<PostProcessPass>();
+#if ENGINE_ENABLE_PROFILING
+    gpuProfiler = std::make_unique<GpuProfiler>();
+#endif
+
+    // Optional second context for buffer/texture uploads (falls back to this thread)
+    if (m_UploadThreadEnabled) {
+        UploadThread::Instance().Start(m_Window);
+    }
 
     initialized = true;
     return true;
@@ -70,6 +112,17 @@ bool Renderer::Init() {
         return;
     }
 
+    ENGINE_PROFILE_SCOPE("Renderer::Render");
+    const auto submitStart = std::chrono::steady_clock::now();
+#if ENGINE_ENABLE_PROFILING
+    gpuProfiler->BeginFrame();
+#endif
+
+    // Publish fenced background uploads, then queue uploads for textures that
+    // finished decoding (written by the UploadQueue after the geometry pass)
+    UploadThread::Instance().Poll();
+    TextureStreamer::Instance().Update();
+
     // Get actual framebuffer size every frame
     int fbWidth = 0, fbHeight = 0;
     glfwGetFramebufferSize(m_Window, &fbWidth, &fbHeight);
@@ -79,8 +132,6 @@ bool Renderer::Init() {
     height = fbHeight;
 
     glViewport(0, 0, width, height);
-    glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
     // Keep camera aspect in sync with framebuffer size
     camera->aspectRatio = static_cast<float>(width) / static_cast<float>(height);
@@ -89,50 +140,330 @@ bool Renderer::Init() {
     glm::mat4 projection = camera->GetProjectionMatrix();
     glm::mat4 view = camera->GetViewMatrix();
 
-    
+    const glm::vec4 clearColor(0.1f, 0.1f, 0.15f, 1.0f);
+    const bool usePostPass = m_PostProcessEnabled && postPass;
+
+    {
+        ENGINE_PROFILE_GPU_PASS(*gpuProfiler, "Geometry");
+
+        if (usePostPass) {
+            // Geometry goes offscreen; quantize/dither/fog happen once per pixel in End()
+            postPass->Begin(width, height, clearColor);
+        } else {
+            glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
+
+        // Gather visible draws; whole objects are culled by their bounding sphere
+        const Frustum frustum(projection * view);
+        const glm::vec3 eye = glm::vec3(glm::inverse(view)[3]);
+        m_DrawItems.clear();
+        size_t clusterCount = 0;
+        UploadQueue& uploadQueue = UploadQueue::Instance();
+        const bool prioritizeUploads = uploadQueue.GetPendingCount() > 0;
+
+        for (engine::Entity* entity : world->entities) {
+            if (!entity) continue;
+
+            auto* meshRenderer = entity->GetComponent<engine::MeshRendererComponent>();
+            if (!meshRenderer) continue;
+            if (!meshRenderer->mesh) continue;
+            if (!meshRenderer->material) continue;
+            if (!meshRenderer->material->shader) continue;
+
+            DrawItem item;
+            item.meshRenderer = meshRenderer;
+            item.model = entity->GetWorldTransform();
+
+            const Mesh& mesh = *meshRenderer->mesh;
+            const glm::vec3 scaleAxes(glm::length(glm::vec3(item.model[0])),
+                                      glm::length(glm::vec3(item.model[1])),
+                                      glm::length(glm::vec3(item.model[2])));
+            item.maxScale = std::max(scaleAxes.x, std::max(scaleAxes.y, scaleAxes.z));
+
+            const glm::vec3 center = glm::vec3(item.model * glm::vec4(mesh.GetBoundsCenter(), 1.0f));
+            const float radius = mesh.GetBoundsRadius() * item.maxScale;
+            if (!frustum.IntersectsSphere(center, radius)) {
+                RenderStats::Current().culledObjects++;
+                continue;
+            }
+
+            if (prioritizeUploads) {
+                // Projected radius as a fraction of the viewport height
+                const float importance = radius * projection[1][1] /
+                                         std::max(glm::length(center - eye), std::max(radius, 1e-4f));
+                mesh.PrioritizeUpload(importance);
+                meshRenderer->material->PrioritizeUploads(importance);
+            }
+
+            if (m_ClusterCullingEnabled && !mesh.GetMeshlets().empty()) {
+                // Cones are only valid under uniform scale and when back faces are culled.
+                // A mirror flips winding, which the column lengths in scaleAxes can't show
+                const PipelineState& state = meshRenderer->material->pipelineState;
+                const float minScale = std::min(scaleAxes.x, std::min(scaleAxes.y, scaleAxes.z));
+                item.coneCulling = state.faceCulling && state.cullFace == GL_BACK &&
+                                   minScale >= item.maxScale * kUniformScaleTolerance &&
+                                   glm::determinant(glm::mat3(item.model)) > 0.0f;
+                item.firstCluster = clusterCount;
+                clusterCount += mesh.GetMeshlets().size();
+            }
+            m_DrawItems.push_back(item);
+        }
+
+        if (clusterCount > 0) {
+            cullClusters(frustum, eye, clusterCount);
+        }
+
+        buildDrawBatches();
+
+        for (const DrawBatch& batch : m_DrawBatches) {
+            const DrawItem& item = m_DrawItems[batch.item];
+            engine::MeshRendererComponent* meshRenderer = item.meshRenderer;
+            engine::Material* material = meshRenderer->material.get();
+            engine::Shader* shader = material->shader.get();
+            const bool instanced = batch.instanceCount > 1;
+
+            // Bind state & shader
+            material->Bind();
+
+            // IMPORTANT: these names must match the GLSL uniforms
+            shader->setMat4("uProj",  glm::value_ptr(projection));
+            shader->setMat4("uView",  glm::value_ptr(view));
+            shader->setBool("uInstanced", instanced);
+            if (!instanced) {
+                shader->setMat4("uModel", glm::value_ptr(item.model));
+            }
+
+            // ---- PSX shader knobs (harmless if uniforms don't exist) ----
+            shader->setVec2("uViewportSize", glm::vec2((float)width, (float)height));
+
+            // PS1-ish snap grid (tweak)
+            shader->setVec2("uSnapRes", glm::vec2((float)width * 0.5f, (float)height * 0.5f));
+            shader->setFloat("uSnapStrength", 1.0f);
+
+            // Material ID for the post pass (0 = untouched)
+            GLuint materialID = 0;
+            PostProcessParams postParams;
+            if (usePostPass && material->GetPostProcessParams(postParams)) {
+                materialID = postPass->RegisterParams(postParams);
+            }
+            shader->setUInt("uMaterialID", materialID);
+
+            // Material-specific uniforms (tint, etc.)
+            {
+                ENGINE_PROFILE_SCOPE("Material::Setup");
+                material->Setup();
+                if (!meshRenderer->overrides.Empty()) material->ApplyOverrides(meshRenderer->overrides);
+            }
+
+            // Draw mesh (only the surviving clusters when it has any)
+            if (instanced) {
+                meshRenderer->mesh->DrawInstanced(*shader, *instanceVbo, batch.firstInstance * sizeof(glm::mat4),
+                                                  static_cast<GLsizei>(batch.instanceCount));
+            } else if (item.firstCluster != DrawItem::NoClusters) {
+                meshRenderer->mesh->DrawMeshlets(*shader, &m_ClusterVisibility[item.firstCluster]);
+            } else {
+                meshRenderer->mesh->Draw(*shader);
+            }
+            RenderStats::Current().visibleObjects += batch.instanceCount;
+        }
+    } // Geometry pass
+
+    if (usePostPass) {
+        ENGINE_PROFILE_SCOPE("PostProcessPass::End");
+        ENGINE_PROFILE_GPU_PASS(*gpuProfiler, "PostProcess");
+        postPass->End(projection);
+    }
+
+    // Spend this frame's upload budget, biggest on-screen objects first
+    UploadQueue::Instance().Process();
+
+    // Evict whatever is over budget and wasn't drawn this frame
+    ResidencyManager::Instance().EndFrame();
 
-    // Loop over entities
-    for (engine::Entity* entity : world->entities) {
-        if (!entity) continue;
+    const std::chrono::duration<double, std::milli> submitTime =
+        std::chrono::steady_clock::now() - submitStart;
+    EndFrameStats(submitTime.count());
+}
 
-        auto* meshRenderer = entity->GetComponent<engine::MeshRendererComponent>();
-        if (!meshRenderer) continue;
-        if (!meshRenderer->mesh) continue;
-        if (!meshRenderer->material) continue;
+void Renderer::cullClusters(const Frustum& frustum, const glm::vec3& eye, size_t clusterCount) {
+    ENGINE_PROFILE_SCOPE("Renderer::CullClusters");
+
+    m_ClusterVisibility.assign(clusterCount, 0);
+    std::atomic<uint32_t> culled{0};
+
+    // Batches never straddle two objects, so each one resolves its transform once
+    struct Batch { const DrawItem* item; size_t first; size_t count; };
+    std::vector<Batch> batches;
+    for (const DrawItem& item : m_DrawItems) {
+        if (item.firstCluster == DrawItem::NoClusters) continue;
+        const size_t meshletCount = item.meshRenderer->mesh->GetMeshlets().size();
+        for (size_t first = 0; first < meshletCount; first += kClusterBatchSize) {
+            batches.push_back({&item, first, std::min(kClusterBatchSize, meshletCount - first)});
+        }
+    }
 
-        engine::Material* material = meshRenderer->material.get();
-        if (!material->shader) continue;
+    JobSystem::Instance().ParallelFor(batches.size(), 1, [&](size_t begin, size_t end) {
+        uint32_t batchCulled = 0;
+        for (size_t b = begin; b < end; ++b) {
+            const Batch& batch = batches[b];
+            const DrawItem& item = *batch.item;
+            const auto& meshlets = item.meshRenderer->mesh->GetMeshlets();
+            const glm::mat3 rotation(item.model);
+            uint8_t* visible = &m_ClusterVisibility[item.firstCluster];
+
+            for (size_t m = batch.first; m < batch.first + batch.count; ++m) {
+                const Meshlet& meshlet = meshlets[m];
+                const glm::vec3 center = glm::vec3(item.model * glm::vec4(meshlet.center, 1.0f));
+                const float radius = meshlet.radius * item.maxScale;
+
+                bool keep = frustum.IntersectsSphere(center, radius);
+                if (keep && item.coneCulling && meshlet.coneCutoff < 1.0f) {
+                    const glm::vec3 axis = glm::normalize(rotation * meshlet.coneAxis);
+                    const glm::vec3 toCenter = center - eye;
+                    keep = glm::dot(toCenter, axis) < meshlet.coneCutoff * glm::length(toCenter) + radius;
+                }
+
+                visible[m] = keep ? 1 : 0;
+                if (!keep) batchCulled++;
+            }
+        }
+        culled.fetch_add(batchCulled, std::memory_order_relaxed);
+    });
+
+    RenderStats& stats = RenderStats::Current();
+    stats.clustersTested += static_cast<uint32_t>(clusterCount);
+    stats.clustersCulled += culled.load();
+}
 
-        engine::Shader* shader = material->shader.get();
+void Renderer::buildDrawBatches() {
+    ENGINE_PROFILE_SCOPE("Renderer::BuildDrawBatches");
+
+    m_DrawBatches.clear();
+    m_ItemBatch.assign(m_DrawItems.size(), 0);
+    m_InstanceMatrices.clear();
+    // Slots unused last frame go, so meshes unloaded since (world streaming) don't accumulate
+    for (auto it = m_BatchesByMesh.begin(); it != m_BatchesByMesh.end();) {
+        if (it->second.empty()) {
+            it = m_BatchesByMesh.erase(it);
+        } else {
+            it->second.clear();
+            ++it;
+        }
+    }
 
-        glm::mat4 model = entity->GetWorldTransform();
+    // Group in draw order: a batch is drawn where its first item was.
+    // Cluster-culled and transparent items are always drawn on their own.
+    for (size_t i = 0; i < m_DrawItems.size(); ++i) {
+        const DrawItem& item = m_DrawItems[i];
+        const Material& material = *item.meshRenderer->material;
+        const bool batchable = m_InstancingEnabled && item.firstCluster == DrawItem::NoClusters &&
+                               !material.transparent && material.shader->getAttrib("aInstanceModel");
+
+        size_t batchIndex = m_DrawBatches.size();
+        if (batchable) {
+            // Renderers sharing a material batch without comparing its fields
+            std::vector<size_t>& candidates = m_BatchesByMesh[item.meshRenderer->mesh];
+            for (size_t candidate : candidates) {
+                const MeshRendererComponent& first = *m_DrawItems[m_DrawBatches[candidate].item].meshRenderer;
+                if (first.overrides == item.meshRenderer->overrides &&
+                    (first.material.get() == &material || first.material->CanInstanceWith(material))) {
+                    batchIndex = candidate;
+                    break;
+                }
+            }
+            if (batchIndex == m_DrawBatches.size()) candidates.push_back(batchIndex);
+        }
+
+        if (batchIndex == m_DrawBatches.size()) {
+            DrawBatch& batch = m_DrawBatches.emplace_back();
+            batch.item = i;
+        } else {
+            m_DrawBatches[batchIndex].instanceCount++;
+        }
+        m_ItemBatch[i] = batchIndex;
+    }
 
-        // Bind state & shader
-        material->Bind();
+    // Matrices of each instanced batch are contiguous; one upload per frame
+    size_t instanceCount = 0;
+    for (DrawBatch& batch : m_DrawBatches) {
+        if (batch.instanceCount < 2) continue;
+        batch.firstInstance = instanceCount;
+        instanceCount += batch.instanceCount;
+    }
+    if (instanceCount == 0) return;
+
+    m_InstanceMatrices.resize(instanceCount);
+    std::vector<size_t> cursor(m_DrawBatches.size());
+    for (size_t b = 0; b < m_DrawBatches.size(); ++b) cursor[b] = m_DrawBatches[b].firstInstance;
+    for (size_t i = 0; i < m_DrawItems.size(); ++i) {
+        const DrawBatch& batch = m_DrawBatches[m_ItemBatch[i]];
+        if (batch.instanceCount < 2) continue;
+        m_InstanceMatrices[cursor[m_ItemBatch[i]]++] = m_DrawItems[i].model;
+    }
 
-        // IMPORTANT: these names must match the GLSL uniforms
-        shader->setMat4("uProj",  glm::value_ptr(projection));
-        shader->setMat4("uView",  glm::value_ptr(view));
-        shader->setMat4("uModel", glm::value_ptr(model));
+    // Orphaned every frame, so the driver never waits on last frame's draws
+    instanceVbo->SetData(m_InstanceMatrices.data(),
+                         static_cast<GLsizeiptr>(sizeof(glm::mat4) * m_InstanceMatrices.size()), GL_STREAM_DRAW);
+}
 
-        // ---- PSX shader knobs (harmless if uniforms don't exist) ----
-        shader->setVec2("uViewportSize", glm::vec2((float)width, (float)height));
+void Renderer::EndFrameStats(double cpuSubmitMs) {
+    RenderStats& current = RenderStats::Current();
+    current.cpuSubmitMs = cpuSubmitMs;
 
-        // PS1-ish snap grid (tweak)
-        shader->setVec2("uSnapRes", glm::vec2((float)width * 0.5f, (float)height * 0.5f));
-        shader->setFloat("uSnapStrength", 1.0f);
+    m_LastFrameStats = current;
+    m_StatsHistory[m_StatsHistoryHead] = current;
+    m_StatsHistoryHead = (m_StatsHistoryHead + 1) % StatsHistorySize;
+    if (m_StatsHistoryCount < StatsHistorySize) m_StatsHistoryCount++;
 
-        // Optional: posterize + dithering (only affects PSX frag shader)
-        shader->setFloat("uColorSteps", 31.0f);
-        shader->setFloat("uDitherStrength", 0.35f);
+    // Anything uploaded between frames is attributed to the next one
+    current.Reset();
+}
 
+std::vector<RenderStats> Renderer::GetStatsHistory() const {
+    std::vector<RenderStats> history;
+    history.reserve(m_StatsHistoryCount);
+    const size_t first = (m_StatsHistoryHead + StatsHistorySize - m_StatsHistoryCount) % StatsHistorySize;
+    for (size_t i = 0; i < m_StatsHistoryCount; ++i) {
+        history.push_back(m_StatsHistory[(first + i) % StatsHistorySize]);
+    }
+    return history;
+}
 
-        // Material-specific uniforms (tint, etc.)
-        material->Setup();
+RenderStats Renderer::GetAverageStats() const {
+    RenderStats sum;
+    if (m_StatsHistoryCount == 0) return sum;
 
-        // Draw mesh
-        meshRenderer->mesh->Draw(*shader);
+    for (size_t i = 0; i < m_StatsHistoryCount; ++i) {
+        sum += m_StatsHistory[i];
     }
+
+    const auto n = static_cast<uint32_t>(m_StatsHistoryCount);
+    RenderStats avg;
+    avg.drawCalls = sum.drawCalls / n;
+    avg.instances = sum.instances / n;
+    avg.triangles = sum.triangles / n;
+    avg.programBinds = sum.programBinds / n;
+    avg.vaoBinds = sum.vaoBinds / n;
+    avg.textureBinds = sum.textureBinds / n;
+    avg.samplerBinds = sum.samplerBinds / n;
+    avg.uniformUploads = sum.uniformUploads / n;
+    avg.pipelineStateChanges = sum.pipelineStateChanges / n;
+    avg.bytesUploaded = sum.bytesUploaded / n;
+    avg.uploadMs = sum.uploadMs / n;
+    avg.visibleObjects = sum.visibleObjects / n;
+    avg.culledObjects = sum.culledObjects / n;
+    avg.clustersTested = sum.clustersTested / n;
+    avg.clustersCulled = sum.clustersCulled / n;
+    avg.cpuSubmitMs = sum.cpuSubmitMs / n;
+    return avg;
+}
+
+void Renderer::PrintStats(std::ostream& out) const {
+    out << "Last frame:\n";
+    m_LastFrameStats.Print(out);
+    out << "Average over " << m_StatsHistoryCount << " frames:\n";
+    GetAverageStats().Print(out);
 }
 
 
@@ -1,31 +1,223 @@
 #include "Engine/Rendering/Geometry/Mesh/Mesh.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
+#include "Engine/Core/Graphics/Upload/UploadQueue.hpp"
+#include "Engine/Core/Graphics/Upload/UploadThread.hpp"
 #include <glad/glad.h>
+#include <algorithm>
+#include <iostream>
 
 namespace engine {
 
-Mesh::Mesh(std::vector<Vertex> verts, std::vector<unsigned int> inds)
-    : vertices(std::move(verts)), indices(std::move(inds)) {
-    
-    // Bind VAO to record all subsequent buffer operations
-    vao.Bind();
+Mesh::Mesh(const std::vector<Vertex>& verts, const std::vector<unsigned int>& indices,
+           const VertexFormat& vertexFormat, std::vector<Meshlet> clusters)
+    : Mesh(MeshData::Pack(verts, indices, vertexFormat, std::move(clusters))) {
+}
 
-    // Upload vertex data to GPU using RAII VBO wrapper
-    vbo.SetData(vertices.data(), 
-                vertices.size() * sizeof(Vertex), 
-                GL_STATIC_DRAW);
+Mesh::Mesh(MeshData meshData) : ResidentAsset(AssetCategory::Mesh), data(std::move(meshData)) {
+    upload();
+}
 
-    // Upload index data to GPU using RAII EBO wrapper
-    ebo.SetData(indices.data(), 
-                indices.size() * sizeof(unsigned int), 
-                GL_STATIC_DRAW);
+struct Mesh::PendingUpload {
+    // Keeps the bytes alive even if the mesh goes away mid-upload
+    std::shared_ptr<const void> storage;
+    const uint8_t* vertexBytes = nullptr;
+    size_t vertexSize = 0;
+    const uint8_t* indexBytes = nullptr;
+    size_t indexSize = 0;
+    GLuint vbo = 0;
+    GLuint ebo = 0;
+    bool done = false;       // Render thread only (set when published)
+    bool abandoned = false;  // Render thread only (mesh destroyed first)
+    size_t uploadedBytes = 0;  // UploadQueue progress (vertices, then indices)
 
-    // Unbind VAO to prevent accidental modification during initialization
-    // This is safe here because we're not in the render loop
-    vao.Unbind();
+    // UploadQueue step: allocate both buffers, then fill them one chunk at a time
+    size_t uploadChunk(bool& finished) {
+        const size_t totalBytes = vertexSize + indexSize;
+
+        if (uploadedBytes == 0) {
+            glBindBuffer(GL_COPY_WRITE_BUFFER, vbo);
+            glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(vertexSize), nullptr, GL_STATIC_DRAW);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, ebo);
+            glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(indexSize), nullptr, GL_STATIC_DRAW);
+        }
+
+        size_t size = 0;
+        if (uploadedBytes < vertexSize) {
+            size = std::min(UploadQueue::ChunkBytes, vertexSize - uploadedBytes);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, vbo);
+            glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(uploadedBytes),
+                            static_cast<GLsizeiptr>(size), vertexBytes + uploadedBytes);
+        } else if (uploadedBytes < totalBytes) {
+            const size_t offset = uploadedBytes - vertexSize;
+            size = std::min(UploadQueue::ChunkBytes, indexSize - offset);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, ebo);
+            glBufferSubData(GL_COPY_WRITE_BUFFER, static_cast<GLintptr>(offset),
+                            static_cast<GLsizeiptr>(size), indexBytes + offset);
+        }
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+        uploadedBytes += size;
+        RenderStats::Current().bytesUploaded += size;
+        if (uploadedBytes >= totalBytes) {
+            done = true;
+            finished = true;
+        }
+        return size;
+    }
+};
+
+void Mesh::upload() {
+    // Share the bytes with the upload; the mesh may drop its own reference first
+    auto pending = std::make_shared<PendingUpload>();
+    pending->storage = data.storage;
+    pending->vertexBytes = data.vertexBytes;
+    pending->vertexSize = data.vertexSize;
+    pending->indexBytes = data.indexBytes;
+    pending->indexSize = data.indexSize;
+    pendingUpload = pending;
+
+    UploadThread& uploader = UploadThread::Instance();
+    if (uploader.IsRunning()) {
+        uploader.Submit([pending]() {
+            GLuint buffers[2];
+            glGenBuffers(2, buffers);
+
+            // Element buffers can't be bound without a VAO in core profile,
+            // and VAOs aren't shared anyway: fill both through the copy target
+            glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[0]);
+            glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(pending->vertexSize),
+                         pending->vertexBytes, GL_STATIC_DRAW);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, buffers[1]);
+            glBufferData(GL_COPY_WRITE_BUFFER, static_cast<GLsizeiptr>(pending->indexSize),
+                         pending->indexBytes, GL_STATIC_DRAW);
+            glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+            pending->vbo = buffers[0];
+            pending->ebo = buffers[1];
+        }, [pending]() {
+            if (pending->abandoned) {
+                const GLuint buffers[2] = {pending->vbo, pending->ebo};
+                glDeleteBuffers(2, buffers);
+                return;
+            }
+            pending->done = true;
+            RenderStats::Current().bytesUploaded += pending->vertexSize + pending->indexSize;
+        });
+        return;
+    }
+
+    // Render thread: fill our own buffers a chunk at a time through the
+    // UploadQueue so big loads are spread over several frames
+    pending->vbo = vbo.GetID();
+    pending->ebo = ebo.GetID();
+    UploadQueue::Instance().Enqueue(pending.get(), [pending](bool& done) -> size_t {
+        if (pending->abandoned) {
+            // Our buffers were deleted along with the mesh
+            done = true;
+            return 0;
+        }
+        return pending->uploadChunk(done);
+    });
+}
+
+void Mesh::PrioritizeUpload(float importance) const {
+    if (pendingUpload) {
+        UploadQueue::Instance().SetImportance(pendingUpload.get(), importance);
+    }
 }
 
 Mesh::~Mesh() {
-    // RAII: VAO, VBO, and EBO destructors handle OpenGL cleanup automatically
+    // RAII: VAO, VBO, and EBO destructors handle OpenGL cleanup automatically;
+    // buffers still on the upload thread are deleted when they're published,
+    // and queued chunks are skipped
+    if (pendingUpload && !pendingUpload->done) {
+        pendingUpload->abandoned = true;
+    } else if (pendingUpload && pendingUpload->vbo != vbo.GetID()) {
+        // Published by the upload thread but never adopted (not drawn since)
+        const GLuint buffers[2] = {pendingUpload->vbo, pendingUpload->ebo};
+        glDeleteBuffers(2, buffers);
+    }
+}
+
+bool Mesh::adoptPendingUpload() {
+    if (!pendingUpload->done) return false;
+
+    // Buffers from the UploadThread replace ours; the UploadQueue filled ours in place
+    if (pendingUpload->vbo != vbo.GetID()) {
+        vbo = VBO(pendingUpload->vbo);
+        ebo = EBO(pendingUpload->ebo);
+    }
+
+    // The VAO belongs to this context, so the element buffer is attached here
+    vao.Bind();
+    ebo.Bind();
+    vao.Unbind();
+    configuredShaders.clear();
+
+    pendingUpload.reset();
+    ReleaseCpu();
+    return true;
+}
+
+void Mesh::SetReloadSource(ReloadSource source) {
+    reloadSource = std::move(source);
+    ReleaseCpu();
+}
+
+void Mesh::SetKeepCpuData(bool keep) {
+    keepCpuData = keep;
+    ReleaseCpu();
+}
+
+void Mesh::CopyCpuData(std::vector<uint8_t>& outVertexData, std::vector<uint8_t>& outIndexData) const {
+    outVertexData.assign(data.vertexBytes, data.vertexBytes + (data.vertexBytes ? data.vertexSize : 0));
+    outIndexData.assign(data.indexBytes, data.indexBytes + (data.indexBytes ? data.indexSize : 0));
+}
+
+size_t Mesh::GetGpuBytes() const {
+    return IsResident() ? data.vertexSize + data.indexSize : 0;
+}
+
+size_t Mesh::GetCpuBytes() const {
+    return HasCpuData() ? data.vertexSize + data.indexSize : 0;
+}
+
+bool Mesh::CanEvictGpu() const {
+    return !pendingUpload && (HasCpuData() || reloadSource);
+}
+
+void Mesh::EvictGpu() {
+    // Fresh (empty) names; the old buffers are deleted by the move assignments
+    vao = VAO();
+    vbo = VBO();
+    ebo = EBO();
+    configuredShaders.clear();
+}
+
+bool Mesh::RestoreGpu() {
+    if (!HasCpuData()) {
+        std::vector<uint8_t> vertexData, indexData;
+        if (!reloadSource || !reloadSource(vertexData, indexData) ||
+            vertexData.size() != data.vertexSize || indexData.size() != data.indexSize) {
+            std::cerr << "Mesh: failed to reload evicted mesh data\n";
+            return false;
+        }
+        data.SetBytes(std::move(vertexData), std::move(indexData));
+    }
+
+    // The CPU copy is released again once the upload is adopted
+    upload();
+    return true;
+}
+
+size_t Mesh::ReleaseCpu() {
+    // An upload in flight holds its own reference; release once it's adopted
+    if (keepCpuData || !reloadSource || !HasCpuData() || pendingUpload) return 0;
+
+    const size_t bytes = GetCpuBytes();
+    data.ReleaseBytes();
+    return bytes;
 }
 
 void Mesh::configureForShader(const Shader& shader) {
@@ -41,13 +233,22 @@ void Mesh::configureForShader(const Shader& shader) {
     vao.Bind();
     vbo.Bind(); // Must bind VBO so attribute pointers reference it
     
-    GLsizei stride = sizeof(Vertex);
+    const VertexFormat& format = data.format;
+    const GLsizei stride = format.Stride();
+    const GLboolean normalized = format.Normalized();
     
     // Configure attributes using shader's reflection system
-    // AddAttribute will check if the attribute exists in the shader
-    vao.AddAttribute(shader, "aPosition", stride, 0);
-    vao.AddAttribute(shader, "aNormal", stride, offsetof(Vertex, Normal));
-    vao.AddAttribute(shader, "aTexCoords", stride, offsetof(Vertex, TexCoords));
+    // AddAttribute will check if the attribute exists in the shader;
+    // attributes missing from the format stay disabled (constant value)
+    vao.AddAttribute(shader, "aPosition", 3, format.PositionType(), normalized, stride, 0);
+    if (format.hasNormals) {
+        vao.AddAttribute(shader, "aNormal", 2, format.NormalType(), normalized, stride,
+                         format.NormalOffset());
+    }
+    if (format.hasTexCoords) {
+        vao.AddAttribute(shader, "aTexCoords", 2, format.TexCoordType(), GL_FALSE, stride,
+                         format.TexCoordOffset());
+    }
     
     // Unbind to prevent accidental modification
     vao.Unbind();
@@ -56,23 +257,138 @@ void Mesh::configureForShader(const Shader& shader) {
     configuredShaders.insert(shaderID);
 }
 
+void Mesh::DrawMeshlets(const Shader& shader, const uint8_t* visible) {
+    ENGINE_PROFILE_SCOPE("Mesh::DrawMeshlets");
+    if (!MarkUsed()) return;
+    if (pendingUpload && !adoptPendingUpload()) return;
+
+    configureForShader(shader);
+    shader.use();
+    shader.setVec3("uPosScale", data.posScale);
+    shader.setVec3("uPosOffset", data.posOffset);
+    vao.Bind();
+
+    RenderStats& stats = RenderStats::Current();
+    const std::vector<Meshlet>& meshlets = data.meshlets;
+    const size_t indexSize = data.indexType == GL_UNSIGNED_SHORT ? sizeof(uint16_t) : sizeof(uint32_t);
+
+    // Merge runs of visible meshlets that are adjacent in the index buffer
+    size_t m = 0;
+    while (m < meshlets.size()) {
+        if (!visible[m]) { ++m; continue; }
+
+        const GLint baseVertex = data.meshletBaseVertex[m];
+        const size_t first = meshlets[m].firstIndex;
+        size_t count = 0;
+        while (m < meshlets.size() && visible[m] && data.meshletBaseVertex[m] == baseVertex &&
+               meshlets[m].firstIndex == first + count) {
+            count += meshlets[m].indexCount;
+            ++m;
+        }
+
+        const void* offset = reinterpret_cast<const void*>(first * indexSize);
+        if (baseVertex == 0) {
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(count), data.indexType, offset);
+        } else {
+            glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(count), data.indexType, offset, baseVertex);
+        }
+        stats.drawCalls++;
+        stats.triangles += count / 3;
+    }
+    stats.instances++;
+}
+
+void Mesh::DrawInstanced(const Shader& shader, VBO& instances, size_t byteOffset, GLsizei count) {
+    ENGINE_PROFILE_SCOPE("Mesh::DrawInstanced");
+    if (count <= 0) return;
+
+    const Shader::ReflectedAttribs* instanceModel = shader.getAttrib("aInstanceModel");
+    if (!instanceModel) return;
+
+    if (!MarkUsed()) return;
+    if (pendingUpload && !adoptPendingUpload()) return;
+
+    configureForShader(shader);
+    shader.use();
+    shader.setVec3("uPosScale", data.posScale);
+    shader.setVec3("uPosOffset", data.posOffset);
+    vao.Bind();
+
+    // A mat4 input takes four consecutive locations, one column each,
+    // advanced once per instance instead of per vertex
+    instances.Bind();
+    for (GLuint column = 0; column < 4; ++column) {
+        const GLuint location = static_cast<GLuint>(instanceModel->location) + column;
+        glEnableVertexAttribArray(location);
+        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+                              reinterpret_cast<const void*>(byteOffset + column * sizeof(glm::vec4)));
+        glVertexAttribDivisor(location, 1);
+    }
+
+    for (const MeshData::DrawRange& range : data.drawRanges) {
+        const void* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(range.byteOffset));
+        if (range.baseVertex == 0) {
+            glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(range.count), data.indexType, offset, count);
+        } else {
+            glDrawElementsInstancedBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(range.count), data.indexType,
+                                              offset, count, range.baseVertex);
+        }
+    }
+
+    // Back to what Draw() expects: the instance columns unused (they'd
+    // otherwise keep pointing into this frame's instance buffer)
+    for (GLuint column = 0; column < 4; ++column) {
+        const GLuint location = static_cast<GLuint>(instanceModel->location) + column;
+        glVertexAttribDivisor(location, 0);
+        glDisableVertexAttribArray(location);
+    }
+
+    RenderStats& stats = RenderStats::Current();
+    stats.drawCalls += static_cast<uint32_t>(data.drawRanges.size());
+    stats.instances += static_cast<uint32_t>(count);
+    stats.triangles += data.indexCount / 3 * static_cast<size_t>(count);
+}
+
 void Mesh::Draw(const Shader& shader) {
+    ENGINE_PROFILE_SCOPE("Mesh::Draw");
+
+    // Restores the GPU buffers first if the ResidencyManager evicted them
+    if (!MarkUsed()) return;
+
+    // Not drawable until the upload thread's fence has signalled (or the
+    // UploadQueue has written the last chunk)
+    if (pendingUpload && !adoptPendingUpload()) return;
+
     // Lazy configuration: set up attributes if this is first use with this shader
     // This maintains flexibility while minimizing per-frame overhead
     configureForShader(shader);
     
     // Activate shader program
     shader.use();
+
+    // Dequantization for AABB-relative positions
+    shader.setVec3("uPosScale", data.posScale);
+    shader.setVec3("uPosOffset", data.posOffset);
     
     // Bind VAO (contains all vertex attribute state for this mesh)
     vao.Bind();
     
-    // Issue draw call
+    // Issue draw call(s)
     // VAO already has EBO bound, so indices come from there
-    glDrawElements(GL_TRIANGLES, 
-                   static_cast<GLsizei>(indices.size()), 
-                   GL_UNSIGNED_INT, 
-                   0);
+    for (const MeshData::DrawRange& range : data.drawRanges) {
+        const void* offset = reinterpret_cast<const void*>(static_cast<uintptr_t>(range.byteOffset));
+        if (range.baseVertex == 0) {
+            glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(range.count), data.indexType, offset);
+        } else {
+            glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(range.count), data.indexType, offset,
+                                     range.baseVertex);
+        }
+    }
+
+    RenderStats& stats = RenderStats::Current();
+    stats.drawCalls += static_cast<uint32_t>(data.drawRanges.size());
+    stats.instances++;
+    stats.triangles += data.indexCount / 3;
     
     // Note: We don't unbind here for performance
     // The next draw call will bind its own VAO anyway
@@ -0,0 +1,163 @@
+#include "Engine/Rendering/Geometry/Mesh/MeshData.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace engine {
+
+namespace {
+
+constexpr size_t kMaxShortVertices = 65536;  // No primitive restart, so 0xFFFF is usable
+
+// Splitting costs a draw call per chunk; only worth it while the chunk
+// count stays close to the minimum the vertex count requires
+constexpr size_t kMaxChunkOverhead = 2;
+
+// Both byte arrays of a packed mesh, owned together
+struct OwnedBytes {
+    std::vector<uint8_t> vertexData;
+    std::vector<uint8_t> indexData;
+};
+
+void buildIndexData(MeshData& mesh, const std::vector<unsigned int>& indices, std::vector<uint8_t>& indexData) {
+    const std::vector<Meshlet>& meshlets = mesh.meshlets;
+    mesh.indexCount = indices.size();
+    mesh.drawRanges.clear();
+    mesh.meshletBaseVertex.assign(meshlets.size(), 0);
+
+    if (mesh.vertexCount <= kMaxShortVertices) {
+        mesh.indexType = GL_UNSIGNED_SHORT;
+        indexData.resize(indices.size() * sizeof(uint16_t));
+        auto* dst = reinterpret_cast<uint16_t*>(indexData.data());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            dst[i] = static_cast<uint16_t>(indices[i]);
+        }
+        mesh.drawRanges.push_back({static_cast<uint32_t>(indices.size()), 0, 0});
+        return;
+    }
+
+    // Greedy chunking in index order: each chunk's vertex span must fit in 16 bits.
+    // Chunks only break between units - triangles, or whole meshlets so every
+    // meshlet draws with a single base vertex.
+    struct Chunk { size_t first; size_t count; unsigned int minVertex; };
+    std::vector<Chunk> chunks;
+    std::vector<size_t> unitChunk;
+    const size_t minChunks = (mesh.vertexCount + kMaxShortVertices - 1) / kMaxShortVertices;
+    const size_t unitCount = meshlets.empty() ? indices.size() / 3 : meshlets.size();
+    unitChunk.reserve(meshlets.size());
+
+    Chunk current{0, 0, 0};
+    unsigned int lo = 0, hi = 0;
+    bool fits = true;
+    for (size_t u = 0; u < unitCount && fits; ++u) {
+        const size_t first = meshlets.empty() ? u * 3 : meshlets[u].firstIndex;
+        const size_t count = meshlets.empty() ? 3 : meshlets[u].indexCount;
+
+        unsigned int unitLo = indices[first], unitHi = indices[first];
+        for (size_t i = first; i < first + count; ++i) {
+            unitLo = std::min(unitLo, indices[i]);
+            unitHi = std::max(unitHi, indices[i]);
+        }
+        if (static_cast<size_t>(unitHi - unitLo) >= kMaxShortVertices) {
+            fits = false;
+            break;
+        }
+
+        const unsigned int newLo = current.count ? std::min(lo, unitLo) : unitLo;
+        const unsigned int newHi = current.count ? std::max(hi, unitHi) : unitHi;
+        if (current.count && static_cast<size_t>(newHi - newLo) >= kMaxShortVertices) {
+            current.minVertex = lo;
+            chunks.push_back(current);
+            current = Chunk{first, 0, 0};
+            lo = unitLo;
+            hi = unitHi;
+        } else {
+            lo = newLo;
+            hi = newHi;
+        }
+        current.count += count;
+        if (!meshlets.empty()) unitChunk.push_back(chunks.size());
+
+        if (chunks.size() > minChunks * kMaxChunkOverhead) fits = false;
+    }
+    if (current.count) {
+        current.minVertex = lo;
+        chunks.push_back(current);
+    }
+
+    if (!fits || chunks.size() > minChunks * kMaxChunkOverhead) {
+        // Poor locality: one 32-bit draw beats many small ones
+        mesh.indexType = GL_UNSIGNED_INT;
+        indexData.resize(indices.size() * sizeof(uint32_t));
+        std::memcpy(indexData.data(), indices.data(), indexData.size());
+        mesh.drawRanges.push_back({static_cast<uint32_t>(indices.size()), 0, 0});
+        return;
+    }
+
+    mesh.indexType = GL_UNSIGNED_SHORT;
+    indexData.resize(indices.size() * sizeof(uint16_t));
+    auto* dst = reinterpret_cast<uint16_t*>(indexData.data());
+    for (const Chunk& chunk : chunks) {
+        for (size_t i = 0; i < chunk.count; ++i) {
+            dst[chunk.first + i] = static_cast<uint16_t>(indices[chunk.first + i] - chunk.minVertex);
+        }
+        mesh.drawRanges.push_back({static_cast<uint32_t>(chunk.count),
+                                   chunk.first * sizeof(uint16_t),
+                                   static_cast<int32_t>(chunk.minVertex)});
+    }
+    for (size_t m = 0; m < meshlets.size(); ++m) {
+        mesh.meshletBaseVertex[m] = static_cast<int32_t>(chunks[unitChunk[m]].minVertex);
+    }
+}
+
+} // namespace
+
+void MeshData::SetBytes(std::vector<uint8_t> vertexData, std::vector<uint8_t> indexData) {
+    auto owned = std::make_shared<OwnedBytes>();
+    owned->vertexData = std::move(vertexData);
+    owned->indexData = std::move(indexData);
+
+    vertexBytes = owned->vertexData.data();
+    vertexSize = owned->vertexData.size();
+    indexBytes = owned->indexData.data();
+    indexSize = owned->indexData.size();
+    storage = std::move(owned);
+}
+
+void MeshData::ReleaseBytes() {
+    storage.reset();
+    vertexBytes = nullptr;
+    indexBytes = nullptr;
+}
+
+MeshData MeshData::Pack(const std::vector<Vertex>& vertices, const std::vector<unsigned int>& indices,
+                        const VertexFormat& format, std::vector<Meshlet> meshlets) {
+    MeshData mesh;
+    mesh.format = format;
+    mesh.vertexCount = vertices.size();
+    mesh.meshlets = std::move(meshlets);
+
+    // Object-space bounding sphere for whole-mesh culling
+    if (!vertices.empty()) {
+        glm::vec3 boundsMin = vertices[0].Position, boundsMax = vertices[0].Position;
+        for (const auto& v : vertices) {
+            boundsMin = glm::min(boundsMin, v.Position);
+            boundsMax = glm::max(boundsMax, v.Position);
+        }
+        mesh.boundsCenter = (boundsMin + boundsMax) * 0.5f;
+        float radiusSq = 0.0f;
+        for (const auto& v : vertices) {
+            const glm::vec3 d = v.Position - mesh.boundsCenter;
+            radiusSq = std::max(radiusSq, glm::dot(d, d));
+        }
+        mesh.boundsRadius = std::sqrt(radiusSq);
+    }
+
+    std::vector<uint8_t> vertexData = format.Encode(vertices, mesh.posScale, mesh.posOffset);
+    std::vector<uint8_t> indexData;
+    buildIndexData(mesh, indices, indexData);
+    mesh.SetBytes(std::move(vertexData), std::move(indexData));
+    return mesh;
+}
+
+} // namespace engine
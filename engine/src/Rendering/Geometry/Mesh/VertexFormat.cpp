@@ -0,0 +1,131 @@
+#include "Engine/Rendering/Geometry/Mesh/VertexFormat.hpp"
+#include <glm/gtc/packing.hpp>
+#include <cmath>
+#include <cstring>
+
+namespace engine {
+
+namespace {
+
+constexpr size_t kCompactPositionSize = 8;   // 3 x uint16 + pad, keeps 4-byte alignment
+constexpr size_t kCompactNormalSize = 4;     // 2 x int16
+constexpr size_t kCompactTexCoordSize = 4;   // 2 x half
+
+constexpr size_t kFullPositionSize = 12;
+constexpr size_t kFullNormalSize = 8;
+constexpr size_t kFullTexCoordSize = 8;
+
+template <typename T>
+void write(uint8_t* dst, const T& value) {
+    std::memcpy(dst, &value, sizeof(T));
+}
+
+glm::vec2 signNotZero(const glm::vec2& v) {
+    return glm::vec2(v.x >= 0.0f ? 1.0f : -1.0f, v.y >= 0.0f ? 1.0f : -1.0f);
+}
+
+} // namespace
+
+glm::vec2 OctEncodeNormal(const glm::vec3& n) {
+    const float l1 = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+    if (l1 <= 0.0f) {
+        return glm::vec2(0.0f);  // Missing normal -> decodes to +Z
+    }
+
+    glm::vec2 p = glm::vec2(n.x, n.y) / l1;
+    if (n.z < 0.0f) {
+        p = (1.0f - glm::abs(glm::vec2(p.y, p.x))) * signNotZero(p);
+    }
+    return p;
+}
+
+glm::vec3 OctDecodeNormal(const glm::vec2& e) {
+    glm::vec3 v(e.x, e.y, 1.0f - std::abs(e.x) - std::abs(e.y));
+    if (v.z < 0.0f) {
+        const glm::vec2 xy = (1.0f - glm::abs(glm::vec2(v.y, v.x))) * signNotZero(glm::vec2(v.x, v.y));
+        v.x = xy.x;
+        v.y = xy.y;
+    }
+    return glm::normalize(v);
+}
+
+GLsizei VertexFormat::Stride() const {
+    const bool compact = precision == Precision::Compact;
+    size_t stride = compact ? kCompactPositionSize : kFullPositionSize;
+    if (hasNormals)   stride += compact ? kCompactNormalSize : kFullNormalSize;
+    if (hasTexCoords) stride += compact ? kCompactTexCoordSize : kFullTexCoordSize;
+    return static_cast<GLsizei>(stride);
+}
+
+size_t VertexFormat::NormalOffset() const {
+    return precision == Precision::Compact ? kCompactPositionSize : kFullPositionSize;
+}
+
+size_t VertexFormat::TexCoordOffset() const {
+    const bool compact = precision == Precision::Compact;
+    size_t offset = compact ? kCompactPositionSize : kFullPositionSize;
+    if (hasNormals) offset += compact ? kCompactNormalSize : kFullNormalSize;
+    return offset;
+}
+
+std::vector<uint8_t> VertexFormat::Encode(const std::vector<Vertex>& vertices,
+                                          glm::vec3& posScale,
+                                          glm::vec3& posOffset) const {
+    const size_t stride = static_cast<size_t>(Stride());
+    std::vector<uint8_t> data(stride * vertices.size(), 0);
+
+    posScale = glm::vec3(1.0f);
+    posOffset = glm::vec3(0.0f);
+
+    if (precision == Precision::Full) {
+        for (size_t i = 0; i < vertices.size(); ++i) {
+            uint8_t* dst = data.data() + i * stride;
+            const Vertex& v = vertices[i];
+            write(dst, v.Position);
+            if (hasNormals)   write(dst + NormalOffset(), OctEncodeNormal(v.Normal));
+            if (hasTexCoords) write(dst + TexCoordOffset(), v.TexCoords);
+        }
+        return data;
+    }
+
+    // Quantize positions into the mesh AABB
+    glm::vec3 boundsMin(0.0f), boundsMax(0.0f);
+    if (!vertices.empty()) {
+        boundsMin = boundsMax = vertices[0].Position;
+        for (const auto& v : vertices) {
+            boundsMin = glm::min(boundsMin, v.Position);
+            boundsMax = glm::max(boundsMax, v.Position);
+        }
+    }
+    const glm::vec3 extent = boundsMax - boundsMin;
+    posScale = extent;     // unorm16 arrives in the shader as [0, 1]
+    posOffset = boundsMin;
+
+    const glm::vec3 invExtent(extent.x > 0.0f ? 1.0f / extent.x : 0.0f,
+                              extent.y > 0.0f ? 1.0f / extent.y : 0.0f,
+                              extent.z > 0.0f ? 1.0f / extent.z : 0.0f);
+
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        uint8_t* dst = data.data() + i * stride;
+        const Vertex& v = vertices[i];
+
+        const glm::vec3 unit = glm::clamp((v.Position - boundsMin) * invExtent, 0.0f, 1.0f);
+        const uint16_t position[3] = {
+            static_cast<uint16_t>(unit.x * 65535.0f + 0.5f),
+            static_cast<uint16_t>(unit.y * 65535.0f + 0.5f),
+            static_cast<uint16_t>(unit.z * 65535.0f + 0.5f),
+        };
+        write(dst, position);
+
+        if (hasNormals) {
+            write(dst + NormalOffset(), glm::packSnorm2x16(OctEncodeNormal(v.Normal)));
+        }
+        if (hasTexCoords) {
+            write(dst + TexCoordOffset(), glm::packHalf2x16(v.TexCoords));
+        }
+    }
+
+    return data;
+}
+
+} // namespace engine
@@ -1,10 +1,16 @@
 #include "Engine/Rendering/Materials/Base/Material.hpp"
+#include <typeinfo>
 
 namespace engine {
 
 Material::Material() : shader(nullptr), transparent(false) {
 }
 
+bool Material::SharesStateWith(const Material& other) const {
+    return typeid(*this) == typeid(other) && shader == other.shader &&
+           pipelineState == other.pipelineState && transparent == other.transparent;
+}
+
 void Material::Bind() {
     pipelineState.Apply();  // Now skips redundant calls
     if (shader) {
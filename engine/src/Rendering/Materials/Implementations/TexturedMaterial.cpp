@@ -59,4 +59,28 @@ void TexturedMaterial::Setup() {
     shader->setVec4("uTint", tint);
 }
 
-} // namespace engine
\ No newline at end of file
+void TexturedMaterial::ApplyOverrides(const MaterialOverrides& overrides) {
+    if (shader && overrides.hasTint) {
+        shader->setVec4("uTint", tint * overrides.tint);
+    }
+}
+
+std::unique_ptr<Material> TexturedMaterial::Clone() const {
+    return std::make_unique<TexturedMaterial>(*this);
+}
+
+void TexturedMaterial::PrioritizeUploads(float importance) const {
+    for (const Texture* map : {albedoMap, specularMap, normalMap, emissiveMap}) {
+        if (map) map->PrioritizeUpload(importance);
+    }
+}
+
+bool TexturedMaterial::CanInstanceWith(const Material& other) const {
+    if (!SharesStateWith(other)) return false;
+    const auto& textured = static_cast<const TexturedMaterial&>(other);
+    return albedoMap == textured.albedoMap && specularMap == textured.specularMap &&
+           normalMap == textured.normalMap && emissiveMap == textured.emissiveMap &&
+           sampler == textured.sampler && tint == textured.tint;
+}
+
+} // namespace engine
@@ -12,4 +12,18 @@ void TintedMaterial::Setup() {
     }
 }
 
-} // namespace engine
\ No newline at end of file
+void TintedMaterial::ApplyOverrides(const MaterialOverrides& overrides) {
+    if (shader && overrides.hasTint) {
+        shader->setVec4("uTint", tint * overrides.tint);
+    }
+}
+
+std::unique_ptr<Material> TintedMaterial::Clone() const {
+    return std::make_unique<TintedMaterial>(*this);
+}
+
+bool TintedMaterial::CanInstanceWith(const Material& other) const {
+    return SharesStateWith(other) && tint == static_cast<const TintedMaterial&>(other).tint;
+}
+
+} // namespace engine
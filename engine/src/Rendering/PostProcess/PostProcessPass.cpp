@@ -0,0 +1,187 @@
+#include "Engine/Rendering/PostProcess/PostProcessPass.hpp"
+#include "Engine/Core/Graphics/State/PipelineState.hpp"
+#include "Engine/Core/Graphics/Stats/RenderStats.hpp"
+#include "Engine/Core/Graphics/Texture/Sampler.hpp"
+#include <glm/gtc/type_ptr.hpp>
+#include <iostream>
+
+namespace engine {
+
+namespace {
+
+// Full-screen triangle generated from gl_VertexID (no vertex buffer needed)
+const char* kResolveVertexSource = R"(#version 330 core
+out vec2 vUV;
+
+void main() {
+    vec2 pos = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));
+    vUV = pos;
+    gl_Position = vec4(pos * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+const char* kResolveFragmentSource = R"(#version 330 core
+in vec2 vUV;
+
+uniform sampler2D  uSceneColor;
+uniform usampler2D uMaterialID;
+uniform sampler2D  uSceneDepth;
+uniform mat4 uInvProj;
+
+// Per-material table, indexed by material ID
+uniform vec4 uParams[64];    // x = colorDepth, y = ditherStrength, z = fogStart, w = fogEnd
+uniform vec3 uFogColor[64];
+
+out vec4 FragColor;
+
+// 8x8 Bayer matrix (thresholds out of 64)
+const float kBayer[64] = float[64](
+     0.0, 32.0,  8.0, 40.0,  2.0, 34.0, 10.0, 42.0,
+    48.0, 16.0, 56.0, 24.0, 50.0, 18.0, 58.0, 26.0,
+    12.0, 44.0,  4.0, 36.0, 14.0, 46.0,  6.0, 38.0,
+    60.0, 28.0, 52.0, 20.0, 62.0, 30.0, 54.0, 22.0,
+     3.0, 35.0, 11.0, 43.0,  1.0, 33.0,  9.0, 41.0,
+    51.0, 19.0, 59.0, 27.0, 49.0, 17.0, 57.0, 25.0,
+    15.0, 47.0,  7.0, 39.0, 13.0, 45.0,  5.0, 37.0,
+    63.0, 31.0, 55.0, 23.0, 61.0, 29.0, 53.0, 21.0
+);
+
+void main() {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    vec4 scene = texelFetch(uSceneColor, pixel, 0);
+    uint id = texelFetch(uMaterialID, pixel, 0).r;
+
+    if (id == 0u) {
+        FragColor = scene;
+        return;
+    }
+
+    vec4 params = uParams[id];
+    vec3 color = scene.rgb;
+
+    // === COLOR DEPTH REDUCTION ===
+    color = floor(color * params.x) / params.x;
+
+    // === ORDERED DITHERING ===
+    if (params.y > 0.0) {
+        float brightness = dot(color, vec3(0.299, 0.587, 0.114));
+        int index = (pixel.x & 7) + (pixel.y & 7) * 8;
+        float dither = brightness < kBayer[index] / 64.0 ? 0.0 : 1.0;
+        color += (dither - 0.5) * (params.y / params.x);
+        color = clamp(color, 0.0, 1.0);
+    }
+
+    // === DISTANCE FOG (view depth rebuilt from the depth buffer) ===
+    float depth = texelFetch(uSceneDepth, pixel, 0).r;
+    vec4 viewPos = uInvProj * vec4(vUV * 2.0 - 1.0, depth * 2.0 - 1.0, 1.0);
+    float viewDepth = abs(viewPos.z / viewPos.w);
+    float fogFactor = smoothstep(params.z, params.w, viewDepth);
+    color = mix(color, uFogColor[id], fogFactor);
+
+    FragColor = vec4(color, scene.a);
+}
+)";
+
+} // namespace
+
+PostProcessPass::PostProcessPass() {
+    framebuffer.AddColorAttachment(GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE);       // Lit colour
+    framebuffer.AddColorAttachment(GL_R16UI, GL_RED_INTEGER, GL_UNSIGNED_SHORT); // Material ID
+    framebuffer.EnableDepthAttachment();
+
+    resolveShader = Shader::FromSource(kResolveVertexSource, kResolveFragmentSource);
+
+    frameParams.reserve(MaxMaterials);
+}
+
+PostProcessPass::~PostProcessPass() {
+}
+
+void PostProcessPass::Begin(int width, int height, const glm::vec4& clearColor) {
+    framebuffer.Resize(width, height);
+    framebuffer.Bind();
+
+    // Clears honour the write masks, so force them open and let the next
+    // material re-apply its own pipeline state
+    glDepthMask(GL_TRUE);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    PipelineState::SetCurrent(nullptr);
+
+    const GLuint clearID[4] = {0, 0, 0, 0};
+    const GLfloat clearDepth = 1.0f;
+    glClearBufferfv(GL_COLOR, 0, glm::value_ptr(clearColor));
+    glClearBufferuiv(GL_COLOR, 1, clearID);
+    glClearBufferfv(GL_DEPTH, 0, &clearDepth);
+
+    frameParams.clear();
+    frameParams.emplace_back();  // ID 0 = pass-through
+}
+
+unsigned int PostProcessPass::RegisterParams(const PostProcessParams& params) {
+    // Linear search is fine: the table holds at most MaxMaterials entries
+    for (size_t i = 1; i < frameParams.size(); ++i) {
+        if (frameParams[i] == params) {
+            return static_cast<unsigned int>(i);
+        }
+    }
+
+    if (frameParams.size() >= static_cast<size_t>(MaxMaterials)) {
+        return 0;
+    }
+
+    frameParams.push_back(params);
+    return static_cast<unsigned int>(frameParams.size() - 1);
+}
+
+void PostProcessPass::End(const glm::mat4& projection) {
+    framebuffer.Unbind();
+    glViewport(0, 0, framebuffer.GetWidth(), framebuffer.GetHeight());
+
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_BLEND);
+    glDisable(GL_CULL_FACE);
+    PipelineState::SetCurrent(nullptr);
+
+    resolveShader->use();
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, framebuffer.GetColorTexture(0));
+    Sampler::ClearBinding(0);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, framebuffer.GetColorTexture(1));
+    Sampler::ClearBinding(1);
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, framebuffer.GetDepthTexture());
+    Sampler::ClearBinding(2);
+    RenderStats::Current().textureBinds += 3;
+
+    resolveShader->setInt("uSceneColor", 0);
+    resolveShader->setInt("uMaterialID", 1);
+    resolveShader->setInt("uSceneDepth", 2);
+    resolveShader->setMat4("uInvProj", glm::value_ptr(glm::inverse(projection)));
+
+    // Upload only the slots used this frame
+    std::vector<glm::vec4> packedParams;
+    std::vector<glm::vec3> fogColors;
+    packedParams.reserve(frameParams.size());
+    fogColors.reserve(frameParams.size());
+    for (const auto& p : frameParams) {
+        packedParams.emplace_back(p.colorDepth, p.ditherStrength, p.fogStart, p.fogEnd);
+        fogColors.push_back(p.fogColor);
+    }
+
+    const GLsizei count = static_cast<GLsizei>(frameParams.size());
+    glUniform4fv(resolveShader->getUniformLocation("uParams"), count, glm::value_ptr(packedParams[0]));
+    glUniform3fv(resolveShader->getUniformLocation("uFogColor"), count, glm::value_ptr(fogColors[0]));
+    RenderStats::Current().uniformUploads += 2;
+
+    fullscreenVAO.Bind();
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    RenderStats::Current().drawCalls++;
+    RenderStats::Current().triangles++;
+    fullscreenVAO.Unbind();
+
+    glEnable(GL_DEPTH_TEST);
+}
+
+} // namespace engine
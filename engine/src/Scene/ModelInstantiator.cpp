@@ -0,0 +1,97 @@
+#include "Engine/Scene/ModelInstantiator.hpp"
+#include "Engine/ECS/Components/Rendering/MeshRendererComponent.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+
+#include <cmath>
+
+namespace engine {
+
+namespace {
+
+// cos(y) below this is treated as gimbal lock
+constexpr float kGimbalThreshold = 1e-6f;
+
+} // namespace
+
+glm::vec3 ModelInstantiator::ToEntityRotation(const glm::quat& rotation) {
+    // R = Rx(x) * Ry(y) * Rz(z); glm matrices are indexed [column][row]
+    // cos(y) from the first row (not from asin) stays accurate near +-90 degrees
+    const glm::mat3 m = glm::mat3_cast(glm::normalize(rotation));
+    const float cosY = std::sqrt(m[0][0] * m[0][0] + m[1][0] * m[1][0]);
+
+    glm::vec3 euler;
+    euler.y = std::atan2(m[2][0], cosY);
+    if (cosY > kGimbalThreshold) {
+        euler.x = std::atan2(-m[2][1], m[2][2]);
+        euler.z = std::atan2(-m[1][0], m[0][0]);
+    } else {
+        // X and Z rotate about the same axis: put it all in X
+        euler.x = std::atan2(m[1][2], m[1][1]);
+        euler.z = 0.0f;
+    }
+    return euler;
+}
+
+static void addRenderer(Entity* entity, Model& model, uint32_t mesh,
+                        const ModelInstantiator::MaterialFactory& makeMaterial) {
+    auto* renderer = entity->AddComponent<MeshRendererComponent>();
+    renderer->mesh = &model.meshes[mesh];
+    if (makeMaterial) {
+        renderer->material = makeMaterial(model.hierarchy.GetMeshMaterial(mesh));
+    }
+}
+
+std::vector<Entity*> ModelInstantiator::Instantiate(World& world, Model& model, Entity* root,
+                                                    const MaterialFactory& makeMaterial) {
+    ENGINE_PROFILE_SCOPE("ModelInstantiator::Instantiate");
+    std::vector<Entity*> topLevel;
+
+    auto attach = [&](Entity* entity, Entity* parent) {
+        if (parent) {
+            parent->AddChild(entity);
+        }
+        if (parent == root) topLevel.push_back(entity);
+    };
+
+    const ModelHierarchy& hierarchy = model.hierarchy;
+    if (hierarchy.Empty()) {
+        for (size_t i = 0; i < model.meshes.size(); ++i) {
+            Entity* entity = world.CreateEntity((root ? root->name : std::string("Model")) + "_" + std::to_string(i));
+            attach(entity, root);
+            addRenderer(entity, model, static_cast<uint32_t>(i), makeMaterial);
+        }
+        return topLevel;
+    }
+
+    // Parents come first, so every parent entity exists by the time it's needed
+    std::vector<Entity*> entities(hierarchy.nodes.size(), nullptr);
+    for (size_t i = 0; i < hierarchy.nodes.size(); ++i) {
+        const ModelNode& node = hierarchy.nodes[i];
+        Entity* entity = world.CreateEntity(node.name);
+        entity->position = node.translation;
+        entity->rotation = ToEntityRotation(node.rotation);
+        entity->scale = node.scale;
+        attach(entity, node.parent >= 0 ? entities[node.parent] : root);
+        entities[i] = entity;
+
+        std::vector<uint32_t> meshes;
+        for (uint32_t mesh : node.meshes) {
+            if (mesh < model.meshes.size()) meshes.push_back(mesh);
+        }
+
+        if (meshes.size() == 1) {
+            addRenderer(entity, model, meshes[0], makeMaterial);
+            continue;
+        }
+
+        // Entity::GetComponent only sees one renderer: one child per primitive
+        for (size_t p = 0; p < meshes.size(); ++p) {
+            Entity* primitive = world.CreateEntity(node.name + "_" + std::to_string(p));
+            entity->AddChild(primitive);
+            addRenderer(primitive, model, meshes[p], makeMaterial);
+        }
+    }
+    return topLevel;
+}
+
+} // namespace engine
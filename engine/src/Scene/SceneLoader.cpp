@@ -1,22 +1,35 @@
 #include "Engine/Scene/SceneLoader.hpp"
+#include "Engine/Scene/ModelInstantiator.hpp"
+#include "Engine/Scene/SceneReader.hpp"
 #include "Engine/Assets/Loaders/Shader/ShaderLoader.hpp"
 #include "Engine/Assets/Loaders/Texture/TextureLoader.hpp"
 #include "Engine/Assets/Loaders/Mesh/MeshLoader.hpp"
+#include "Engine/Assets/Residency/ResidencyManager.hpp"
+#include "Engine/Assets/Cache/AssetCache.hpp"
 #include "Engine/ECS/Components/Camera/CameraComponent.hpp"
 #include "Engine/ECS/Components/Rendering/MeshRendererComponent.hpp"
 #include "Engine/Rendering/Materials/Implementations/TintedMaterial.hpp"
 #include "Engine/Rendering/Materials/Implementations/TexturedMaterial.hpp"
 #include "Engine/Core/Graphics/State/PipelineState.hpp"
 #include "Engine/Core/Graphics/Texture/Sampler.hpp"
+#include "Engine/Core/Graphics/Texture/SamplerCache.hpp"
+#include "Engine/Core/Graphics/Shader/ProgramBinaryCache.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
 
 #include <nlohmann/json.hpp>
-#include <fstream>
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <map>
 
 using json = nlohmann::json;
 
 namespace engine {
 
+// Bump when the tables built from JSON change so cached conversions are redone
+static constexpr uint64_t kConvertVersion = 2;
+
 std::string SceneLoader::GetSceneDirectory(const std::string& scenePath) {
     const auto slash = scenePath.find_last_of("/\\");
     if (slash == std::string::npos) return ".";
@@ -33,68 +46,671 @@ std::string SceneLoader::ResolvePath(const std::string& path, const std::string&
     return sceneDir + "/" + path;
 }
 
+static void logSceneLoaded(const World& world, size_t components, double ms, const char* source) {
+    std::cout << "═══════════════════════════════════════\n";
+    std::cout << "✓ Scene loaded: " << world.entities.size() << " entities, " << components << " components in "
+              << ms << " ms (" << source << ")\n";
+    std::cout << "═══════════════════════════════════════\n\n";
+}
+
+struct SceneLoader::SharedMaterials {
+    json named = json::object();  // "assets.materials", once seen
+    std::unordered_map<std::string, std::shared_ptr<Material>> blocks;  // JSON: by block text, or "@name"
+    std::vector<std::shared_ptr<Material>> records;                     // .escene: by record index
+    // Model primitives: (template, source material) -> completed copy, or the template itself
+    std::map<std::pair<const Material*, const ModelMaterial*>, std::shared_ptr<Material>> completed;
+};
+
+// Consumes the SceneReader's events: creates entities and components in the
+// World as they arrive and/or fills the .escene tables for the same scene
+struct SceneLoader::JsonSceneBuilder : SceneReader::Handler {
+    World* world;                 // Null when only converting
+    ESceneFormat::Scene* binary;  // Null when not converting
+    std::string sceneDir;
+
+    std::vector<std::string> assetPaths;  // Found in "assets", for the AssetCache
+    size_t componentCount = 0;
+
+    JsonSceneBuilder(World* world, ESceneFormat::Scene* binary, std::string sceneDir)
+        : world(world), binary(binary), sceneDir(std::move(sceneDir)) {}
+
+    void OnAssets(const json& assetsJson) override {
+        assetPaths = GetAssetPaths(assetsJson, sceneDir);
+        materials.named = assetsJson.value("materials", json::object());
+        if (binary) {
+            FlattenAssets(assetsJson, *binary);
+            fillPlaceholders();
+        }
+        if (!world) return;
+
+        LoadAssets(assetsJson, sceneDir);
+        assetsLoaded = true;
+        flushDeferred();
+    }
+
+    void OnBeginEntity() override {
+        OpenEntity& entry = open.emplace_back();
+        Entity* parent = open.size() > 1 ? open[open.size() - 2].entity : nullptr;
+        if (world) {
+            entry.entity = world->CreateEntity("Entity");
+            if (parent) parent->AddChild(entry.entity);
+        }
+        if (binary) {
+            const int32_t parentRecord = open.size() > 1 ? open[open.size() - 2].record : -1;
+            entry.record = static_cast<int32_t>(binary->entities.size());
+
+            ESceneFormat::EntityRecord record{};
+            record.name = binary->AddString("Entity");
+            record.parent = parentRecord;
+            binary->entities.push_back(record);
+            binary->transforms.push_back({{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}});
+            if (parentRecord >= 0) binary->entities[parentRecord].childCount++;
+        }
+    }
+
+    void OnEntityName(const std::string& name) override {
+        if (open.empty()) return;
+        if (world) open.back().entity->name = name;
+        if (binary) binary->entities[open.back().record].name = binary->AddString(name);
+    }
+
+    void OnTransform(const json& transformJson) override {
+        if (open.empty()) return;
+        if (world) LoadTransform(open.back().entity, transformJson);
+        if (binary) FlattenTransform(transformJson, binary->transforms[open.back().record]);
+    }
+
+    void OnComponent(const json& componentJson) override {
+        if (open.empty()) return;
+        bool known = true;
+        if (binary) {
+            ESceneFormat::ComponentRecord record{};
+            known = FlattenComponent(componentJson, materials.named, *binary, materialIndices, record);
+            if (known) {
+                open.back().components.push_back(record);
+            } else if (!world) {
+                std::cerr << "Warning: Unknown component type: " << componentJson.value("type", "") << "\n";
+            }
+        }
+        if (world) {
+            // Meshes and materials name assets: wait for them if they come later in the file
+            if (assetsLoaded) {
+                known = LoadComponent(world, open.back().entity, componentJson, materials);
+            } else {
+                deferred.emplace_back(open.back().entity, componentJson);
+            }
+        }
+        if (known) componentCount++;
+    }
+
+    void OnEndEntity() override {
+        if (open.empty()) return;
+        if (binary) {
+            // Written last: a child's components may have been appended in between
+            ESceneFormat::EntityRecord& record = binary->entities[open.back().record];
+            record.firstComponent = static_cast<uint32_t>(binary->components.size());
+            record.componentCount = static_cast<uint32_t>(open.back().components.size());
+            binary->components.insert(binary->components.end(), open.back().components.begin(),
+                                      open.back().components.end());
+        }
+        open.pop_back();
+    }
+
+    // After the last event: a scene without "assets" gets its deferred
+    // components here, and unresolved material names are dropped
+    void Finish() {
+        if (world) flushDeferred();
+        if (binary) dropUnresolved();
+    }
+
+private:
+    struct OpenEntity {
+        Entity* entity = nullptr;
+        int32_t record = -1;
+        std::vector<ESceneFormat::ComponentRecord> components;
+    };
+    std::vector<OpenEntity> open;  // Innermost last
+    std::unordered_map<std::string, int32_t> materialIndices;  // Block text or "@name" -> record
+    SharedMaterials materials;
+
+    bool assetsLoaded = false;
+    std::vector<std::pair<Entity*, json>> deferred;  // Components seen before "assets"
+
+    void flushDeferred() {
+        for (const auto& [entity, componentJson] : deferred) {
+            if (!LoadComponent(world, entity, componentJson, materials)) componentCount--;
+        }
+        deferred.clear();
+    }
+
+    // Named materials used before "assets" declared them
+    void fillPlaceholders() {
+        for (const auto& [key, index] : materialIndices) {
+            if (key[0] != '@') continue;
+            auto named = materials.named.find(key.substr(1));
+            if (named != materials.named.end()) binary->materials[index] = FlattenMaterialRecord(*named, *binary);
+        }
+    }
+
+    // Components naming a material "assets" never declared get none, as when loading
+    void dropUnresolved() {
+        for (const auto& [key, index] : materialIndices) {
+            if (key[0] != '@' || materials.named.contains(key.substr(1))) continue;
+            if (!world) std::cerr << "Warning: Material not found: " << key.substr(1) << "\n";
+            for (ESceneFormat::ComponentRecord& component : binary->components) {
+                if (component.material == index) component.material = -1;
+            }
+        }
+    }
+};
+
 std::unique_ptr<World> SceneLoader::LoadScene(const std::string& path) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::LoadScene");
+
     std::cout << "═══════════════════════════════════════\n";
     std::cout << "Loading scene: " << path << "\n";
     std::cout << "═══════════════════════════════════════\n";
     
-    std::ifstream file(path);
-    if (!file.is_open()) {
-        std::cerr << "ERROR: Failed to open scene file: " << path << "\n";
+    const std::string sceneDir = GetSceneDirectory(path);
+    auto& cache = AssetCache::Instance();
+    if (ESceneFormat::IsEScenePath(path)) {
+        auto world = LoadBinaryScene(path, sceneDir);
+        cache.SaveIndex();
+        return world;
+    }
+
+    // Converted before from the same contents: skip the JSON entirely
+    const uint64_t key = cache.ComputeKey(AssetCache::AssetType::Scene, path, kConvertVersion);
+    const std::string derived = cache.FindDerived(key, ESceneFormat::Extension);
+    if (!derived.empty()) {
+        if (auto world = LoadBinaryScene(derived, sceneDir)) {
+            cache.SaveIndex();
+            return world;
+        }
+    }
+
+    auto world = LoadJsonScene(path, sceneDir);
+
+    // File hashes learned by this load make the next start a stat per file
+    cache.SaveIndex();
+    return world;
+}
+
+std::unique_ptr<World> SceneLoader::LoadScene(const json& sceneJson, const std::string& sceneDir) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::LoadScene");
+
+    const auto start = std::chrono::steady_clock::now();
+    auto world = std::make_unique<World>();
+    JsonSceneBuilder builder(world.get(), nullptr, sceneDir);
+    if (!SceneReader::Walk(sceneJson, builder)) {
         return nullptr;
     }
-    
-    json sceneJson;
-    try {
-        file >> sceneJson;
-    } catch (const std::exception& e) {
-        std::cerr << "ERROR: Failed to parse scene JSON: " << e.what() << "\n";
+    builder.Finish();
+
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    logSceneLoaded(*world, builder.componentCount, elapsed.count(), "json");
+    return world;
+}
+
+std::unique_ptr<World> SceneLoader::LoadJsonScene(const std::string& path, const std::string& sceneDir) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::LoadJsonScene");
+
+    // Entities are created as the parser reaches them; when the cache is on,
+    // the .escene tables are filled in the same pass
+    auto& cache = AssetCache::Instance();
+    const auto start = std::chrono::steady_clock::now();
+    auto world = std::make_unique<World>();
+    ESceneFormat::Scene binary;
+    JsonSceneBuilder builder(world.get(), cache.IsEnabled() ? &binary : nullptr, sceneDir);
+    if (!SceneReader::Read(path, builder)) {
         return nullptr;
     }
-    
-    const std::string sceneDir = GetSceneDirectory(path);
-    
-    // Load assets first
-    if (sceneJson.contains("assets")) {
-        LoadAssets(sceneJson["assets"], sceneDir);
+    builder.Finish();
+
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    logSceneLoaded(*world, builder.componentCount, elapsed.count(), "json");
+
+    // Keyed once the scene's dependencies are known
+    cache.SetDependencies(path, std::move(builder.assetPaths));
+    if (cache.IsEnabled()) {
+        cache.StoreDerived(cache.ComputeKey(AssetCache::AssetType::Scene, path, kConvertVersion),
+                           ESceneFormat::Extension,
+                           [&](const std::string& out) { return ESceneFormat::Write(out, binary); });
     }
-    
-    // Create world
-    auto world = std::make_unique<World>();
-    
-    // Load entities
-    if (sceneJson.contains("entities")) {
-        LoadEntities(world.get(), sceneJson["entities"]);
+    return world;
+}
+
+std::unique_ptr<World> SceneLoader::LoadBinaryScene(const std::string& path, const std::string& sceneDir) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::LoadBinaryScene");
+
+    ESceneFormat::View scene;
+    if (!ESceneFormat::Read(path, scene)) {
+        return nullptr;
     }
+
+    LoadAssets(scene, sceneDir);
+
+    const auto start = std::chrono::steady_clock::now();
+    auto world = std::make_unique<World>();
+    LoadEntities(world.get(), scene);
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
     
-    std::cout << "═══════════════════════════════════════\n";
-    std::cout << "✓ Scene loaded successfully\n";
-    std::cout << "═══════════════════════════════════════\n\n";
-    
+    logSceneLoaded(*world, scene.componentCount, elapsed.count(), "binary");
     return world;
 }
 
+bool SceneLoader::ConvertScene(const std::string& jsonPath, const std::string& escenePath) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::ConvertScene");
+
+    ESceneFormat::Scene scene;
+    JsonSceneBuilder builder(nullptr, &scene, GetSceneDirectory(jsonPath));
+    if (!SceneReader::Read(jsonPath, builder)) {
+        return false;
+    }
+    builder.Finish();
+    return ESceneFormat::Write(escenePath, scene);
+}
+
+struct SceneLoader::PendingShader {
+    std::string name;
+    std::string vertPath;
+    std::string fragPath;
+    std::vector<std::string> keywords;
+    std::vector<uint32_t> variants;  // Feature masks to submit up front
+    ShaderLoader::Sources sources;
+    bool ok = false;
+};
+
+struct SceneLoader::PendingModel {
+    std::string name;
+    std::string path;
+    bool keepCpuData = false;
+    bool alreadyLoaded = false;  // Just alias it, no import
+    std::vector<MeshData> meshes;
+    ModelHierarchy hierarchy;
+    bool ok = false;
+};
+
+struct SceneLoader::PreparedScene {
+    std::string sceneDir;
+    ESceneFormat::View view;
+    std::vector<PendingShader> shaders;
+    std::vector<PendingModel> models;
+    std::vector<uint64_t> textureKeys;  // Per asset record (textures only); hashed on the worker
+};
+
+std::string SceneLoader::GetConvertedScene(const std::string& jsonPath) {
+    auto& cache = AssetCache::Instance();
+    if (!cache.IsEnabled()) {
+        std::cerr << "ERROR: Can't stream JSON scene " << jsonPath
+                  << " without the AssetCache; convert it to " << ESceneFormat::Extension << " instead\n";
+        return {};
+    }
+
+    const std::string derived =
+        cache.FindDerived(cache.ComputeKey(AssetCache::AssetType::Scene, jsonPath, kConvertVersion), ESceneFormat::Extension);
+    if (!derived.empty()) return derived;
+
+    ESceneFormat::Scene binary;
+    JsonSceneBuilder builder(nullptr, &binary, GetSceneDirectory(jsonPath));
+    if (!SceneReader::Read(jsonPath, builder)) {
+        return {};
+    }
+    builder.Finish();
+    cache.SetDependencies(jsonPath, std::move(builder.assetPaths));
+    const uint64_t key = cache.ComputeKey(AssetCache::AssetType::Scene, jsonPath, kConvertVersion);
+    cache.StoreDerived(key, ESceneFormat::Extension,
+                       [&](const std::string& out) { return ESceneFormat::Write(out, binary); });
+    return cache.FindDerived(key, ESceneFormat::Extension);
+}
+
+std::shared_ptr<SceneLoader::PreparedScene> SceneLoader::PrepareScene(const std::string& path) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::PrepareScene");
+
+    auto prepared = std::make_shared<PreparedScene>();
+    prepared->sceneDir = GetSceneDirectory(path);
+    const std::string binaryPath = ESceneFormat::IsEScenePath(path) ? path : GetConvertedScene(path);
+    if (binaryPath.empty() || !ESceneFormat::Read(binaryPath, prepared->view)) {
+        return nullptr;
+    }
+
+    CollectAssets(prepared->view, prepared->sceneDir, prepared->shaders, prepared->models);
+    ImportAssetData(prepared->shaders, prepared->models);
+
+    // So InstantiateScene's TextureLoader::Load can share by content without reading files
+    const ESceneFormat::View& view = prepared->view;
+    prepared->textureKeys.resize(view.assetCount);
+    for (uint32_t i = 0; i < view.assetCount; ++i) {
+        if (view.assets[i].type != ESceneFormat::AssetType::Texture) continue;
+        const std::string path = ResolvePath(std::string(view.GetString(view.assets[i].path)), prepared->sceneDir);
+        prepared->textureKeys[i] = AssetCache::Instance().ComputeKey(AssetCache::AssetType::Texture, path);
+    }
+    return prepared;
+}
+
+bool SceneLoader::InstantiateScene(PreparedScene& scene, World& world, Entity* root, SceneAssets* assets) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::InstantiateScene");
+
+    const ESceneFormat::View& view = scene.view;
+    auto& textureLoader = TextureLoader::Instance();
+    auto& meshLoader = MeshLoader::Instance();
+    SceneAssets used;
+
+    for (uint32_t i = 0; i < view.assetCount; ++i) {
+        const ESceneFormat::AssetRecord& asset = view.assets[i];
+        if (asset.type != ESceneFormat::AssetType::Texture) continue;
+        const std::string name(view.GetString(asset.name));
+        const bool created = !textureLoader.Get(name);
+        if (textureLoader.Load(name, ResolvePath(std::string(view.GetString(asset.path)), scene.sceneDir),
+                               scene.textureKeys[i])) {
+            used.textures.push_back({name, created});
+        }
+    }
+
+    for (PendingModel& model : scene.models) {
+        // Released since the scene was prepared: import it after all
+        if (model.alreadyLoaded && !meshLoader.IsLoaded(model.name, model.path)) {
+            model.alreadyLoaded = false;
+            model.ok = MeshLoader::ImportMeshData(model.path, model.meshes, &model.hierarchy);
+        }
+        used.models.push_back({model.name, !meshLoader.Get(model.name)});
+    }
+    LoadShaders(scene.shaders);
+    LoadModels(scene.models);
+
+    // Textures the model components may load for their materials
+    for (const SceneAssets::Entry& entry : used.models) {
+        const Model* model = meshLoader.Get(entry.name);
+        if (!model) continue;
+        for (const ModelMaterial& material : model->hierarchy.materials) {
+            if (material.baseColorTexture.empty()) continue;
+            const std::string path = ResolvePath(material.baseColorTexture, model->directory);
+            const bool listed = std::any_of(used.textures.begin(), used.textures.end(),
+                                            [&path](const SceneAssets::Entry& e) { return e.name == path; });
+            if (!listed) used.textures.push_back({path, !textureLoader.Get(path)});
+        }
+    }
+
+    LoadEntities(&world, view, root);
+
+    if (assets) *assets = std::move(used);
+    return true;
+}
+
+// Budgets in MB; 0 = unlimited
+static void setResidencyBudget(double gpuBudgetMB, double cpuBudgetMB) {
+    ResidencyManager::Budget budget;
+    budget.gpuBytes = static_cast<size_t>(gpuBudgetMB * 1024.0 * 1024.0);
+    budget.cpuBytes = static_cast<size_t>(cpuBudgetMB * 1024.0 * 1024.0);
+    ResidencyManager::Instance().SetBudget(budget);
+}
+
+// Bit of each named keyword the shader declares (undeclared ones are ignored)
+static uint32_t keywordMask(const std::vector<std::string>& declared, const std::vector<std::string>& enabled) {
+    uint32_t mask = 0;
+    for (const auto& keyword : enabled) {
+        for (size_t i = 0; i < declared.size() && i < ShaderLoader::MaxKeywords; ++i) {
+            if (declared[i] == keyword) mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+// "sampler": { "minFilter": "linear_mipmap_linear", "magFilter": "nearest", "wrap": "clamp", ... };
+// filters are "nearest", "linear" or "<filter>_mipmap_<filter>" (min only), wraps "repeat",
+// "clamp" or "mirror", and "wrap" sets all three axes before "wrapS"/"wrapT"/"wrapR"
+static Sampler::State parseSamplerState(const json& samplerJson) {
+    static const std::unordered_map<std::string, GLenum> minFilters = {
+        {"nearest", GL_NEAREST},
+        {"linear", GL_LINEAR},
+        {"nearest_mipmap_nearest", GL_NEAREST_MIPMAP_NEAREST},
+        {"linear_mipmap_nearest", GL_LINEAR_MIPMAP_NEAREST},
+        {"nearest_mipmap_linear", GL_NEAREST_MIPMAP_LINEAR},
+        {"linear_mipmap_linear", GL_LINEAR_MIPMAP_LINEAR},
+    };
+    static const std::unordered_map<std::string, GLenum> magFilters = {
+        {"nearest", GL_NEAREST},
+        {"linear", GL_LINEAR},
+    };
+    static const std::unordered_map<std::string, GLenum> wraps = {
+        {"repeat", GL_REPEAT},
+        {"clamp", GL_CLAMP_TO_EDGE},
+        {"mirror", GL_MIRRORED_REPEAT},
+    };
+
+    Sampler::State state;
+    if (!samplerJson.is_object()) return state;
+
+    auto read = [&](const char* key, const std::unordered_map<std::string, GLenum>& names, GLenum& out) {
+        if (!samplerJson.contains(key)) return;
+        const std::string name = samplerJson[key].get<std::string>();
+        auto it = names.find(name);
+        if (it != names.end()) {
+            out = it->second;
+        } else {
+            std::cerr << "Warning: Unknown sampler " << key << ": " << name << "\n";
+        }
+    };
+    read("minFilter", minFilters, state.minFilter);
+    read("magFilter", magFilters, state.magFilter);
+    GLenum wrap = state.wrapS;
+    read("wrap", wraps, wrap);
+    state.wrapS = state.wrapT = state.wrapR = wrap;
+    read("wrapS", wraps, state.wrapS);
+    read("wrapT", wraps, state.wrapT);
+    read("wrapR", wraps, state.wrapR);
+    return state;
+}
+
+// "overrides": { "tint": [r, g, b, a] } on a MeshRenderer or Model component
+static MaterialOverrides parseOverrides(const json& overridesJson) {
+    MaterialOverrides overrides;
+    if (overridesJson.contains("tint")) {
+        const auto& t = overridesJson["tint"];
+        overrides.hasTint = true;
+        overrides.tint = glm::vec4(
+            t[0].get<float>(),
+            t[1].get<float>(),
+            t[2].get<float>(),
+            t.size() > 3 ? t[3].get<float>() : 1.0f
+        );
+    }
+    return overrides;
+}
+
 void SceneLoader::LoadAssets(const json& assetsJson, const std::string& sceneDir) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::LoadAssets");
     std::cout << "\n--- Loading Assets ---\n";
+    AssetCache::Instance().ResetStats();
     
-    if (assetsJson.contains("shaders")) {
-        LoadShaders(assetsJson["shaders"], sceneDir);
+    if (assetsJson.contains("residency")) {
+        const auto& residencyJson = assetsJson["residency"];
+        setResidencyBudget(residencyJson.value("gpuBudgetMB", 0.0), residencyJson.value("cpuBudgetMB", 0.0));
     }
+    // Textures first: their decodes start on the workers at once and overlap the imports
     if (assetsJson.contains("textures")) {
         LoadTextures(assetsJson["textures"], sceneDir);
     }
+
+    std::vector<PendingShader> shaders;
+    std::vector<PendingModel> models;
+
+    if (assetsJson.contains("shaders")) {
+        for (const auto& [name, paths] : assetsJson["shaders"].items()) {
+            PendingShader& shader = shaders.emplace_back();
+            shader.name = name;
+            shader.vertPath = ResolvePath(paths["vertex"].get<std::string>(), sceneDir);
+            shader.fragPath = ResolvePath(paths["fragment"].get<std::string>(), sceneDir);
+            if (paths.contains("keywords")) {
+                shader.keywords = paths["keywords"].get<std::vector<std::string>>();
+            }
+            if (paths.contains("variants")) {
+                for (const auto& variantJson : paths["variants"]) {
+                    shader.variants.push_back(keywordMask(shader.keywords, variantJson.get<std::vector<std::string>>()));
+                }
+            }
+        }
+    }
+    if (assetsJson.contains("models")) {
+        for (const auto& [name, modelJson] : assetsJson["models"].items()) {
+            // "name": "path" or "name": { "path": ..., "keepCpuData": true }
+            const bool detailed = modelJson.is_object();
+            const std::string path = detailed ? modelJson["path"].get<std::string>() : modelJson.get<std::string>();
+
+            PendingModel& model = models.emplace_back();
+            model.name = name;
+            model.path = ResolvePath(path, sceneDir);
+            model.keepCpuData = detailed && modelJson.value("keepCpuData", false);
+            model.alreadyLoaded = MeshLoader::Instance().IsLoaded(model.name, model.path);
+        }
+    }
+
+    ImportAssets(shaders, models);
+}
+
+void SceneLoader::LoadAssets(const ESceneFormat::View& scene, const std::string& sceneDir) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::LoadAssets");
+    std::cout << "\n--- Loading Assets ---\n";
+    AssetCache::Instance().ResetStats();
+
+    if (scene.hasResidency) {
+        setResidencyBudget(scene.gpuBudgetMB, scene.cpuBudgetMB);
+    }
+
+    // Textures are queued first, before the imports, as in the JSON path
+    size_t textures = 0;
+    for (uint32_t i = 0; i < scene.assetCount; ++i) {
+        const ESceneFormat::AssetRecord& asset = scene.assets[i];
+        if (asset.type != ESceneFormat::AssetType::Texture) continue;
+        const std::string path = ResolvePath(std::string(scene.GetString(asset.path)), sceneDir);
+        if (TextureLoader::Instance().Load(std::string(scene.GetString(asset.name)), path)) textures++;
+    }
+    std::cout << "✓ Queued " << textures << " textures\n";
+
+    std::vector<PendingShader> shaders;
+    std::vector<PendingModel> models;
+    CollectAssets(scene, sceneDir, shaders, models);
+    ImportAssets(shaders, models);
+}
+
+void SceneLoader::CollectAssets(const ESceneFormat::View& scene, const std::string& sceneDir,
+                                std::vector<PendingShader>& shaders, std::vector<PendingModel>& models) {
+    for (uint32_t i = 0; i < scene.assetCount; ++i) {
+        const ESceneFormat::AssetRecord& asset = scene.assets[i];
+        const std::string name(scene.GetString(asset.name));
+        const std::string path = ResolvePath(std::string(scene.GetString(asset.path)), sceneDir);
+
+        switch (asset.type) {
+            case ESceneFormat::AssetType::Texture:
+                break;
+            case ESceneFormat::AssetType::Shader: {
+                PendingShader& shader = shaders.emplace_back();
+                shader.name = name;
+                shader.vertPath = path;
+                shader.fragPath = ResolvePath(std::string(scene.GetString(asset.fragmentPath)), sceneDir);
+                for (uint32_t k = 0; k < asset.keywordCount; ++k) {
+                    shader.keywords.emplace_back(scene.GetString(scene.keywords[asset.firstKeyword + k]));
+                }
+                shader.variants.assign(scene.variants + asset.firstVariant,
+                                       scene.variants + asset.firstVariant + asset.variantCount);
+                break;
+            }
+            case ESceneFormat::AssetType::Model: {
+                PendingModel& model = models.emplace_back();
+                model.name = name;
+                model.path = path;
+                model.keepCpuData = (asset.flags & ESceneFormat::KeepCpuData) != 0;
+                model.alreadyLoaded = MeshLoader::Instance().IsLoaded(model.name, model.path);
+                break;
+            }
+        }
+    }
+}
+
+void SceneLoader::ImportAssetData(std::vector<PendingShader>& shaders, std::vector<PendingModel>& models) {
+    // File I/O, preprocessing, parsing and vertex processing for everything at
+    // once; one job per asset (the importers split large files further)
+    JobSystem::Instance().ParallelFor(shaders.size() + models.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            if (i < shaders.size()) {
+                PendingShader& shader = shaders[i];
+                shader.ok = ShaderLoader::Preprocess(shader.vertPath, shader.fragPath, shader.sources);
+            } else {
+                PendingModel& model = models[i - shaders.size()];
+                model.ok = model.alreadyLoaded || MeshLoader::ImportMeshData(model.path, model.meshes, &model.hierarchy);
+            }
+        }
+    });
+}
+
+void SceneLoader::ImportAssets(std::vector<PendingShader>& shaders, std::vector<PendingModel>& models) {
+    const auto start = std::chrono::steady_clock::now();
+    ImportAssetData(shaders, models);
+    const std::chrono::duration<double, std::milli> imported = std::chrono::steady_clock::now() - start;
+    std::cout << "Imported " << shaders.size() << " shaders and " << models.size() << " models in "
+              << imported.count() << " ms (" << JobSystem::Instance().GetWorkerCount() + 1 << " threads)\n";
+
+    // Cold vs warm startup: time until every program is linked (and stored) or
+    // loaded from the binary cache. The compiles overlap with the model uploads.
+    auto& programCache = ProgramBinaryCache::Instance();
+    programCache.ResetStats();
+    const auto shadersStart = std::chrono::steady_clock::now();
+    LoadShaders(shaders);
+    LoadModels(models);
+    ShaderLoader::Instance().ResolvePending();
+
+    const std::chrono::duration<double, std::milli> shadersReady = std::chrono::steady_clock::now() - shadersStart;
+    const auto& programStats = programCache.GetStats();
+    std::cout << "Shaders: " << shaders.size() << " ready in " << shadersReady.count() << " ms"
+              << " (binary cache " << (programCache.IsActive() ? "on" : "off")
+              << ", " << programStats.hits << " hits, " << programStats.misses << " misses, "
+              << programStats.rejected << " rejected, " << programStats.stored << " stored)\n";
+
+    // Cold vs warm startup: files hashed vs merely stat'ed, imports mapped vs redone.
+    // Texture decodes still in flight report their lookups later.
+    auto& cache = AssetCache::Instance();
+    const AssetCache::Stats stats = cache.GetStats();
+    std::cout << "Asset cache: " << stats.hashed << " files hashed, " << stats.unchanged << " unchanged, "
+              << stats.hits << " derived hits, " << stats.misses << " misses, " << stats.stored << " stored"
+              << (cache.IsEnabled() ? "" : " (disabled)") << "\n";
+}
+
+std::vector<std::string> SceneLoader::GetAssetPaths(const json& assetsJson, const std::string& sceneDir) {
+    std::vector<std::string> paths;
+    if (assetsJson.contains("textures")) {
+        for (const auto& [name, path] : assetsJson["textures"].items()) {
+            paths.push_back(ResolvePath(path.get<std::string>(), sceneDir));
+        }
+    }
+    if (assetsJson.contains("shaders")) {
+        for (const auto& [name, stages] : assetsJson["shaders"].items()) {
+            paths.push_back(ResolvePath(stages["vertex"].get<std::string>(), sceneDir));
+            paths.push_back(ResolvePath(stages["fragment"].get<std::string>(), sceneDir));
+        }
+    }
     if (assetsJson.contains("models")) {
-        LoadModels(assetsJson["models"], sceneDir);
+        for (const auto& [name, modelJson] : assetsJson["models"].items()) {
+            const bool detailed = modelJson.is_object();
+            paths.push_back(ResolvePath(detailed ? modelJson["path"].get<std::string>() : modelJson.get<std::string>(),
+                                        sceneDir));
+        }
     }
+    return paths;
 }
 
-void SceneLoader::LoadShaders(const json& shadersJson, const std::string& sceneDir) {
+void SceneLoader::LoadShaders(const std::vector<PendingShader>& shaders) {
     auto& loader = ShaderLoader::Instance();
-    
-    for (const auto& [name, paths] : shadersJson.items()) {
-        std::string vertPath = ResolvePath(paths["vertex"].get<std::string>(), sceneDir);
-        std::string fragPath = ResolvePath(paths["fragment"].get<std::string>(), sceneDir);
-        loader.Load(name, vertPath, fragPath);
+    for (const PendingShader& shader : shaders) {
+        if (!shader.ok) {
+            std::cerr << "ERROR: Shader '" << shader.name << "' could not be read\n";
+            continue;
+        }
+        if (!loader.Load(shader.name, shader.vertPath, shader.fragPath, shader.keywords, shader.sources)) continue;
+
+        // Submit known variants now so their compiles overlap with everything else
+        for (uint32_t mask : shader.variants) {
+            loader.GetVariant(shader.name, mask);
+        }
     }
 }
 
@@ -105,99 +721,144 @@ void SceneLoader::LoadTextures(const json& texturesJson, const std::string& scen
         std::string fullPath = ResolvePath(path.get<std::string>(), sceneDir);
         auto* tex = loader.Load(name, fullPath);
         if (tex) {
-            std::cout << "✓ Loaded texture: " << name << "\n";
+            std::cout << "✓ Queued texture: " << name << "\n";
         }
     }
 }
 
-void SceneLoader::LoadModels(const json& modelsJson, const std::string& sceneDir) {
+void SceneLoader::LoadModels(std::vector<PendingModel>& models) {
     auto& loader = MeshLoader::Instance();
     
-    for (const auto& [name, path] : modelsJson.items()) {
-        std::string fullPath = ResolvePath(path.get<std::string>(), sceneDir);
-        auto* model = loader.Load(name, fullPath);
+    for (PendingModel& pending : models) {
+        if (!pending.ok) {
+            std::cerr << "MeshLoader::Load: failed to import model: " << pending.path << "\n";
+            continue;
+        }
+
+        auto* model = loader.Add(pending.name, pending.path, std::move(pending.meshes), pending.keepCpuData,
+                                 std::move(pending.hierarchy));
         if (model) {
-            std::cout << "✓ Loaded model: " << name << " (" << model->meshes.size() << " meshes)\n";
+            std::cout << "✓ Loaded model: " << pending.name << " (" << model->meshes.size() << " meshes)\n";
         }
     }
 }
 
-void SceneLoader::LoadEntities(World* world, const json& entitiesJson) {
-    std::cout << "\n--- Loading Entities ---\n";
-    
-    for (const auto& entityJson : entitiesJson) {
-        LoadEntity(world, entityJson, nullptr);
+void SceneLoader::LoadTransform(Entity* entity, const json& t) {
+    if (t.contains("position")) {
+        const auto& p = t["position"];
+        entity->position = glm::vec3(p[0].get<float>(), p[1].get<float>(), p[2].get<float>());
     }
-}
-
-Entity* SceneLoader::LoadEntity(World* world, const json& entityJson, Entity* parent) {
-    std::string name = entityJson.value("name", "Entity");
-    Entity* entity = world->CreateEntity(name);
     
-    // Set parent if specified
-    if (parent) {
-        parent->AddChild(entity);
+    if (t.contains("rotation")) {
+        const auto& r = t["rotation"];
+        // Convert degrees to radians
+        entity->rotation = glm::vec3(
+            glm::radians(r[0].get<float>()),
+            glm::radians(r[1].get<float>()),
+            glm::radians(r[2].get<float>())
+        );
     }
     
-    // Load transform
-    if (entityJson.contains("transform")) {
-        const auto& t = entityJson["transform"];
-        
-        if (t.contains("position")) {
-            const auto& p = t["position"];
-            entity->position = glm::vec3(p[0].get<float>(), p[1].get<float>(), p[2].get<float>());
+    if (t.contains("scale")) {
+        const auto& s = t["scale"];
+        if (s.is_array()) {
+            entity->scale = glm::vec3(s[0].get<float>(), s[1].get<float>(), s[2].get<float>());
+        } else {
+            // Uniform scale
+            float uniformScale = s.get<float>();
+            entity->scale = glm::vec3(uniformScale);
         }
-        
-        if (t.contains("rotation")) {
-            const auto& r = t["rotation"];
-            // Convert degrees to radians
-            entity->rotation = glm::vec3(
-                glm::radians(r[0].get<float>()),
-                glm::radians(r[1].get<float>()),
-                glm::radians(r[2].get<float>())
-            );
+    }
+}
+
+void SceneLoader::LoadEntities(World* world, const ESceneFormat::View& scene, Entity* root) {
+    ENGINE_PROFILE_SCOPE("SceneLoader::LoadEntities");
+
+    // One block for the scene's own entities; parents precede their children,
+    // so every parent is complete before its first child is linked
+    Entity* entities = world->CreateEntities(scene.entityCount);
+    SharedMaterials materials;
+    materials.records.resize(scene.materialCount);  // One Material per record, created on first use
+    auto getMaterial = [&](int32_t index) -> std::shared_ptr<Material> {
+        if (index < 0) return nullptr;
+        std::shared_ptr<Material>& material = materials.records[index];
+        if (!material) material = LoadMaterial(scene, scene.materials[index]);
+        return material;
+    };
+
+    for (uint32_t i = 0; i < scene.entityCount; ++i) {
+        const ESceneFormat::EntityRecord& record = scene.entities[i];
+        const ESceneFormat::TransformRecord& transform = scene.transforms[i];
+        Entity& entity = entities[i];
+
+        entity.name.assign(scene.GetString(record.name));
+        entity.position = glm::vec3(transform.position[0], transform.position[1], transform.position[2]);
+        entity.rotation = glm::vec3(transform.rotation[0], transform.rotation[1], transform.rotation[2]);
+        entity.scale = glm::vec3(transform.scale[0], transform.scale[1], transform.scale[2]);
+        entity.children.reserve(record.childCount);
+        entity.components.reserve(record.componentCount);
+        if (record.parent >= 0) {
+            Entity& parent = entities[record.parent];
+            entity.parent = &parent;
+            parent.children.push_back(&entity);
+        } else if (root) {
+            root->AddChild(&entity);
         }
-        
-        if (t.contains("scale")) {
-            const auto& s = t["scale"];
-            if (s.is_array()) {
-                entity->scale = glm::vec3(s[0].get<float>(), s[1].get<float>(), s[2].get<float>());
-            } else {
-                // Uniform scale
-                float uniformScale = s.get<float>();
-                entity->scale = glm::vec3(uniformScale);
+
+        for (uint32_t c = 0; c < record.componentCount; ++c) {
+            const ESceneFormat::ComponentRecord& component = scene.components[record.firstComponent + c];
+            MaterialOverrides overrides;
+            if (component.overrideFlags & ESceneFormat::OverrideTint) {
+                overrides.hasTint = true;
+                overrides.tint = glm::vec4(component.overrideTint[0], component.overrideTint[1],
+                                           component.overrideTint[2], component.overrideTint[3]);
+            }
+
+            switch (component.type) {
+                case ESceneFormat::ComponentType::Camera: {
+                    auto* camera = entity.AddComponent<CameraComponent>();
+                    camera->cameraType = static_cast<CameraComponent::Type>(component.cameraType);
+                    camera->fovY = component.fovY;
+                    camera->orthoHeight = component.orthoHeight;
+                    camera->nearPlane = component.nearPlane;
+                    camera->farPlane = component.farPlane;
+                    break;
+                }
+                case ESceneFormat::ComponentType::MeshRenderer: {
+                    auto* renderer = entity.AddComponent<MeshRendererComponent>();
+                    Model* model = MeshLoader::Instance().Get(std::string(scene.GetString(component.asset)));
+                    if (model && component.meshIndex >= 0 && component.meshIndex < (int)model->meshes.size()) {
+                        renderer->mesh = &model->meshes[component.meshIndex];
+                    } else if (!model && component.asset.size) {
+                        std::cerr << "Warning: Mesh not found: " << scene.GetString(component.asset) << "\n";
+                    }
+                    renderer->material = getMaterial(component.material);
+                    renderer->overrides = overrides;
+                    break;
+                }
+                case ESceneFormat::ComponentType::Model:
+                    InstantiateModel(world, &entity, std::string(scene.GetString(component.asset)),
+                                     getMaterial(component.material), overrides, materials);
+                    break;
             }
         }
     }
-    
-    // Load components
-    if (entityJson.contains("components")) {
-        LoadComponents(entity, entityJson["components"]);
-    }
-    
-    // Load children recursively
-    if (entityJson.contains("children")) {
-        for (const auto& childJson : entityJson["children"]) {
-            LoadEntity(world, childJson, entity);
-        }
-    }
-    
-    std::cout << "✓ Created entity: " << name << "\n";
-    return entity;
 }
 
-void SceneLoader::LoadComponents(Entity* entity, const json& componentsJson) {
-    for (const auto& compJson : componentsJson) {
-        std::string type = compJson.value("type", "");
-        
-        if (type == "Camera") {
-            LoadCameraComponent(entity, compJson);
-        } else if (type == "MeshRenderer") {
-            LoadMeshRendererComponent(entity, compJson);
-        } else {
-            std::cerr << "Warning: Unknown component type: " << type << "\n";
-        }
+bool SceneLoader::LoadComponent(World* world, Entity* entity, const json& compJson, SharedMaterials& materials) {
+    std::string type = compJson.value("type", "");
+    
+    if (type == "Camera") {
+        LoadCameraComponent(entity, compJson);
+    } else if (type == "MeshRenderer") {
+        LoadMeshRendererComponent(entity, compJson, materials);
+    } else if (type == "Model") {
+        LoadModelComponent(world, entity, compJson, materials);
+    } else {
+        std::cerr << "Warning: Unknown component type: " << type << "\n";
+        return false;
     }
+    return true;
 }
 
 void SceneLoader::LoadCameraComponent(Entity* entity, const json& camJson) {
@@ -214,11 +875,9 @@ void SceneLoader::LoadCameraComponent(Entity* entity, const json& camJson) {
     camera->orthoHeight = camJson.value("orthoHeight", 10.0f);
     camera->nearPlane = camJson.value("near", 0.1f);
     camera->farPlane = camJson.value("far", 100.0f);
-    
-    std::cout << "  + Camera component\n";
 }
 
-void SceneLoader::LoadMeshRendererComponent(Entity* entity, const json& rendererJson) {
+void SceneLoader::LoadMeshRendererComponent(Entity* entity, const json& rendererJson, SharedMaterials& materials) {
     auto* renderer = entity->AddComponent<MeshRendererComponent>();
     
     // Load mesh
@@ -237,12 +896,91 @@ void SceneLoader::LoadMeshRendererComponent(Entity* entity, const json& renderer
         }
     }
     
-    // Load material
+    // Load material (shared with every renderer using the same one)
     if (rendererJson.contains("material")) {
-        renderer->material = LoadMaterial(rendererJson["material"]);
+        renderer->material = GetMaterial(rendererJson["material"], materials);
     }
-    
-    std::cout << "  + MeshRenderer component\n";
+    if (rendererJson.contains("overrides")) {
+        renderer->overrides = parseOverrides(rendererJson["overrides"]);
+    }
+}
+
+void SceneLoader::LoadModelComponent(World* world, Entity* entity, const json& modelJson, SharedMaterials& materials) {
+    // { "type": "Model", "model": name, "material": { ...template... } or "name", "overrides": { ... } }
+    const std::string modelName = modelJson.value("model", "");
+    const json materialJson = modelJson.value("material", json::object());
+    const MaterialOverrides overrides = parseOverrides(modelJson.value("overrides", json::object()));
+    InstantiateModel(world, entity, modelName, GetMaterial(materialJson, materials), overrides, materials);
+}
+
+size_t SceneLoader::InstantiateModel(World* world, Entity* entity, const std::string& modelName,
+                                     const std::shared_ptr<Material>& material, const MaterialOverrides& overrides,
+                                     SharedMaterials& materials) {
+    Model* model = MeshLoader::Instance().Get(modelName);
+    if (!model) {
+        std::cerr << "Warning: Model not found: " << modelName << "\n";
+        return 0;
+    }
+
+    // The template is completed per primitive from the model's own material:
+    // its base colour scales the tint and its texture fills a missing albedo map.
+    // Each (template, source) pair is completed once; the template itself is
+    // used when the source changes nothing.
+    auto makeMaterial = [&](const ModelMaterial* source) -> std::shared_ptr<Material> {
+        if (!material || !source) return material;
+        std::shared_ptr<Material>& completed = materials.completed[{material.get(), source}];
+        if (completed) return completed;
+        completed = material;
+
+        const auto* textured = dynamic_cast<const TexturedMaterial*>(material.get());
+        const bool addAlbedo = textured && !textured->albedoMap && !source->baseColorTexture.empty();
+        const bool scaleTint = source->baseColor != glm::vec4(1.0f);
+        if (!addAlbedo && !scaleTint) return completed;
+
+        std::unique_ptr<Material> copy = material->Clone();
+        if (auto* completedTextured = dynamic_cast<TexturedMaterial*>(copy.get())) {
+            if (addAlbedo) {
+                const std::string path = ResolvePath(source->baseColorTexture, model->directory);
+                completedTextured->albedoMap = TextureLoader::Instance().Load(path, path);
+            }
+            completedTextured->tint *= source->baseColor;
+        } else if (auto* completedTinted = dynamic_cast<TintedMaterial*>(copy.get())) {
+            completedTinted->tint *= source->baseColor;
+        }
+        if (copy) completed = std::move(copy);
+        return completed;
+    };
+
+    const size_t firstEntity = world->entities.size();
+    ModelInstantiator::Instantiate(*world, *model, entity, makeMaterial);
+    if (!overrides.Empty()) {
+        for (size_t i = firstEntity; i < world->entities.size(); ++i) {
+            auto* renderer = world->entities[i] ? world->entities[i]->GetComponent<MeshRendererComponent>() : nullptr;
+            if (renderer) renderer->overrides = overrides;
+        }
+    }
+    return world->entities.size() - firstEntity;
+}
+
+std::shared_ptr<Material> SceneLoader::GetMaterial(const json& matJson, SharedMaterials& materials) {
+    const json* block = &matJson;
+    std::string key;
+    if (matJson.is_string()) {
+        const std::string name = matJson.get<std::string>();
+        auto named = materials.named.find(name);
+        if (named == materials.named.end()) {
+            std::cerr << "Warning: Material not found: " << name << "\n";
+            return nullptr;
+        }
+        block = &*named;
+        key = "@" + name;
+    } else {
+        key = matJson.dump();
+    }
+
+    std::shared_ptr<Material>& material = materials.blocks[key];
+    if (!material) material = LoadMaterial(*block);
+    return material;
 }
 
 std::unique_ptr<Material> SceneLoader::LoadMaterial(const json& matJson) {
@@ -277,8 +1015,8 @@ std::unique_ptr<Material> SceneLoader::LoadMaterial(const json& matJson) {
             );
         }
         
-        // Create sampler
-        mat->sampler = std::make_shared<Sampler>();
+        // One sampler object per distinct state, however many materials use it
+        mat->sampler = SamplerCache::Instance().Get(parseSamplerState(matJson.value("sampler", json::object())));
         
         material = std::move(mat);
     } else {
@@ -322,6 +1060,66 @@ std::unique_ptr<Material> SceneLoader::LoadMaterial(const json& matJson) {
     return material;
 }
 
+std::unique_ptr<Material> SceneLoader::LoadMaterial(const ESceneFormat::View& scene,
+                                                  const ESceneFormat::MaterialRecord& record) {
+    auto texture = [&](ESceneFormat::StringRef name) -> Texture* {
+        return name.size ? TextureLoader::Instance().Get(std::string(scene.GetString(name))) : nullptr;
+    };
+    const glm::vec4 tint(record.tint[0], record.tint[1], record.tint[2], record.tint[3]);
+
+    std::unique_ptr<Material> material;
+    if (record.type == ESceneFormat::MaterialType::Textured) {
+        auto mat = std::make_unique<TexturedMaterial>();
+        mat->albedoMap = texture(record.maps[0]);
+        mat->specularMap = texture(record.maps[1]);
+        mat->normalMap = texture(record.maps[2]);
+        mat->emissiveMap = texture(record.maps[3]);
+        mat->tint = tint;
+
+        Sampler::State sampler;
+        sampler.minFilter = record.sampler.minFilter;
+        sampler.magFilter = record.sampler.magFilter;
+        sampler.wrapS = record.sampler.wrapS;
+        sampler.wrapT = record.sampler.wrapT;
+        sampler.wrapR = record.sampler.wrapR;
+        mat->sampler = SamplerCache::Instance().Get(sampler);
+        material = std::move(mat);
+    } else {
+        auto mat = std::make_unique<TintedMaterial>();
+        mat->tint = tint;
+        material = std::move(mat);
+    }
+
+    if (record.shader.size) {
+        const std::string shaderName(scene.GetString(record.shader));
+        Shader* shader = ShaderLoader::Instance().Get(shaderName);
+        if (shader) {
+            material->shader = std::shared_ptr<Shader>(shader, [](Shader*) {
+                // Empty deleter - ShaderLoader owns the shader
+            });
+        } else {
+            std::cerr << "Warning: Shader not found: " << shaderName << "\n";
+        }
+    }
+
+    const ESceneFormat::PipelineRecord& pipeline = record.pipeline;
+    PipelineState& state = material->pipelineState;
+    state.faceCulling = pipeline.faceCulling != 0;
+    state.cullFace = pipeline.cullFace;
+    state.depthTesting = pipeline.depthTesting != 0;
+    state.depthFunc = pipeline.depthFunc;
+    state.depthMask = pipeline.depthMask != 0;
+    state.blending = pipeline.blending != 0;
+    state.blendSrc = pipeline.blendSrc;
+    state.blendDst = pipeline.blendDst;
+    for (int i = 0; i < 4; ++i) {
+        state.colorMask[i] = pipeline.colorMask[i] != 0;
+    }
+
+    material->transparent = (record.flags & ESceneFormat::Transparent) != 0;
+    return material;
+}
+
 void SceneLoader::LoadPipelineState(PipelineState& state, const json& stateJson) {
     // Face culling
     if (stateJson.contains("faceCulling")) {
@@ -363,4 +1161,189 @@ void SceneLoader::LoadPipelineState(PipelineState& state, const json& stateJson)
     }
 }
 
+
+void SceneLoader::FlattenAssets(const json& assetsJson, ESceneFormat::Scene& scene) {
+    if (assetsJson.contains("residency")) {
+        const auto& residencyJson = assetsJson["residency"];
+        scene.hasResidency = true;
+        scene.gpuBudgetMB = residencyJson.value("gpuBudgetMB", 0.0);
+        scene.cpuBudgetMB = residencyJson.value("cpuBudgetMB", 0.0);
+    }
+
+    // Paths stay as written; the loader resolves them against the scene's directory
+    if (assetsJson.contains("textures")) {
+        for (const auto& [name, path] : assetsJson["textures"].items()) {
+            ESceneFormat::AssetRecord asset{};
+            asset.type = ESceneFormat::AssetType::Texture;
+            asset.name = scene.AddString(name);
+            asset.path = scene.AddString(path.get<std::string>());
+            scene.assets.push_back(asset);
+        }
+    }
+    if (assetsJson.contains("shaders")) {
+        for (const auto& [name, paths] : assetsJson["shaders"].items()) {
+            ESceneFormat::AssetRecord asset{};
+            asset.type = ESceneFormat::AssetType::Shader;
+            asset.name = scene.AddString(name);
+            asset.path = scene.AddString(paths["vertex"].get<std::string>());
+            asset.fragmentPath = scene.AddString(paths["fragment"].get<std::string>());
+
+            std::vector<std::string> keywords;
+            if (paths.contains("keywords")) {
+                keywords = paths["keywords"].get<std::vector<std::string>>();
+            }
+            asset.firstKeyword = static_cast<uint32_t>(scene.keywords.size());
+            asset.keywordCount = static_cast<uint32_t>(keywords.size());
+            for (const auto& keyword : keywords) {
+                scene.keywords.push_back(scene.AddString(keyword));
+            }
+
+            asset.firstVariant = static_cast<uint32_t>(scene.variants.size());
+            if (paths.contains("variants")) {
+                for (const auto& variantJson : paths["variants"]) {
+                    scene.variants.push_back(keywordMask(keywords, variantJson.get<std::vector<std::string>>()));
+                }
+            }
+            asset.variantCount = static_cast<uint32_t>(scene.variants.size()) - asset.firstVariant;
+            scene.assets.push_back(asset);
+        }
+    }
+    if (assetsJson.contains("models")) {
+        for (const auto& [name, modelJson] : assetsJson["models"].items()) {
+            const bool detailed = modelJson.is_object();
+            ESceneFormat::AssetRecord asset{};
+            asset.type = ESceneFormat::AssetType::Model;
+            asset.name = scene.AddString(name);
+            asset.path = scene.AddString(detailed ? modelJson["path"].get<std::string>()
+                                                  : modelJson.get<std::string>());
+            if (detailed && modelJson.value("keepCpuData", false)) asset.flags |= ESceneFormat::KeepCpuData;
+            scene.assets.push_back(asset);
+        }
+    }
+}
+
+void SceneLoader::FlattenTransform(const json& t, ESceneFormat::TransformRecord& transform) {
+    // Degrees in, radians stored, as in LoadTransform; absent keys keep the record's values
+    if (t.contains("position")) {
+        for (int i = 0; i < 3; ++i) transform.position[i] = t["position"][i].get<float>();
+    }
+    if (t.contains("rotation")) {
+        for (int i = 0; i < 3; ++i) transform.rotation[i] = glm::radians(t["rotation"][i].get<float>());
+    }
+    if (t.contains("scale")) {
+        const auto& s = t["scale"];
+        for (int i = 0; i < 3; ++i) transform.scale[i] = s.is_array() ? s[i].get<float>() : s.get<float>();
+    }
+}
+
+bool SceneLoader::FlattenComponent(const json& compJson, const json& namedMaterials, ESceneFormat::Scene& scene,
+                                   std::unordered_map<std::string, int32_t>& materialIndices,
+                                   ESceneFormat::ComponentRecord& component) {
+    const std::string type = compJson.value("type", "");
+    component.material = -1;
+
+    if (type == "Camera") {
+        component.type = ESceneFormat::ComponentType::Camera;
+        component.cameraType = compJson.value("cameraType", "perspective") == "orthographic"
+                                   ? CameraComponent::ORTHOGRAPHIC
+                                   : CameraComponent::PERSPECTIVE;
+        component.fovY = glm::radians(compJson.value("fovY", 60.0f));
+        component.orthoHeight = compJson.value("orthoHeight", 10.0f);
+        component.nearPlane = compJson.value("near", 0.1f);
+        component.farPlane = compJson.value("far", 100.0f);
+    } else if (type == "MeshRenderer") {
+        component.type = ESceneFormat::ComponentType::MeshRenderer;
+        if (compJson.contains("mesh")) component.asset = scene.AddString(compJson["mesh"].get<std::string>());
+        component.meshIndex = compJson.value("meshIndex", 0);
+        if (compJson.contains("material")) {
+            component.material = FlattenMaterial(compJson["material"], namedMaterials, scene, materialIndices);
+        }
+    } else if (type == "Model") {
+        component.type = ESceneFormat::ComponentType::Model;
+        component.asset = scene.AddString(compJson.value("model", ""));
+        component.material =
+            FlattenMaterial(compJson.value("material", json::object()), namedMaterials, scene, materialIndices);
+    } else {
+        return false;
+    }
+
+    const MaterialOverrides overrides = parseOverrides(compJson.value("overrides", json::object()));
+    if (overrides.hasTint) {
+        component.overrideFlags |= ESceneFormat::OverrideTint;
+        for (int i = 0; i < 4; ++i) component.overrideTint[i] = overrides.tint[i];
+    }
+    return true;
+}
+
+int32_t SceneLoader::FlattenMaterial(const json& matJson, const json& namedMaterials, ESceneFormat::Scene& scene,
+                                     std::unordered_map<std::string, int32_t>& materialIndices) {
+    // Identical material blocks share one record, and so do uses of one name
+    const std::string key = matJson.is_string() ? "@" + matJson.get<std::string>() : matJson.dump();
+    auto it = materialIndices.find(key);
+    if (it != materialIndices.end()) return it->second;
+
+    int32_t index;
+    if (!matJson.is_string()) {
+        index = static_cast<int32_t>(scene.materials.size());
+        scene.materials.push_back(FlattenMaterialRecord(matJson, scene));
+    } else if (auto named = namedMaterials.find(matJson.get<std::string>()); named != namedMaterials.end()) {
+        index = FlattenMaterial(*named, namedMaterials, scene, materialIndices);
+    } else {
+        // Not declared (yet): the "assets" block fills the record in if it comes later
+        index = static_cast<int32_t>(scene.materials.size());
+        scene.materials.push_back(FlattenMaterialRecord(json::object(), scene));
+    }
+    materialIndices.emplace(key, index);
+    return index;
+}
+
+ESceneFormat::MaterialRecord SceneLoader::FlattenMaterialRecord(const json& matJson, ESceneFormat::Scene& scene) {
+    ESceneFormat::MaterialRecord material{};
+    const bool textured = matJson.value("type", "tinted") == "textured";
+    material.type = textured ? ESceneFormat::MaterialType::Textured : ESceneFormat::MaterialType::Tinted;
+    if (matJson.contains("shader")) {
+        material.shader = scene.AddString(matJson["shader"].get<std::string>());
+    }
+    if (textured) {
+        const char* maps[4] = {"albedoMap", "specularMap", "normalMap", "emissiveMap"};
+        for (int i = 0; i < 4; ++i) {
+            if (matJson.contains(maps[i])) material.maps[i] = scene.AddString(matJson[maps[i]].get<std::string>());
+        }
+    }
+
+    for (int i = 0; i < 4; ++i) material.tint[i] = 1.0f;
+    if (matJson.contains("tint")) {
+        const auto& t = matJson["tint"];
+        for (size_t i = 0; i < 4 && i < t.size(); ++i) material.tint[i] = t[i].get<float>();
+    }
+
+    // Resolved here so the loader copies the state without knowing the defaults
+    PipelineState state;
+    if (matJson.contains("pipelineState")) {
+        LoadPipelineState(state, matJson["pipelineState"]);
+    }
+    ESceneFormat::PipelineRecord& pipeline = material.pipeline;
+    pipeline.faceCulling = state.faceCulling;
+    pipeline.cullFace = state.cullFace;
+    pipeline.depthTesting = state.depthTesting;
+    pipeline.depthFunc = state.depthFunc;
+    pipeline.depthMask = state.depthMask;
+    pipeline.blending = state.blending;
+    pipeline.blendSrc = state.blendSrc;
+    pipeline.blendDst = state.blendDst;
+    for (int i = 0; i < 4; ++i) {
+        pipeline.colorMask[i] = state.colorMask[i];
+    }
+
+    const Sampler::State sampler = parseSamplerState(matJson.value("sampler", json::object()));
+    material.sampler.minFilter = sampler.minFilter;
+    material.sampler.magFilter = sampler.magFilter;
+    material.sampler.wrapS = sampler.wrapS;
+    material.sampler.wrapT = sampler.wrapT;
+    material.sampler.wrapR = sampler.wrapR;
+
+    if (matJson.value("transparent", false)) material.flags |= ESceneFormat::Transparent;
+    return material;
+}
+
 } // namespace engine
\ No newline at end of file
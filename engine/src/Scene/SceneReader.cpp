@@ -0,0 +1,262 @@
+#include "Engine/Scene/SceneReader.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace engine {
+
+using json = nlohmann::json;
+
+namespace {
+
+// Where the parser is in the scene's structure
+enum class Level {
+    Scene,       // The top-level object
+    Entities,    // "entities" or an entity's "children"
+    Entity,
+    Components   // An entity's "components"
+};
+
+// What a captured value is for once it closes
+enum class Capture {
+    None,
+    Assets,
+    Transform,
+    Component,
+    Skip  // Not part of the scene format: only counted, never built
+};
+
+class SceneSax : public nlohmann::json_sax<json> {
+public:
+    explicit SceneSax(SceneReader::Handler& handler) : handler(handler) {}
+
+    std::string error;
+
+    bool null() override { return value(nullptr); }
+    bool boolean(bool v) override { return value(v); }
+    bool number_integer(number_integer_t v) override { return value(v); }
+    bool number_unsigned(number_unsigned_t v) override { return value(v); }
+    bool number_float(number_float_t v, const string_t&) override { return value(v); }
+    bool binary(binary_t& v) override { return value(std::move(v)); }
+
+    bool string(string_t& v) override {
+        if (capture == Capture::None && !levels.empty() && levels.back() == Level::Entity && lastKey == "name") {
+            handler.OnEntityName(v);
+            return true;
+        }
+        return value(std::move(v));
+    }
+
+    bool key(string_t& k) override {
+        if (capture == Capture::None) {
+            lastKey = std::move(k);
+        } else if (capture != Capture::Skip) {
+            // Where the next value goes; the slot is filled (or nested into) right after
+            building.push_back(&(*building.back())[k]);
+            pendingSlot = true;
+        }
+        return true;
+    }
+
+    bool start_object(std::size_t) override {
+        if (capture != Capture::None) return open(json::value_t::object);
+
+        if (levels.empty()) {
+            levels.push_back(Level::Scene);
+        } else if (levels.back() == Level::Entities) {
+            handler.OnBeginEntity();
+            levels.push_back(Level::Entity);
+        } else if (levels.back() == Level::Components) {
+            begin(Capture::Component, json::value_t::object);
+        } else if (levels.back() == Level::Scene && lastKey == "assets") {
+            begin(Capture::Assets, json::value_t::object);
+        } else if (levels.back() == Level::Entity && lastKey == "transform") {
+            begin(Capture::Transform, json::value_t::object);
+        } else {
+            begin(Capture::Skip, json::value_t::object);
+        }
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        if (capture != Capture::None) return open(json::value_t::array);
+
+        if (!levels.empty() && levels.back() == Level::Scene && lastKey == "entities") {
+            levels.push_back(Level::Entities);
+        } else if (!levels.empty() && levels.back() == Level::Entity && lastKey == "children") {
+            levels.push_back(Level::Entities);
+        } else if (!levels.empty() && levels.back() == Level::Entity && lastKey == "components") {
+            levels.push_back(Level::Components);
+        } else {
+            begin(Capture::Skip, json::value_t::array);
+        }
+        return true;
+    }
+
+    bool end_object() override { return close(); }
+    bool end_array() override { return close(); }
+
+    bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& e) override {
+        error = e.what();
+        return false;
+    }
+
+private:
+    SceneReader::Handler& handler;
+    std::vector<Level> levels;
+    std::string lastKey;  // Last key seen outside a capture
+
+    Capture capture = Capture::None;
+    size_t skipDepth = 0;
+    json captured;
+    std::vector<json*> building;  // Open containers in `captured`, innermost last
+    bool pendingSlot = false;     // building.back() is an object member awaiting its value
+
+    void begin(Capture kind, json::value_t type) {
+        capture = kind;
+        if (kind == Capture::Skip) {
+            skipDepth = 1;
+            return;
+        }
+        captured = json(type);
+        building.assign(1, &captured);
+    }
+
+    // The slot a value or nested container goes into
+    json* slot() {
+        if (pendingSlot) {
+            pendingSlot = false;
+            return building.back();
+        }
+        json* container = building.back();
+        container->push_back(nullptr);
+        return &container->back();
+    }
+
+    bool open(json::value_t type) {
+        if (capture == Capture::Skip) {
+            ++skipDepth;
+            return true;
+        }
+        json* target = slot();
+        *target = json(type);
+        // An object member's slot is already on the stack; an array element's isn't
+        if (building.back() != target) building.push_back(target);
+        return true;
+    }
+
+    template <typename T>
+    bool value(T&& v) {
+        if (capture == Capture::None || capture == Capture::Skip) return true;
+        const bool member = pendingSlot;
+        *slot() = json(std::forward<T>(v));
+        if (member) building.pop_back();
+        return true;
+    }
+
+    bool close() {
+        if (capture == Capture::Skip) {
+            if (--skipDepth == 0) capture = Capture::None;
+            return true;
+        }
+        if (capture != Capture::None) {
+            building.pop_back();
+            if (!building.empty()) return true;
+            deliver();
+            return true;
+        }
+
+        if (!levels.empty() && levels.back() == Level::Entity) handler.OnEndEntity();
+        if (!levels.empty()) levels.pop_back();
+        return true;
+    }
+
+    void deliver() {
+        const Capture kind = capture;
+        capture = Capture::None;
+        switch (kind) {
+            case Capture::Assets: handler.OnAssets(captured); break;
+            case Capture::Transform: handler.OnTransform(captured); break;
+            case Capture::Component: handler.OnComponent(captured); break;
+            default: break;
+        }
+        captured = json();
+    }
+};
+
+// A DOM has no file order (objects are sorted), so use the order the
+// scenes are written in: name, transform, components, children
+void walkEntity(const json& entityJson, SceneReader::Handler& handler) {
+    handler.OnBeginEntity();
+    auto member = [&entityJson](const char* key) -> const json* {
+        auto it = entityJson.find(key);
+        return it != entityJson.end() ? &*it : nullptr;
+    };
+    if (const json* name = member("name"); name && name->is_string()) {
+        handler.OnEntityName(name->get<std::string>());
+    }
+    if (const json* transform = member("transform"); transform && transform->is_object()) {
+        handler.OnTransform(*transform);
+    }
+    if (const json* components = member("components"); components && components->is_array()) {
+        for (const auto& componentJson : *components) {
+            if (componentJson.is_object()) handler.OnComponent(componentJson);
+        }
+    }
+    if (const json* children = member("children"); children && children->is_array()) {
+        for (const auto& childJson : *children) {
+            if (childJson.is_object()) walkEntity(childJson, handler);
+        }
+    }
+    handler.OnEndEntity();
+}
+
+} // namespace
+
+bool SceneReader::Read(const std::string& path, Handler& handler) {
+    ENGINE_PROFILE_SCOPE("SceneReader::Read");
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "ERROR: Failed to open scene file: " << path << "\n";
+        return false;
+    }
+
+    SceneSax sax(handler);
+    try {
+        if (!json::sax_parse(file, &sax)) {
+            std::cerr << "ERROR: Failed to parse scene JSON: " << sax.error << "\n";
+            return false;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: Failed to load scene: " << e.what() << "\n";
+        return false;
+    }
+    return true;
+}
+
+bool SceneReader::Walk(const json& sceneJson, Handler& handler) {
+    try {
+        if (!sceneJson.is_object()) {
+            std::cerr << "ERROR: Scene JSON is not an object\n";
+            return false;
+        }
+        auto assets = sceneJson.find("assets");
+        if (assets != sceneJson.end() && assets->is_object()) {
+            handler.OnAssets(*assets);
+        }
+        auto entities = sceneJson.find("entities");
+        if (entities != sceneJson.end() && entities->is_array()) {
+            for (const auto& entityJson : *entities) {
+                if (entityJson.is_object()) walkEntity(entityJson, handler);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: Failed to load scene: " << e.what() << "\n";
+        return false;
+    }
+    return true;
+}
+
+} // namespace engine
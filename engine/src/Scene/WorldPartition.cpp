@@ -0,0 +1,555 @@
+#include "Engine/Scene/WorldPartition.hpp"
+#include "Engine/Assets/Loaders/Mesh/MeshLoader.hpp"
+#include "Engine/Assets/Loaders/Texture/TextureLoader.hpp"
+#include "Engine/ECS/Components/Camera/CameraComponent.hpp"
+#include "Engine/Core/Profiling/Profiler.hpp"
+
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <set>
+#include <utility>
+
+namespace engine {
+
+using json = nlohmann::json;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Time constant of the camera velocity used for prefetching
+constexpr float kVelocitySmoothingSeconds = 0.25f;
+
+uint64_t packCoord(glm::ivec2 coord) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(coord.x)) << 32) | static_cast<uint32_t>(coord.y);
+}
+
+float pointRectDistance(glm::vec2 p, glm::vec2 lo, glm::vec2 hi) {
+    return glm::length(glm::max(glm::max(lo - p, p - hi), glm::vec2(0.0f)));
+}
+
+float pointSegmentDistance(glm::vec2 p, glm::vec2 a, glm::vec2 b) {
+    const glm::vec2 ab = b - a;
+    const float lengthSq = glm::dot(ab, ab);
+    const float t = lengthSq > 0.0f ? glm::clamp(glm::dot(p - a, ab) / lengthSq, 0.0f, 1.0f) : 0.0f;
+    return glm::length(p - (a + ab * t));
+}
+
+// Liang-Barsky: does the segment a-b touch the rectangle?
+bool segmentHitsRect(glm::vec2 a, glm::vec2 b, glm::vec2 lo, glm::vec2 hi) {
+    const glm::vec2 d = b - a;
+    float t0 = 0.0f, t1 = 1.0f;
+    for (int axis = 0; axis < 2; ++axis) {
+        if (std::abs(d[axis]) < 1e-6f) {
+            if (a[axis] < lo[axis] || a[axis] > hi[axis]) return false;
+            continue;
+        }
+        float tNear = (lo[axis] - a[axis]) / d[axis];
+        float tFar = (hi[axis] - a[axis]) / d[axis];
+        if (tNear > tFar) std::swap(tNear, tFar);
+        t0 = std::max(t0, tNear);
+        t1 = std::min(t1, tFar);
+        if (t0 > t1) return false;
+    }
+    return true;
+}
+
+// --- Split helpers ---
+
+// An asset path from the source scene, relative to where it is written now
+std::string rebasePath(const std::string& path, const fs::path& fromDir, const fs::path& toDir) {
+    const fs::path source(path);
+    if (source.is_absolute()) return path;
+    const fs::path target = fs::absolute(fromDir / source).lexically_normal();
+    const fs::path relative = target.lexically_relative(fs::absolute(toDir).lexically_normal());
+    return relative.empty() ? target.generic_string() : relative.generic_string();
+}
+
+struct AssetNames {
+    std::set<std::string> textures;
+    std::set<std::string> shaders;
+    std::set<std::string> models;
+    std::set<std::string> materials;  // Named ones, from "assets.materials"
+    bool camera = false;
+};
+
+void collectMaterialNames(const json& matJson, const json& namedMaterials, AssetNames& names) {
+    if (matJson.is_string()) {
+        const std::string name = matJson.get<std::string>();
+        names.materials.insert(name);
+        if (namedMaterials.contains(name)) collectMaterialNames(namedMaterials[name], namedMaterials, names);
+        return;
+    }
+    if (!matJson.is_object()) return;
+    if (matJson.contains("shader")) names.shaders.insert(matJson["shader"].get<std::string>());
+    for (const char* map : {"albedoMap", "specularMap", "normalMap", "emissiveMap"}) {
+        if (matJson.contains(map)) names.textures.insert(matJson[map].get<std::string>());
+    }
+}
+
+void collectEntityNames(const json& entityJson, const json& namedMaterials, AssetNames& names) {
+    for (const auto& compJson : entityJson.value("components", json::array())) {
+        const std::string type = compJson.value("type", "");
+        if (type == "Camera") names.camera = true;
+        if (type == "MeshRenderer" && compJson.contains("mesh")) names.models.insert(compJson["mesh"].get<std::string>());
+        if (type == "Model" && compJson.contains("model")) names.models.insert(compJson["model"].get<std::string>());
+        if (compJson.contains("material")) collectMaterialNames(compJson["material"], namedMaterials, names);
+    }
+    for (const auto& childJson : entityJson.value("children", json::array())) {
+        collectEntityNames(childJson, namedMaterials, names);
+    }
+}
+
+// The assets block of a scene written to toDir that only uses `names`
+json subsetAssets(const json& assetsJson, const AssetNames& names, const fs::path& fromDir, const fs::path& toDir) {
+    json subset = json::object();
+    auto rebase = [&](const json& path) { return rebasePath(path.get<std::string>(), fromDir, toDir); };
+
+    if (assetsJson.contains("textures")) {
+        for (const auto& [name, path] : assetsJson["textures"].items()) {
+            if (names.textures.count(name)) subset["textures"][name] = rebase(path);
+        }
+    }
+    if (assetsJson.contains("shaders")) {
+        for (const auto& [name, shaderJson] : assetsJson["shaders"].items()) {
+            if (!names.shaders.count(name)) continue;
+            json shader = shaderJson;
+            shader["vertex"] = rebase(shaderJson["vertex"]);
+            shader["fragment"] = rebase(shaderJson["fragment"]);
+            subset["shaders"][name] = shader;
+        }
+    }
+    if (assetsJson.contains("models")) {
+        for (const auto& [name, modelJson] : assetsJson["models"].items()) {
+            if (!names.models.count(name)) continue;
+            json model = modelJson;
+            if (model.is_object()) {
+                model["path"] = rebase(modelJson["path"]);
+            } else {
+                model = rebase(modelJson);
+            }
+            subset["models"][name] = model;
+        }
+    }
+    if (assetsJson.contains("materials")) {
+        for (const auto& [name, materialJson] : assetsJson["materials"].items()) {
+            if (names.materials.count(name)) subset["materials"][name] = materialJson;
+        }
+    }
+    return subset;
+}
+
+bool writeJson(const fs::path& path, const json& content) {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "WorldPartition: cannot write " << path.string() << "\n";
+        return false;
+    }
+    file << content.dump(2) << "\n";
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+bool WorldPartition::Load(const std::string& scenePath) {
+    ENGINE_PROFILE_SCOPE("WorldPartition::Load");
+
+    std::ifstream file(scenePath, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "WorldPartition: cannot open " << scenePath << "\n";
+        return false;
+    }
+
+    // Only the partition block is kept; the entities are SceneLoader's business
+    json manifest;
+    try {
+        manifest = json::parse(file, [](int depth, json::parse_event_t event, json& parsed) {
+            return !(depth == 1 && event == json::parse_event_t::key && parsed != "partition");
+        });
+    } catch (const std::exception& e) {
+        std::cerr << "WorldPartition: failed to parse " << scenePath << ": " << e.what() << "\n";
+        return false;
+    }
+    auto partitionIt = manifest.find("partition");
+    if (partitionIt == manifest.end() || !partitionIt->is_object()) {
+        return false;
+    }
+
+    const json& partition = *partitionIt;
+    Settings loaded;
+    try {
+        loaded.cellSize = partition.value("cellSize", loaded.cellSize);
+        loaded.loadRadius = partition.value("loadRadius", loaded.cellSize * 2.0f);
+        loaded.unloadRadius = partition.value("unloadRadius", loaded.loadRadius * 1.25f);
+        loaded.prefetchSeconds = partition.value("prefetchSeconds", loaded.prefetchSeconds);
+        loaded.maxConcurrentLoads = partition.value("maxConcurrentLoads", loaded.maxConcurrentLoads);
+        loaded.maxInstantiationsPerFrame = partition.value("maxInstantiationsPerFrame", loaded.maxInstantiationsPerFrame);
+        if (loaded.cellSize <= 0.0f) {
+            std::cerr << "WorldPartition: cellSize must be positive in " << scenePath << "\n";
+            return false;
+        }
+        if (loaded.unloadRadius < loaded.loadRadius) {
+            std::cerr << "WorldPartition: unloadRadius below loadRadius in " << scenePath
+                      << "; using loadRadius\n";
+            loaded.unloadRadius = loaded.loadRadius;
+        }
+
+        const fs::path sceneDir = fs::path(scenePath).parent_path();
+        std::vector<Cell> parsedCells;
+        for (const auto& cellJson : partition.value("cells", json::array())) {
+            Cell& cell = parsedCells.emplace_back();
+            cell.coord = glm::ivec2(cellJson["cell"][0].get<int>(), cellJson["cell"][1].get<int>());
+            cell.scenePath = (sceneDir / cellJson["scene"].get<std::string>()).generic_string();
+        }
+
+        settings = loaded;
+        stats = Stats();
+        cells = std::move(parsedCells);
+        cellIndex.clear();
+        active.clear();
+        modelRefs.clear();
+        textureRefs.clear();
+        hasLastPosition = false;
+        velocity = glm::vec3(0.0f);
+        for (size_t i = 0; i < cells.size(); ++i) {
+            cellIndex[packCoord(cells[i].coord)] = i;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "WorldPartition: invalid partition block in " << scenePath << ": " << e.what() << "\n";
+        return false;
+    }
+
+    stats.cells = cells.size();
+    std::cout << "✓ World partition: " << cells.size() << " cells of " << settings.cellSize << " units (load "
+              << settings.loadRadius << ", unload " << settings.unloadRadius << ")\n";
+    return true;
+}
+
+WorldPartition::Cell* WorldPartition::findCell(glm::ivec2 coord) {
+    auto it = cellIndex.find(packCoord(coord));
+    return it != cellIndex.end() ? &cells[it->second] : nullptr;
+}
+
+float WorldPartition::cellDistance(const Cell& cell, glm::vec2 from, glm::vec2 to) const {
+    const glm::vec2 lo = glm::vec2(cell.coord) * settings.cellSize;
+    const glm::vec2 hi = lo + glm::vec2(settings.cellSize);
+    if (segmentHitsRect(from, to, lo, hi)) return 0.0f;
+
+    float distance = std::min(pointRectDistance(from, lo, hi), pointRectDistance(to, lo, hi));
+    for (const glm::vec2 corner : {lo, hi, glm::vec2(lo.x, hi.y), glm::vec2(hi.x, lo.y)}) {
+        distance = std::min(distance, pointSegmentDistance(corner, from, to));
+    }
+    return distance;
+}
+
+void WorldPartition::Update(World& world, const CameraComponent& camera, float deltaTime) {
+    ENGINE_PROFILE_SCOPE("WorldPartition::Update");
+    if (cells.empty()) return;
+
+    const glm::vec3 position = camera.GetPosition();
+    if (hasLastPosition && deltaTime > 0.0f) {
+        const glm::vec3 instant = (position - lastPosition) / deltaTime;
+        velocity += (instant - velocity) * (1.0f - std::exp(-deltaTime / kVelocitySmoothingSeconds));
+    }
+    hasLastPosition = true;
+    lastPosition = position;
+
+    // Where the camera is heading; capped so one teleport doesn't sweep in a row of cells
+    const glm::vec2 here(position.x, position.z);
+    glm::vec2 ahead = glm::vec2(velocity.x, velocity.z) * settings.prefetchSeconds;
+    const float lookahead = glm::length(ahead);
+    if (lookahead > settings.loadRadius) ahead *= settings.loadRadius / lookahead;
+    const glm::vec2 there = here + ahead;
+
+    // Collect finished preparations and drop whatever is now out of range;
+    // a cell still preparing is dealt with once its job is done
+    for (size_t i = 0; i < active.size();) {
+        Cell& cell = cells[active[i]];
+        if (cell.state == CellState::Preparing && cell.job.IsDone()) {
+            if (cell.request->scene) {
+                cell.state = CellState::Ready;
+            } else {
+                std::cerr << "WorldPartition: failed to load cell " << cell.coord.x << "," << cell.coord.y << ": "
+                          << cell.scenePath << "\n";
+                cell.request.reset();
+                cell.state = CellState::Failed;  // Not retried
+            }
+        }
+
+        if (cellDistance(cell, here, there) > settings.unloadRadius) {
+            if (cell.state == CellState::Loaded) {
+                unloadCell(world, cell);
+            } else if (cell.state == CellState::Ready) {
+                cell.request.reset();
+                cell.state = CellState::Unloaded;
+            }
+        }
+
+        if (cell.state == CellState::Unloaded || cell.state == CellState::Failed) {
+            active[i] = active.back();
+            active.pop_back();
+        } else {
+            ++i;
+        }
+    }
+
+    instantiateReady(world, here);
+    startLoads(here, there, here);
+
+    stats.loaded = 0;
+    stats.pending = 0;
+    stats.entities = 0;
+    for (size_t index : active) {
+        const Cell& cell = cells[index];
+        if (cell.state == CellState::Loaded) {
+            stats.loaded++;
+            stats.entities += cell.entityCount;
+        } else {
+            stats.pending++;
+        }
+    }
+}
+
+void WorldPartition::startLoads(glm::vec2 from, glm::vec2 to, glm::vec2 position) {
+    int preparing = 0;
+    for (size_t index : active) {
+        if (cells[index].state == CellState::Preparing) preparing++;
+    }
+    if (preparing >= settings.maxConcurrentLoads) return;
+
+    // Grid slots that can lie within loadRadius of the path, nearest first
+    const glm::vec2 reach(settings.loadRadius);
+    const glm::ivec2 lo(glm::floor((glm::min(from, to) - reach) / settings.cellSize));
+    const glm::ivec2 hi(glm::floor((glm::max(from, to) + reach) / settings.cellSize));
+    std::vector<std::pair<float, Cell*>> wanted;
+    for (int z = lo.y; z <= hi.y; ++z) {
+        for (int x = lo.x; x <= hi.x; ++x) {
+            Cell* cell = findCell(glm::ivec2(x, z));
+            if (!cell || cell->state != CellState::Unloaded) continue;
+            if (cellDistance(*cell, from, to) > settings.loadRadius) continue;
+            wanted.emplace_back(cellDistance(*cell, position, position), cell);
+        }
+    }
+    std::sort(wanted.begin(), wanted.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    for (const auto& [distance, cell] : wanted) {
+        if (preparing++ >= settings.maxConcurrentLoads) break;
+
+        // Workers only (and so is the import it fans out), so a frame's
+        // ParallelFor never picks up any of a cell's work
+        auto request = std::make_shared<CellRequest>();
+        cell->request = request;
+        cell->job = JobSystem::Instance().SubmitBackground([request, path = cell->scenePath]() {
+            request->scene = SceneLoader::PrepareScene(path);
+        });
+        cell->state = CellState::Preparing;
+        active.push_back(static_cast<size_t>(cell - cells.data()));
+    }
+}
+
+void WorldPartition::instantiateReady(World& world, glm::vec2 position) {
+    std::vector<std::pair<float, Cell*>> ready;
+    for (size_t index : active) {
+        Cell& cell = cells[index];
+        if (cell.state == CellState::Ready) ready.emplace_back(cellDistance(cell, position, position), &cell);
+    }
+    std::sort(ready.begin(), ready.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    if (ready.size() > static_cast<size_t>(std::max(settings.maxInstantiationsPerFrame, 0))) {
+        ready.resize(static_cast<size_t>(std::max(settings.maxInstantiationsPerFrame, 0)));
+    }
+
+    for (const auto& [distance, cell] : ready) {
+        const auto start = std::chrono::steady_clock::now();
+
+        const size_t firstEntity = world.entities.size();
+        cell->root = world.CreateEntity("Cell " + std::to_string(cell->coord.x) + "," + std::to_string(cell->coord.y));
+        SceneLoader::InstantiateScene(*cell->request->scene, world, cell->root, &cell->assets);
+        cell->entityCount = world.entities.size() - firstEntity;
+        cell->request.reset();  // Unmaps the cell file
+        cell->state = CellState::Loaded;
+        if (onCellLoaded) onCellLoaded(cell->root);
+
+        for (const SceneLoader::SceneAssets::Entry& entry : cell->assets.models) {
+            auto [it, inserted] = modelRefs.try_emplace(entry.name);
+            if (inserted) it->second.owned = entry.created;
+            it->second.cells++;
+        }
+        for (const SceneLoader::SceneAssets::Entry& entry : cell->assets.textures) {
+            auto [it, inserted] = textureRefs.try_emplace(entry.name);
+            if (inserted) it->second.owned = entry.created;
+            it->second.cells++;
+        }
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        stats.loads++;
+        stats.lastInstantiateMs = elapsed.count();
+        stats.maxInstantiateMs = std::max(stats.maxInstantiateMs, elapsed.count());
+    }
+}
+
+void WorldPartition::unloadCell(World& world, Cell& cell) {
+    ENGINE_PROFILE_SCOPE("WorldPartition::UnloadCell");
+
+    // Entities first: nothing may point at a mesh or texture once it goes
+    world.DestroyEntity(cell.root);
+    cell.root = nullptr;
+    cell.entityCount = 0;
+    releaseAssets(cell);
+    cell.state = CellState::Unloaded;
+    stats.unloads++;
+}
+
+void WorldPartition::releaseAssets(Cell& cell) {
+    for (const SceneLoader::SceneAssets::Entry& entry : cell.assets.models) {
+        auto it = modelRefs.find(entry.name);
+        if (it == modelRefs.end() || --it->second.cells > 0) continue;
+        if (it->second.owned) {
+            MeshLoader::Instance().Unload(entry.name);
+            stats.releasedModels++;
+        }
+        modelRefs.erase(it);
+    }
+    for (const SceneLoader::SceneAssets::Entry& entry : cell.assets.textures) {
+        auto it = textureRefs.find(entry.name);
+        if (it == textureRefs.end() || --it->second.cells > 0) continue;
+        if (it->second.owned) {
+            TextureLoader::Instance().Unload(entry.name);
+            stats.releasedTextures++;
+        }
+        textureRefs.erase(it);
+    }
+    cell.assets = SceneLoader::SceneAssets();
+}
+
+void WorldPartition::UnloadAll(World& world) {
+    for (size_t index : active) {
+        Cell& cell = cells[index];
+        if (cell.state == CellState::Loaded) {
+            unloadCell(world, cell);
+        } else {
+            // A job still running fills its own copy of the request
+            cell.request.reset();
+            cell.job = JobHandle();
+            cell.state = CellState::Unloaded;
+        }
+    }
+    active.clear();
+    stats.loaded = 0;
+    stats.pending = 0;
+    stats.entities = 0;
+}
+
+bool WorldPartition::Split(const std::string& scenePath, const std::string& outPath, float cellSize) {
+    ENGINE_PROFILE_SCOPE("WorldPartition::Split");
+
+    if (cellSize <= 0.0f) {
+        std::cerr << "WorldPartition: cell size must be positive\n";
+        return false;
+    }
+
+    json sceneJson;
+    {
+        std::ifstream file(scenePath);
+        if (!file.is_open()) {
+            std::cerr << "WorldPartition: cannot open " << scenePath << "\n";
+            return false;
+        }
+        try {
+            file >> sceneJson;
+        } catch (const std::exception& e) {
+            std::cerr << "WorldPartition: failed to parse " << scenePath << ": " << e.what() << "\n";
+            return false;
+        }
+    }
+
+    auto directoryOf = [](const std::string& path) {
+        const fs::path parent = fs::path(path).parent_path();
+        return parent.empty() ? fs::path(".") : parent;
+    };
+    const fs::path sourceDir = directoryOf(scenePath);
+    const fs::path outDir = directoryOf(outPath);
+    const std::string cellDirName = fs::path(outPath).stem().string() + "_cells";
+    const fs::path cellDir = outDir / cellDirName;
+
+    try {
+        std::error_code ec;
+        fs::create_directories(cellDir, ec);
+        if (ec) {
+            std::cerr << "WorldPartition: cannot create " << cellDir.string() << "\n";
+            return false;
+        }
+
+        const json assetsJson = sceneJson.value("assets", json::object());
+        const json namedMaterials = assetsJson.value("materials", json::object());
+        json persistent = json::array();
+        AssetNames persistentNames;
+        std::map<std::pair<int, int>, std::pair<json, AssetNames>> cellEntities;  // Ordered: stable output
+
+        for (const auto& entityJson : sceneJson.value("entities", json::array())) {
+            AssetNames names;
+            collectEntityNames(entityJson, namedMaterials, names);
+            if (names.camera) {
+                collectEntityNames(entityJson, namedMaterials, persistentNames);
+                persistent.push_back(entityJson);
+                continue;
+            }
+
+            glm::vec2 position(0.0f);
+            const json transform = entityJson.value("transform", json::object());
+            if (transform.contains("position")) {
+                position = glm::vec2(transform["position"][0].get<float>(), transform["position"][2].get<float>());
+            }
+            const glm::ivec2 coord(glm::floor(position / cellSize));
+            auto& [entities, cellNames] = cellEntities[{coord.x, coord.y}];
+            if (entities.is_null()) entities = json::array();
+            entities.push_back(entityJson);
+            cellNames.textures.insert(names.textures.begin(), names.textures.end());
+            cellNames.shaders.insert(names.shaders.begin(), names.shaders.end());
+            cellNames.models.insert(names.models.begin(), names.models.end());
+            cellNames.materials.insert(names.materials.begin(), names.materials.end());
+        }
+
+        json cellList = json::array();
+        for (const auto& [coord, content] : cellEntities) {
+            const std::string stem = std::to_string(coord.first) + "_" + std::to_string(coord.second);
+            const fs::path cellJsonPath = cellDir / (stem + ".json");
+            const fs::path cellBinaryPath = cellDir / (stem + ESceneFormat::Extension);
+
+            json cellScene;
+            cellScene["assets"] = subsetAssets(assetsJson, content.second, sourceDir, cellDir);
+            cellScene["entities"] = content.first;
+            if (!writeJson(cellJsonPath, cellScene)) return false;
+
+            // The cell loads from its binary form next to the JSON (same relative asset paths)
+            const bool converted = SceneLoader::ConvertScene(cellJsonPath.string(), cellBinaryPath.string());
+            const std::string cellFile = (converted ? stem + ESceneFormat::Extension : stem + ".json");
+            cellList.push_back({{"cell", {coord.first, coord.second}}, {"scene", cellDirName + "/" + cellFile}});
+        }
+
+        json manifest;
+        manifest["assets"] = subsetAssets(assetsJson, persistentNames, sourceDir, outDir);
+        if (assetsJson.contains("residency")) manifest["assets"]["residency"] = assetsJson["residency"];
+        manifest["entities"] = persistent;
+        manifest["partition"] = {{"cellSize", cellSize},
+                                 {"loadRadius", cellSize * 2.0f},
+                                 {"unloadRadius", cellSize * 2.5f},
+                                 {"prefetchSeconds", Settings().prefetchSeconds},
+                                 {"cells", cellList}};
+        if (!writeJson(outPath, manifest)) return false;
+
+        std::cout << "✓ Partitioned " << scenePath << ": " << cellEntities.size() << " cells of " << cellSize
+                  << " units, " << persistent.size() << " persistent entities -> " << outPath << "\n";
+    } catch (const std::exception& e) {
+        std::cerr << "WorldPartition: failed to split " << scenePath << ": " << e.what() << "\n";
+        return false;
+    }
+    return true;
+}
+
+} // namespace engine
@@ -5,10 +5,13 @@ in vec3 vNormal;
 in vec2 vTexCoords;
 
 uniform vec4 uTint;
+uniform uint uMaterialID;
 
-out vec4 FragColor;
+layout(location = 0) out vec4 FragColor;
+layout(location = 1) out uint MaterialID;
 
 // DEBUG VERSION: prove we're seeing the tint
 void main() {
     FragColor = uTint;
+    MaterialID = uMaterialID;
 }
@@ -1,10 +1,11 @@
 #version 330 core
+#include "include/vertex_decode.glsl"
+#include "include/instancing.glsl"
 
 layout(location = 0) in vec3 aPosition;
-layout(location = 1) in vec3 aNormal;
+layout(location = 1) in vec2 aNormal;     // Octahedral
 layout(location = 2) in vec2 aTexCoords;
 
-uniform mat4 uModel;
 uniform mat4 uView;
 uniform mat4 uProj;
 
@@ -13,8 +14,9 @@ out vec3 vNormal;
 out vec2 vTexCoords;
 
 void main() {
-    vPosition = vec3(uModel * vec4(aPosition, 1.0));
-    vNormal = mat3(transpose(inverse(uModel))) * aNormal;
+    mat4 model = getModelMatrix();
+    vPosition = vec3(model * vec4(decodePosition(aPosition), 1.0));
+    vNormal = mat3(transpose(inverse(model))) * decodeOctNormal(aNormal);
     vTexCoords = aTexCoords;
     
     gl_Position = uProj * uView * vec4(vPosition, 1.0);
@@ -0,0 +1,12 @@
+// Per-instance model matrices - pulled in with #include "include/instancing.glsl"
+
+// The renderer batches draws of one mesh with matching materials and feeds
+// their matrices through aInstanceModel (locations 3-6, one per instance);
+// single draws set uModel and uInstanced = false
+uniform mat4 uModel;
+uniform bool uInstanced;
+layout(location = 3) in mat4 aInstanceModel;
+
+mat4 getModelMatrix() {
+    return uInstanced ? aInstanceModel : uModel;
+}
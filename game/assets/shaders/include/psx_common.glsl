@@ -0,0 +1,17 @@
+// Shared PS1 helpers - pulled in with #include "include/psx_common.glsl"
+
+// Affine texture mapping: with PSX_AFFINE_UV the UVs are interpolated in
+// screen space (no perspective correction), the PS1's texture warping
+#ifdef PSX_AFFINE_UV
+#define PSX_UV_INTERP noperspective
+#else
+#define PSX_UV_INTERP smooth
+#endif
+
+// Snap a clip-space position to a coarse screen grid (PS1 vertex wobble)
+vec4 psxSnapVertex(vec4 clipPos, vec2 snapRes, float strength) {
+    vec3 ndc = clipPos.xyz / clipPos.w;
+    vec2 snapped = floor(ndc.xy * snapRes) / snapRes;
+    ndc.xy = mix(ndc.xy, snapped, clamp(strength, 0.0, 1.0));
+    return vec4(ndc * clipPos.w, clipPos.w);
+}
@@ -0,0 +1,18 @@
+// Decoding for the engine's packed vertex formats (see engine::VertexFormat)
+
+// Positions arrive AABB-relative (unorm16 -> [0,1]); float meshes use scale 1, offset 0
+uniform vec3 uPosScale;
+uniform vec3 uPosOffset;
+
+vec3 decodePosition(vec3 p) {
+    return p * uPosScale + uPosOffset;
+}
+
+// Octahedral normal -> unit vector
+vec3 decodeOctNormal(vec2 e) {
+    vec3 v = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (v.z < 0.0) {
+        v.xy = (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    }
+    return normalize(v);
+}
@@ -1,42 +1,41 @@
 #version 330 core
+// Keywords (see ShaderLoader): PSX_VERTEX_SNAP, PSX_AFFINE_UV, PSX_VERTEX_LIGHTING
+#include "include/psx_common.glsl"
+#include "include/vertex_decode.glsl"
+#include "include/instancing.glsl"
+
 layout(location=0) in vec3 aPosition;
-layout(location=1) in vec3 aNormal;
+layout(location=1) in vec2 aNormal;       // Octahedral
 layout(location=2) in vec2 aTexCoords;
 
-uniform mat4 uModel;
 uniform mat4 uView;
 uniform mat4 uProj;
 uniform vec2  uSnapRes;       // e.g., (320, 240) for PS1 resolution
 uniform float uSnapStrength;  // 0..1
 
 // Affine texture mapping (PS1's signature look)
-noperspective out vec2 vTexCoords;
-noperspective out float vDepth;
+PSX_UV_INTERP out vec2 vTexCoords;
 
 // Vertex lighting (PS1 didn't do per-pixel lighting)
 out vec3 vColor;
 
 void main() {
-    vec4 worldPos = uModel * vec4(aPosition, 1.0);
-    vec4 viewPos = uView * worldPos;
-    vec4 clipPos = uProj * viewPos;
+    mat4 model = getModelMatrix();
+    vec4 clipPos = uProj * uView * model * vec4(decodePosition(aPosition), 1.0);
     
     // === VERTEX SNAPPING (PS1's wobbly vertices) ===
-    vec3 ndc = clipPos.xyz / clipPos.w;
-    if (uSnapStrength > 0.0 && uSnapRes.x > 1.0 && uSnapRes.y > 1.0) {
-        vec2 snapped = floor(ndc.xy * uSnapRes) / uSnapRes;
-        ndc.xy = mix(ndc.xy, snapped, clamp(uSnapStrength, 0.0, 1.0));
-    }
-    
-    gl_Position = vec4(ndc * clipPos.w, clipPos.w);
+#ifdef PSX_VERTEX_SNAP
+    clipPos = psxSnapVertex(clipPos, uSnapRes, uSnapStrength);
+#endif
+    gl_Position = clipPos;
     
     // === AFFINE TEXTURE MAPPING (no perspective correction) ===
-    // Store un-corrected UVs and depth for manual interpolation
+    // Store un-corrected UVs for manual interpolation
     vTexCoords = aTexCoords;
-    vDepth = clipPos.w;
     
     // === VERTEX LIGHTING (simple directional light) ===
-    vec3 normal = normalize(mat3(uModel) * aNormal);
+#ifdef PSX_VERTEX_LIGHTING
+    vec3 normal = normalize(mat3(model) * decodeOctNormal(aNormal));
     vec3 lightDir = normalize(vec3(1.0, 1.0, 1.0));
     
     float diff = max(dot(normal, lightDir), 0.0);
@@ -44,4 +43,7 @@ void main() {
     vec3 ambient = vec3(0.3);
     
     vColor = ambient + diffuse;
-}
\ No newline at end of file
+#else
+    vColor = vec3(1.0);
+#endif
+}
@@ -6,8 +6,10 @@ in vec2 vTexCoords;
 
 uniform sampler2D uAlbedoMap;
 uniform vec4 uTint;
+uniform uint uMaterialID;
 
-out vec4 FragColor;
+layout(location = 0) out vec4 FragColor;
+layout(location = 1) out uint MaterialID;
 
 void main() {
     vec3 normal = normalize(vNormal);
@@ -22,4 +24,5 @@ void main() {
     vec3 result = (ambient + diffuse) * texColor.rgb;
 
     FragColor = vec4(result, texColor.a * uTint.a);
+    MaterialID = uMaterialID;
 }
\ No newline at end of file
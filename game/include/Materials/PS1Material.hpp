@@ -3,6 +3,7 @@
 
 #include "Engine/Engine.hpp"
 #include <glm/glm.hpp>
+#include <string>
 
 /**
  * PS1Material - Game-specific material for PlayStation 1 era visual effects
@@ -13,6 +14,14 @@
  * - Color depth reduction (color banding)
  * - Ordered dithering
  * - Distance fog
+ *
+ * Quantization, dithering and fog are applied by the renderer's full-screen
+ * post pass; this material only reports its settings for it.
+ *
+ * The vertex/texture effects are compiled in, not branched on: SelectVariant()
+ * picks the "psx" shader variant whose keywords match the enabled features,
+ * so a disabled effect has no shader cost at all. Call it after changing
+ * snapStrength, affineMapping or vertexLighting (the presets do).
  */
 class PS1Material : public engine::TexturedMaterial {
 public:
@@ -20,6 +29,12 @@ public:
     glm::vec2 snapResolution = glm::vec2(320.0f, 240.0f);  // PS1 screen resolution
     float snapStrength = 1.0f;  // 0.0 = off, 1.0 = full PS1 wobble
     
+    // === AFFINE TEXTURE MAPPING ===
+    bool affineMapping = true;
+    
+    // === VERTEX LIGHTING ===
+    bool vertexLighting = true;
+    
     // === COLOR QUANTIZATION ===
     float colorDepth = 32.0f;  // 32 = PS1 (5-bit), 64 = smoother, 256 = disabled
     
@@ -31,9 +46,19 @@ public:
     float fogEnd = 50.0f;
     glm::vec3 fogColor = glm::vec3(0.5f, 0.5f, 0.6f);
     
+    // ShaderLoader entry the variants come from
+    std::string shaderName = "psx";
+    
     PS1Material();
     
     void Setup() override;
+    std::unique_ptr<engine::Material> Clone() const override;
+    bool GetPostProcessParams(engine::PostProcessParams& out) const override;
+    bool CanInstanceWith(const engine::Material& other) const override;
+    
+    // Swap `shader` for the variant matching the enabled features.
+    // No-op until a shader has been assigned.
+    void SelectVariant();
     
     // Preset configurations
     void SetAuthenticPS1();     // Maximum PS1 accuracy (very wobbly)
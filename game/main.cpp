@@ -2,27 +2,47 @@
 #include "CameraController.hpp"
 #include "Materials/PS1Material.hpp"
 #include <GLFW/glfw3.h>
+#include <chrono>
+#include <filesystem>
 #include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
 
-void ConvertToPS1Materials(engine::World* world) {
-    std::cout << "\n--- Converting to PS1 Materials ---\n";
-    
+// --upload-benchmark: AbandonedHouse is loaded at kBenchmarkLoadFrame and the
+// run ends at kBenchmarkFrames, printing frame-time histograms for both halves
+constexpr int kBenchmarkLoadFrame = 120;
+constexpr int kBenchmarkFrames = 600;
+
+// Returns how many PS1Materials were created: one per distinct material, so
+// renderers that shared a material still share one (per-renderer overrides
+// are kept). Every PS1Material uses the same cached sampler, so equal
+// materials stay batchable into instanced draws (see Material::CanInstanceWith),
+// including those of later streamed cells.
+size_t ConvertEntitiesToPS1(const std::vector<engine::Entity*>& entities) {
     // Get the PSX shader
     engine::Shader* psxShader = engine::ShaderLoader::Instance().Get("psx");
     if (!psxShader) {
         std::cerr << "ERROR: PSX shader not found! Cannot convert to PS1 materials.\n";
-        return;
+        return 0;
     }
     
-    // Iterate through all entities
-    for (auto* entity : world->entities) {
+    std::map<const engine::Material*, std::shared_ptr<PS1Material>> converted;  // By the material it replaces
+    for (auto* entity : entities) {
         auto* renderer = entity->GetComponent<engine::MeshRendererComponent>();
         if (!renderer || !renderer->material) {
             continue;
         }
         
+        std::shared_ptr<PS1Material>& replacement = converted[renderer->material.get()];
+        if (replacement) {
+            renderer->material = replacement;
+            continue;
+        }
+        
         // Create new PS1Material
-        auto ps1Mat = std::make_unique<PS1Material>();
+        auto ps1Mat = std::make_shared<PS1Material>();
         
         // Copy shader reference
         ps1Mat->shader = std::shared_ptr<engine::Shader>(psxShader, [](engine::Shader*) {
@@ -52,24 +72,104 @@ void ConvertToPS1Materials(engine::World* world) {
         ps1Mat->SetAuthenticPS1();  // Subtle, playable preset
         
         // Replace the material
+        replacement = ps1Mat;
         renderer->material = std::move(ps1Mat);
-        
-        std::cout << "  ✓ Converted " << entity->name << " to PS1Material\n";
     }
-    
+    return converted.size();
+}
+
+void ConvertToPS1Materials(engine::World* world) {
+    std::cout << "\n--- Converting to PS1 Materials ---\n";
+    const size_t converted = ConvertEntitiesToPS1(world->entities);
+    std::cout << "  ✓ Converted " << converted << " materials to PS1Material\n";
     std::cout << "--- PS1 Conversion Complete ---\n\n";
 }
 
-int main() {
+// A streamed cell's entities, root first
+std::vector<engine::Entity*> CollectSubtree(engine::Entity* root) {
+    std::vector<engine::Entity*> entities{root};
+    for (size_t i = 0; i < entities.size(); ++i) {
+        entities.insert(entities.end(), entities[i]->children.begin(), entities[i]->children.end());
+    }
+    return entities;
+}
+
+// Benchmark payload: AbandonedHouse's node hierarchy as entities, with each
+// primitive's base-colour texture streamed in alongside
+void SpawnAbandonedHouse(engine::World* world) {
+    const std::string directory = "game/assets/models/AbandonedHouse/";
+    engine::Model* model = engine::MeshLoader::Instance().Load("abandoned_house", directory + "scene.gltf");
+    engine::Shader* psxShader = engine::ShaderLoader::Instance().Get("psx");
+    if (!model || !psxShader) {
+        std::cerr << "ERROR: AbandonedHouse benchmark assets unavailable\n";
+        return;
+    }
+    
+    std::map<const engine::ModelMaterial*, std::shared_ptr<PS1Material>> materials;  // Shared per source material
+    std::set<engine::Texture*> textures;
+    auto makeMaterial = [&](const engine::ModelMaterial* source) -> std::shared_ptr<engine::Material> {
+        std::shared_ptr<PS1Material>& material = materials[source];
+        if (material) return material;
+        material = std::make_shared<PS1Material>();
+        material->shader = std::shared_ptr<engine::Shader>(psxShader, [](engine::Shader*) {
+            // Empty deleter - ShaderLoader owns the shader
+        });
+        if (source && !source->baseColorTexture.empty()) {
+            const std::string path = model->directory + "/" + source->baseColorTexture;
+            material->albedoMap = engine::TextureLoader::Instance().Load(path, path);
+            if (material->albedoMap) textures.insert(material->albedoMap);
+        }
+        material->SetAuthenticPS1();
+        return material;
+    };
+    
+    engine::Entity* root = world->CreateEntity("AbandonedHouse");
+    const size_t firstEntity = world->entities.size();
+    engine::ModelInstantiator::Instantiate(*world, *model, root, makeMaterial);
+    
+    std::cout << "  ✓ Spawned AbandonedHouse: " << world->entities.size() - firstEntity << " entities, "
+              << model->meshes.size() << " meshes, " << textures.size() << " textures queued\n";
+}
+
+int main(int argc, char** argv) {
+    ENGINE_PROFILE_THREAD_NAME("Main");
+    
     // ═══════════════════════════════════════════════════════════════
     // INITIALIZE RENDERER
     // ═══════════════════════════════════════════════════════════════
     engine::Renderer renderer;
+    
+    // --upload-thread: fill buffers/textures on a second, shared GL context
+    bool uploadBenchmark = false;
+    std::string worldScenePath;  // --world: a partitioned scene to stream
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--world" && i + 1 < argc) {
+            worldScenePath = argv[++i];
+        } else if (std::string(argv[i]) == "--upload-thread") {
+            renderer.SetUploadThreadEnabled(true);
+        } else if (std::string(argv[i]) == "--upload-benchmark") {
+            uploadBenchmark = true;
+        }
+    }
+    
     if (!renderer.Init()) {
         std::cerr << "Failed to initialize renderer\n";
         return -1;
     }
     
+    // Prefer the AssetCooker's output (the binary scene, then its JSON twin);
+    // fall back to the sources
+    std::string scenePath = "game/assets/scenes/example_scene.json";
+    for (const char* cooked : {"game/cooked/scenes/example_scene.escene", "game/cooked/scenes/example_scene.json"}) {
+        if (std::filesystem::exists(cooked)) {
+            scenePath = cooked;
+            break;
+        }
+    }
+    if (!worldScenePath.empty()) {
+        scenePath = worldScenePath;
+    }
+    
     // ═══════════════════════════════════════════════════════════════
     // INITIALIZE INPUT SYSTEM
     // ═══════════════════════════════════════════════════════════════
@@ -79,7 +179,7 @@ int main() {
     // ═══════════════════════════════════════════════════════════════
     // LOAD SCENE FROM FILE
     // ═══════════════════════════════════════════════════════════════
-    auto world = engine::SceneLoader::LoadScene("game/assets/scenes/example_scene.json");
+    auto world = engine::SceneLoader::LoadScene(scenePath);
     if (!world) {
         std::cerr << "Failed to load scene\n";
         return -1;
@@ -90,6 +190,15 @@ int main() {
     // ═══════════════════════════════════════════════════════════════
     ConvertToPS1Materials(world.get());
     
+    // ═══════════════════════════════════════════════════════════════
+    // WORLD STREAMING (--world with a "partition" block)
+    // ═══════════════════════════════════════════════════════════════
+    engine::WorldPartition partition;
+    const bool streaming = !worldScenePath.empty() && partition.Load(worldScenePath);
+    partition.SetCellLoadedCallback([](engine::Entity* root) {
+        ConvertEntitiesToPS1(CollectSubtree(root));
+    });
+    
     // ═══════════════════════════════════════════════════════════════
     // FIND CAMERA
     // ═══════════════════════════════════════════════════════════════
@@ -122,6 +231,7 @@ int main() {
     std::cout << "  Q/E       - Move up/down\n";
     std::cout << "  Right Mouse - Look around\n";
     std::cout << "  Shift     - Sprint\n";
+    std::cout << "  F3        - Print render stats\n";
     std::cout << "  ESC       - Exit\n";
     std::cout << "═══════════════════════════════════════\n";
     std::cout << "PS1 Effects Active:\n";
@@ -134,12 +244,48 @@ int main() {
     
     float lastFrame = 0.0f;
     
+    // Upload benchmark state (frame times before / after the mid-run load)
+    int frameIndex = 0;
+    engine::FrameTimeHistogram baselineFrames;
+    engine::FrameTimeHistogram loadingFrames;
+    double importMs = 0.0;
+    if (uploadBenchmark) {
+        glfwSwapInterval(0);  // Measure frames, not vsync
+    }
+    
     while (!glfwWindowShouldClose(renderer.GetWindow())) {
         // Calculate delta time
         float currentFrame = static_cast<float>(glfwGetTime());
         float deltaTime = currentFrame - lastFrame;
         lastFrame = currentFrame;
         
+        if (uploadBenchmark) {
+            // Frame 0's delta is time since startup
+            if (frameIndex > 0) {
+                (frameIndex <= kBenchmarkLoadFrame ? baselineFrames : loadingFrames).Add(deltaTime * 1000.0);
+            }
+            
+            if (frameIndex == kBenchmarkLoadFrame) {
+                // The import itself is CPU work outside the upload path; time it separately
+                const auto importStart = std::chrono::steady_clock::now();
+                SpawnAbandonedHouse(world.get());
+                const std::chrono::duration<double, std::milli> importTime =
+                    std::chrono::steady_clock::now() - importStart;
+                importMs = importTime.count();
+                lastFrame = static_cast<float>(glfwGetTime());
+            }
+            
+            if (frameIndex == kBenchmarkFrames) {
+                std::cout << "\nUpload benchmark - before load:\n";
+                baselineFrames.Print(std::cout);
+                std::cout << "After load (import " << importMs << " ms, excluded; "
+                          << engine::UploadQueue::Instance().GetPendingCount() << " uploads still queued):\n";
+                loadingFrames.Print(std::cout);
+                glfwSetWindowShouldClose(renderer.GetWindow(), true);
+            }
+            frameIndex++;
+        }
+        
         // Poll input events
         glfwPollEvents();
         
@@ -151,9 +297,28 @@ int main() {
             glfwSetWindowShouldClose(renderer.GetWindow(), true);
         }
         
+        // Print per-frame renderer statistics
+        if (input.IsKeyJustPressed(GLFW_KEY_F3)) {
+            renderer.PrintStats(std::cout);
+            engine::ResidencyManager::Instance().PrintReport(std::cout);
+            if (streaming) {
+                const auto& stats = partition.GetStats();
+                std::cout << "World partition: " << stats.loaded << "/" << stats.cells << " cells loaded, "
+                          << stats.pending << " pending, " << stats.entities << " entities; " << stats.loads
+                          << " loads, " << stats.unloads << " unloads, " << stats.releasedModels << " models and "
+                          << stats.releasedTextures << " textures released; worst instantiation "
+                          << stats.maxInstantiateMs << " ms\n";
+            }
+        }
+        
         // Update camera controller
         cameraController.Update(deltaTime);
         
+        // Stream cells around where the camera is heading
+        if (streaming) {
+            partition.Update(*world, *camera, deltaTime);
+        }
+        
         // ═══════════════════════════════════════════════════════════
         // UPDATE GAME LOGIC HERE
         // ═══════════════════════════════════════════════════════════
@@ -179,6 +344,12 @@ int main() {
     // ═══════════════════════════════════════════════════════════════
     std::cout << "\n✓ Shutting down gracefully\n";
     
+    // Dump CPU/GPU timings (no-op unless built with ENGINE_ENABLE_PROFILING)
+    ENGINE_PROFILE_WRITE_TRACE("profile_trace.json");
+    
+    // Streamed cells release their assets before the loaders go
+    partition.UnloadAll(*world);
+    
     // Clear asset loaders
     engine::ShaderLoader::Instance().Clear();
     engine::TextureLoader::Instance().Clear();
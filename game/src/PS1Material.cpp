@@ -1,14 +1,23 @@
 #include "Materials/PS1Material.hpp"
 #include <iostream>
 
+// Nearest-neighbor filtering (critical for PS1 look!), one sampler for every PS1Material
+static std::shared_ptr<engine::Sampler> nearestSampler() {
+    engine::Sampler::State state;
+    state.minFilter = GL_NEAREST;
+    state.magFilter = GL_NEAREST;
+    return engine::SamplerCache::Instance().Get(state);
+}
+
 PS1Material::PS1Material() {
     // Default to authentic PS1 settings
     SetAuthenticPS1();
     
-    // Setup nearest-neighbor filtering (critical for PS1 look!)
-    sampler = std::make_shared<engine::Sampler>();
-    sampler->SetMinFilter(GL_NEAREST);
-    sampler->SetMagFilter(GL_NEAREST);
+    sampler = nearestSampler();
+}
+
+std::unique_ptr<engine::Material> PS1Material::Clone() const {
+    return std::make_unique<PS1Material>(*this);
 }
 
 void PS1Material::Setup() {
@@ -25,17 +34,56 @@ void PS1Material::Setup() {
     // === VERTEX SNAPPING ===
     shader->setVec2("uSnapRes", snapResolution);
     shader->setFloat("uSnapStrength", snapStrength);
-    
-    // === COLOR DEPTH REDUCTION ===
-    shader->setFloat("uColorDepth", colorDepth);
-    
-    // === DITHERING ===
-    shader->setFloat("uDitherStrength", ditherStrength);
-    
-    // === DISTANCE FOG ===
-    shader->setFloat("uFogStart", fogStart);
-    shader->setFloat("uFogEnd", fogEnd);
-    shader->setVec3("uFogColor", fogColor);
+}
+
+bool PS1Material::GetPostProcessParams(engine::PostProcessParams& out) const {
+    // Nothing to resolve: keep material ID 0 so the post pass passes the pixel through
+    const bool quantize = colorDepth < 256.0f;
+    const bool dither = ditherStrength > 0.0f;
+    const bool fog = fogStart < 1000.0f;
+    if (!quantize && !dither && !fog) {
+        return false;
+    }
+
+    // Colour depth, dithering and fog are resolved per pixel by the post pass
+    out.colorDepth = colorDepth;
+    out.ditherStrength = ditherStrength;
+    out.fogStart = fogStart;
+    out.fogEnd = fogEnd;
+    out.fogColor = fogColor;
+    return true;
+}
+
+bool PS1Material::CanInstanceWith(const engine::Material& other) const {
+    // TexturedMaterial has already checked that `other` is a PS1Material
+    if (!engine::TexturedMaterial::CanInstanceWith(other)) return false;
+    const auto& ps1 = static_cast<const PS1Material&>(other);
+    return snapResolution == ps1.snapResolution && snapStrength == ps1.snapStrength &&
+           colorDepth == ps1.colorDepth && ditherStrength == ps1.ditherStrength &&
+           fogStart == ps1.fogStart && fogEnd == ps1.fogEnd && fogColor == ps1.fogColor;
+}
+
+void PS1Material::SelectVariant() {
+    if (!shader) return;
+
+    auto& loader = engine::ShaderLoader::Instance();
+    uint32_t features = 0;
+    if (snapStrength > 0.0f && snapResolution.x > 1.0f && snapResolution.y > 1.0f) {
+        features |= loader.GetKeywordBit(shaderName, "PSX_VERTEX_SNAP");
+    }
+    if (affineMapping) {
+        features |= loader.GetKeywordBit(shaderName, "PSX_AFFINE_UV");
+    }
+    if (vertexLighting) {
+        features |= loader.GetKeywordBit(shaderName, "PSX_VERTEX_LIGHTING");
+    }
+
+    engine::Shader* variant = loader.GetVariant(shaderName, features);
+    if (!variant || variant == shader.get()) return;
+
+    shader = std::shared_ptr<engine::Shader>(variant, [](engine::Shader*) {
+        // Empty deleter - ShaderLoader owns the shader
+    });
 }
 
 void PS1Material::SetAuthenticPS1() {
@@ -47,6 +95,9 @@ void PS1Material::SetAuthenticPS1() {
     fogStart = 15.0f;
     fogEnd = 30.0f;
     fogColor = glm::vec3(0.5f, 0.5f, 0.6f);
+    affineMapping = true;
+    vertexLighting = true;
+    SelectVariant();
 }
 
 void PS1Material::SetPS1Inspired() {
@@ -58,6 +109,9 @@ void PS1Material::SetPS1Inspired() {
     fogStart = 20.0f;
     fogEnd = 50.0f;
     fogColor = glm::vec3(0.5f, 0.5f, 0.6f);
+    affineMapping = true;
+    vertexLighting = true;
+    SelectVariant();
 }
 
 void PS1Material::SetAffineOnly() {
@@ -69,10 +123,11 @@ void PS1Material::SetAffineOnly() {
     fogStart = 1000.0f;                          // Effectively disable fog
     fogEnd = 2000.0f;
     fogColor = glm::vec3(0.0f);
+    affineMapping = true;
+    vertexLighting = true;
+    SelectVariant();                             // Snap-free variant
     
     // Still keep nearest-neighbor filtering for pixelated textures
-    if (sampler) {
-        sampler->SetMinFilter(GL_NEAREST);
-        sampler->SetMagFilter(GL_NEAREST);
-    }
+    // (the sampler is shared: swap it rather than changing its filters)
+    sampler = nearestSampler();
 }
\ No newline at end of file
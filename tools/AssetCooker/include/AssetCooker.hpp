@@ -0,0 +1,94 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * AssetCooker - Offline conversion of a scene's assets to runtime formats
+ *
+ * For every model, texture and shader a scene references:
+ * - Models   -> .emesh (packed vertices/indices/meshlets and the node
+ *               hierarchy, memory-mapped at load); textures their glTF
+ *               materials use are cooked too and referenced by the .emesh
+ * - Textures -> .etex  (decoded, flipped pixels, memory-mapped at load)
+ * - Shaders  -> #includes resolved into one file, then compiled and linked
+ *               (base program and each listed variant) on a hidden GL
+ *               context when one is available
+ *
+ * The cooked tree mirrors the source root. Each scene gets a cooked copy
+ * whose asset paths point at the cooked files, and manifest.json records the
+ * content hash each output was built from: inputs whose hash is unchanged
+ * are skipped. Assets are cooked in parallel on the JobSystem.
+ *
+ * With a partition cell size, each cooked scene also gets a streamed copy
+ * (<scene>_world.json and its cells, see engine::WorldPartition::Split).
+ */
+class AssetCooker {
+public:
+    struct Options {
+        std::filesystem::path root = "game/assets";  // Source assets
+        std::filesystem::path output = "game/cooked";
+        bool force = false;            // Ignore the manifest and re-cook everything
+        bool validateShaders = true;   // Compile re-cooked shaders on a hidden GL context
+        float partitionCellSize = 0.0f;  // > 0: also write a world-partitioned copy
+    };
+
+    struct Stats {
+        size_t cooked = 0;
+        size_t upToDate = 0;
+        size_t missing = 0;   // Referenced but not on disk; left pointing at the source
+        size_t failed = 0;
+    };
+
+    explicit AssetCooker(Options options);
+
+    // Cook everything the scene references and write its cooked copy.
+    // False if an existing asset failed to cook or validate.
+    bool CookScene(const std::string& scenePath);
+
+    // Write <output>/manifest.json
+    bool WriteManifest() const;
+
+    const Stats& GetStats() const { return m_Stats; }
+
+private:
+    enum class AssetType { Model, Texture, Shader };
+    enum class Status { Pending, Cooked, UpToDate, Missing, Failed };
+
+    struct Asset {
+        AssetType type = AssetType::Model;
+        std::filesystem::path source;
+        std::filesystem::path output;
+        std::string key;  // Source path relative to the root (manifest key)
+        uint64_t hash = 0;
+        std::vector<std::string> dependencies;  // Other files hashed into `hash`
+        Status status = Status::Pending;
+    };
+
+    // A shader program to validate: its two stage assets and define sets
+    struct Program {
+        std::string name;
+        size_t vertex = 0;
+        size_t fragment = 0;
+        std::vector<std::vector<std::string>> variants;
+    };
+
+    Options m_Options;
+    nlohmann::json m_Manifest;
+    std::vector<Asset> m_Assets;
+    std::map<std::string, size_t> m_AssetIndex;  // Source path -> m_Assets slot
+    Stats m_Stats;
+
+    size_t addAsset(AssetType type, const std::filesystem::path& source);
+    void cookAsset(Asset& asset) const;
+    bool hashAsset(Asset& asset) const;
+    bool isUpToDate(const Asset& asset) const;
+    void validatePrograms(const std::vector<Program>& programs);
+    std::string cookedPath(const std::string& path, const std::filesystem::path& sceneDir,
+                           const std::filesystem::path& cookedSceneDir) const;
+};
@@ -0,0 +1,73 @@
+#include "AssetCooker.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+void printUsage() {
+    std::cout << "Usage: AssetCooker [--root DIR] [--out DIR] [--force] [--no-validate] [--partition SIZE] scene.json...\n"
+              << "  --root DIR      Source asset root mirrored into the output (default game/assets)\n"
+              << "  --out DIR       Cooked output directory (default game/cooked)\n"
+              << "  --force         Re-cook everything, ignoring the manifest\n"
+              << "  --no-validate   Don't compile shaders on a hidden GL context\n"
+              << "  --partition SIZE  Also write <scene>_world.json streaming cells of SIZE units\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    AssetCooker::Options options;
+    std::vector<std::string> scenes;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--root" && i + 1 < argc) {
+            options.root = argv[++i];
+        } else if (arg == "--out" && i + 1 < argc) {
+            options.output = argv[++i];
+        } else if (arg == "--force") {
+            options.force = true;
+        } else if (arg == "--no-validate") {
+            options.validateShaders = false;
+        } else if (arg == "--partition" && i + 1 < argc) {
+            options.partitionCellSize = std::strtof(argv[++i], nullptr);
+            if (options.partitionCellSize <= 0.0f) {
+                std::cerr << "--partition needs a positive cell size\n";
+                return 1;
+            }
+        } else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Unknown option: " << arg << "\n";
+            printUsage();
+            return 1;
+        } else {
+            scenes.push_back(arg);
+        }
+    }
+    if (scenes.empty()) {
+        printUsage();
+        return 1;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    AssetCooker cooker(options);
+
+    bool ok = true;
+    for (const std::string& scene : scenes) {
+        ok = cooker.CookScene(scene) && ok;
+    }
+    ok = cooker.WriteManifest() && ok;
+
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    const auto& stats = cooker.GetStats();
+    std::cout << "AssetCooker: " << stats.cooked << " cooked, " << stats.upToDate << " up to date, "
+              << stats.missing << " missing, " << stats.failed << " failed in " << elapsed.count() << " ms ("
+              << engine::JobSystem::Instance().GetWorkerCount() + 1 << " threads)\n";
+    return ok ? 0 : 1;
+}
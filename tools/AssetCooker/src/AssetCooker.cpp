@@ -0,0 +1,516 @@
+#include "AssetCooker.hpp"
+#include "Engine/Assets/Cache/AssetCache.hpp"
+#include "Engine/Assets/Formats/EMeshFormat.hpp"
+#include "Engine/Assets/Formats/ETexFormat.hpp"
+#include "Engine/Assets/Loaders/Mesh/MeshLoader.hpp"
+#include "Engine/Core/Graphics/Shader/ShaderPreprocessor.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/Core/Utility/Hash.hpp"
+#include "Engine/Scene/SceneLoader.hpp"
+#include "Engine/Scene/WorldPartition.hpp"
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <stb_image.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+using json = nlohmann::json;
+
+namespace {
+
+// Bump whenever an output format or the import pipeline changes, so
+// everything cooked by an older cooker is rebuilt
+constexpr uint32_t kCookerVersion = 2;
+constexpr int kManifestVersion = 1;
+
+const char* typeName(int type) {
+    static const char* names[] = {"model", "texture", "shader"};
+    return names[type];
+}
+
+bool readFile(const fs::path& path, std::string& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    out = buffer.str();
+    return true;
+}
+
+// Write to a temp file and rename so a crash never leaves a torn file
+bool writeFile(const fs::path& path, const std::string& contents) {
+    const fs::path tmpPath = path.string() + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        if (!file) return false;
+    }
+    std::error_code ec;
+    fs::rename(tmpPath, path, ec);
+    if (ec) fs::remove(tmpPath, ec);
+    return !ec;
+}
+
+// External files of a .gltf/.glb's "buffers" or "images"; shared with the
+// runtime cache so both track the same dependencies
+std::vector<fs::path> gltfExternalFiles(const fs::path& gltfPath, const char* section) {
+    std::vector<fs::path> files;
+    for (const std::string& file : engine::AssetCache::GetGltfReferences(gltfPath.string(), section)) {
+        files.emplace_back(file);
+    }
+    return files;
+}
+
+bool isGltf(const fs::path& path) {
+    return path.extension() == ".gltf" || path.extension() == ".glb";
+}
+
+bool compileStage(GLenum type, const std::string& source, GLuint& shader, std::string& log) {
+    shader = glCreateShader(type);
+    const char* src = source.c_str();
+    glShaderSource(shader, 1, &src, nullptr);
+    glCompileShader(shader);
+
+    GLint success = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+    if (success) return true;
+
+    char infoLog[1024];
+    glGetShaderInfoLog(shader, sizeof(infoLog), nullptr, infoLog);
+    log = infoLog;
+    return false;
+}
+
+bool buildProgram(const std::string& vertexSource, const std::string& fragmentSource, std::string& log) {
+    GLuint vertex = 0;
+    GLuint fragment = 0;
+    bool ok = compileStage(GL_VERTEX_SHADER, vertexSource, vertex, log) &&
+              compileStage(GL_FRAGMENT_SHADER, fragmentSource, fragment, log);
+
+    if (ok) {
+        const GLuint program = glCreateProgram();
+        glAttachShader(program, vertex);
+        glAttachShader(program, fragment);
+        glLinkProgram(program);
+
+        GLint success = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success) {
+            char infoLog[1024];
+            glGetProgramInfoLog(program, sizeof(infoLog), nullptr, infoLog);
+            log = infoLog;
+            ok = false;
+        }
+        glDeleteProgram(program);
+    }
+
+    if (vertex) glDeleteShader(vertex);
+    if (fragment) glDeleteShader(fragment);
+    return ok;
+}
+
+} // namespace
+
+AssetCooker::AssetCooker(Options options) : m_Options(std::move(options)) {
+    m_Options.root = fs::weakly_canonical(m_Options.root);
+    m_Options.output = fs::weakly_canonical(m_Options.output);
+
+    // The manifest already skips unchanged inputs; don't also fill the runtime cache
+    engine::AssetCache::Instance().SetEnabled(false);
+
+    // Start from the previous run's manifest so unchanged inputs are skipped
+    std::string contents;
+    if (!m_Options.force && readFile(m_Options.output / "manifest.json", contents)) {
+        m_Manifest = json::parse(contents, nullptr, false);
+    }
+    if (m_Manifest.is_discarded() || !m_Manifest.is_object() ||
+        m_Manifest.value("version", 0) != kManifestVersion ||
+        m_Manifest.value("cookerVersion", 0u) != kCookerVersion) {
+        m_Manifest = json::object();
+    }
+    m_Manifest["version"] = kManifestVersion;
+    m_Manifest["cookerVersion"] = kCookerVersion;
+    if (!m_Manifest.contains("assets")) m_Manifest["assets"] = json::object();
+}
+
+size_t AssetCooker::addAsset(AssetType type, const fs::path& source) {
+    const fs::path canonical = fs::weakly_canonical(source);
+    const std::string sourceKey = canonical.generic_string();
+
+    auto it = m_AssetIndex.find(sourceKey);
+    if (it != m_AssetIndex.end()) return it->second;
+
+    Asset asset;
+    asset.type = type;
+    asset.source = canonical;
+
+    // Mirror the source tree; anything outside the root goes under external/
+    fs::path relative = canonical.lexically_relative(m_Options.root);
+    if (relative.empty() || *relative.begin() == "..") {
+        relative = fs::path("external") /
+                   (engine::HashToHex(engine::HashString(sourceKey)) + "_" + canonical.filename().string());
+        asset.key = sourceKey;
+    } else {
+        asset.key = relative.generic_string();
+    }
+
+    asset.output = m_Options.output / relative;
+    if (type == AssetType::Model) asset.output.replace_extension(engine::EMeshFormat::Extension);
+    if (type == AssetType::Texture) asset.output.replace_extension(engine::ETexFormat::Extension);
+
+    m_Assets.push_back(std::move(asset));
+    m_AssetIndex[sourceKey] = m_Assets.size() - 1;
+    return m_Assets.size() - 1;
+}
+
+bool AssetCooker::hashAsset(Asset& asset) const {
+    uint64_t hash = engine::HashString(typeName(static_cast<int>(asset.type)));
+    hash = engine::HashBytes(&kCookerVersion, sizeof(kCookerVersion), hash);
+
+    std::string contents;
+    if (asset.type == AssetType::Shader) {
+        // Hash what gets compiled, so edits to an #include re-cook its users
+        if (!engine::ShaderPreprocessor::Process(asset.source.string(), {}, contents)) return false;
+    } else if (!readFile(asset.source, contents)) {
+        return false;
+    }
+    hash = engine::HashString(contents, hash);
+
+    if (asset.type == AssetType::Model && isGltf(asset.source)) {
+        for (const fs::path& buffer : gltfExternalFiles(asset.source, "buffers")) {
+            std::string bytes;
+            readFile(buffer, bytes);  // A missing buffer fails the import itself
+            hash = engine::HashString(bytes, hash);
+            const fs::path dependency = fs::weakly_canonical(buffer);
+            const fs::path relative = dependency.lexically_relative(m_Options.root);
+            const bool underRoot = !relative.empty() && *relative.begin() != "..";
+            asset.dependencies.push_back((underRoot ? relative : dependency).generic_string());
+        }
+    }
+
+    asset.hash = hash;
+    return true;
+}
+
+bool AssetCooker::isUpToDate(const Asset& asset) const {
+    const json& assets = m_Manifest["assets"];
+    auto it = assets.find(asset.key);
+    if (it == assets.end()) return false;
+
+    const std::string output = asset.output.lexically_relative(m_Options.output).generic_string();
+    return it->value("hash", "") == engine::HashToHex(asset.hash) &&
+           it->value("output", "") == output &&
+           fs::exists(asset.output);
+}
+
+void AssetCooker::cookAsset(Asset& asset) const {
+    std::error_code ec;
+    fs::create_directories(asset.output.parent_path(), ec);  // Other workers may race us here
+
+    const std::string source = asset.source.string();
+    const std::string output = asset.output.string();
+    bool ok = false;
+
+    switch (asset.type) {
+        case AssetType::Model: {
+            std::vector<engine::MeshData> meshes;
+            engine::ModelHierarchy hierarchy;
+            ok = engine::MeshLoader::ImportMeshData(source, meshes, &hierarchy);
+            if (!ok) break;
+
+            // Material textures were queued as texture assets: point at their
+            // cooked files, relative to the .emesh like the source was
+            for (engine::ModelMaterial& material : hierarchy.materials) {
+                if (material.baseColorTexture.empty()) continue;
+                const fs::path texture = fs::weakly_canonical(asset.source.parent_path() / material.baseColorTexture);
+                auto it = m_AssetIndex.find(texture.generic_string());
+                material.baseColorTexture = it != m_AssetIndex.end() && fs::exists(texture)
+                    ? m_Assets[it->second].output.lexically_relative(asset.output.parent_path()).generic_string()
+                    : texture.generic_string();
+            }
+            ok = engine::EMeshFormat::Write(output, meshes, &hierarchy);
+            break;
+        }
+        case AssetType::Texture: {
+            // Bottom row first, as Texture uploads it
+            stbi_set_flip_vertically_on_load_thread(true);
+            int width = 0, height = 0, channels = 0;
+            unsigned char* pixels = stbi_load(source.c_str(), &width, &height, &channels, 0);
+            if (!pixels) {
+                std::cerr << "AssetCooker: cannot decode " << source << ": " << stbi_failure_reason() << "\n";
+                break;
+            }
+            ok = engine::ETexFormat::Write(output, pixels, width, height, channels);
+            stbi_image_free(pixels);
+            break;
+        }
+        case AssetType::Shader: {
+            // Variant defines are still injected at runtime; only #includes are resolved here
+            std::string flattened;
+            ok = engine::ShaderPreprocessor::Process(source, {}, flattened) && writeFile(asset.output, flattened);
+            break;
+        }
+    }
+
+    asset.status = ok ? Status::Cooked : Status::Failed;
+}
+
+void AssetCooker::validatePrograms(const std::vector<Program>& programs) {
+    // Only programs with a freshly cooked stage; the rest passed on an earlier run
+    std::vector<const Program*> pending;
+    for (const Program& program : programs) {
+        const Status vertex = m_Assets[program.vertex].status;
+        const Status fragment = m_Assets[program.fragment].status;
+        const bool cookable = (vertex == Status::Cooked || vertex == Status::UpToDate) &&
+                              (fragment == Status::Cooked || fragment == Status::UpToDate);
+        if (cookable && (vertex == Status::Cooked || fragment == Status::Cooked)) {
+            pending.push_back(&program);
+        }
+    }
+    if (pending.empty() || !m_Options.validateShaders) return;
+
+    if (!glfwInit()) {
+        std::cerr << "AssetCooker: no display, shaders were preprocessed but not compiled\n";
+        return;
+    }
+    glfwDefaultWindowHints();
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    GLFWwindow* window = glfwCreateWindow(1, 1, "AssetCooker", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "AssetCooker: no GL 3.3 context, shaders were preprocessed but not compiled\n";
+        glfwTerminate();
+        return;
+    }
+    glfwMakeContextCurrent(window);
+
+    if (gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))) {
+        for (const Program* program : pending) {
+            Asset& vertex = m_Assets[program->vertex];
+            Asset& fragment = m_Assets[program->fragment];
+
+            for (const auto& defines : program->variants) {
+                std::string vertexSource;
+                std::string fragmentSource;
+                std::string log;
+                engine::ShaderPreprocessor::Process(vertex.output.string(), defines, vertexSource);
+                engine::ShaderPreprocessor::Process(fragment.output.string(), defines, fragmentSource);
+                if (buildProgram(vertexSource, fragmentSource, log)) continue;
+
+                std::cerr << "AssetCooker: shader '" << program->name << "'";
+                for (const auto& define : defines) std::cerr << " " << define;
+                std::cerr << " failed to build:\n" << log << "\n";
+                vertex.status = Status::Failed;
+                fragment.status = Status::Failed;
+                break;
+            }
+        }
+    } else {
+        std::cerr << "AssetCooker: failed to load GL functions, shaders were not compiled\n";
+    }
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+}
+
+std::string AssetCooker::cookedPath(const std::string& path, const fs::path& sceneDir,
+                                    const fs::path& cookedSceneDir) const {
+    const fs::path source = fs::weakly_canonical(sceneDir / path);
+    fs::path target = source;
+
+    auto it = m_AssetIndex.find(source.generic_string());
+    if (it != m_AssetIndex.end()) {
+        const Asset& asset = m_Assets[it->second];
+        if (asset.status == Status::Cooked || asset.status == Status::UpToDate) {
+            target = asset.output;
+        }
+    }
+
+    // Cooked files relative to the cooked scene (the tree can be moved);
+    // missing or failed assets keep loading from their source
+    const fs::path relative = target.lexically_relative(m_Options.output);
+    if (relative.empty() || *relative.begin() == "..") return target.generic_string();
+    return target.lexically_relative(cookedSceneDir).generic_string();
+}
+
+bool AssetCooker::CookScene(const std::string& scenePath) {
+    std::string contents;
+    if (!readFile(scenePath, contents)) {
+        std::cerr << "AssetCooker: cannot open scene " << scenePath << "\n";
+        return false;
+    }
+    json scene = json::parse(contents, nullptr, false);
+    if (scene.is_discarded()) {
+        std::cerr << "AssetCooker: cannot parse scene " << scenePath << "\n";
+        return false;
+    }
+
+    std::cout << "--- Cooking " << scenePath << " ---\n";
+    const fs::path sceneDir = fs::weakly_canonical(scenePath).parent_path();
+    json& assets = scene["assets"];
+
+    // Collect everything referenced (shared assets are cooked once across scenes)
+    std::vector<Program> programs;
+    if (assets.contains("shaders")) {
+        for (auto& [name, paths] : assets["shaders"].items()) {
+            Program program;
+            program.name = name;
+            program.vertex = addAsset(AssetType::Shader, sceneDir / paths["vertex"].get<std::string>());
+            program.fragment = addAsset(AssetType::Shader, sceneDir / paths["fragment"].get<std::string>());
+            program.variants.push_back({});
+            if (paths.contains("variants")) {
+                for (const auto& variant : paths["variants"]) {
+                    program.variants.push_back(variant.get<std::vector<std::string>>());
+                }
+            }
+            programs.push_back(std::move(program));
+        }
+    }
+    if (assets.contains("textures")) {
+        for (auto& [name, path] : assets["textures"].items()) {
+            addAsset(AssetType::Texture, sceneDir / path.get<std::string>());
+        }
+    }
+    if (assets.contains("models")) {
+        for (auto& [name, model] : assets["models"].items()) {
+            const std::string path = model.is_object() ? model["path"].get<std::string>() : model.get<std::string>();
+            const size_t index = addAsset(AssetType::Model, sceneDir / path);
+
+            // Textures the model's materials use are cooked alongside it
+            const fs::path source = m_Assets[index].source;
+            if (isGltf(source)) {
+                for (const fs::path& image : gltfExternalFiles(source, "images")) {
+                    addAsset(AssetType::Texture, image);
+                }
+            }
+        }
+    }
+
+    std::vector<size_t> pending;
+    for (size_t i = 0; i < m_Assets.size(); ++i) {
+        if (m_Assets[i].status == Status::Pending) pending.push_back(i);
+    }
+
+    // One asset per job: imports vary wildly in cost
+    engine::JobSystem::Instance().ParallelFor(pending.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Asset& asset = m_Assets[pending[i]];
+            if (!fs::exists(asset.source)) {
+                asset.status = Status::Missing;
+            } else if (!hashAsset(asset)) {
+                asset.status = Status::Failed;
+            } else if (!m_Options.force && isUpToDate(asset)) {
+                asset.status = Status::UpToDate;
+            } else {
+                cookAsset(asset);
+            }
+        }
+    });
+
+    validatePrograms(programs);
+
+    bool ok = true;
+    json& manifestAssets = m_Manifest["assets"];
+    for (size_t index : pending) {
+        const Asset& asset = m_Assets[index];
+        const char* type = typeName(static_cast<int>(asset.type));
+
+        switch (asset.status) {
+            case Status::Cooked:
+            case Status::UpToDate: {
+                json entry;
+                entry["type"] = type;
+                entry["source"] = asset.key;
+                entry["output"] = asset.output.lexically_relative(m_Options.output).generic_string();
+                entry["hash"] = engine::HashToHex(asset.hash);
+                entry["dependencies"] = asset.dependencies;
+                manifestAssets[asset.key] = std::move(entry);
+
+                if (asset.status == Status::Cooked) {
+                    m_Stats.cooked++;
+                    std::cout << "✓ Cooked " << type << ": " << asset.key << "\n";
+                } else {
+                    m_Stats.upToDate++;
+                }
+                break;
+            }
+            case Status::Missing:
+                m_Stats.missing++;
+                std::cerr << "Warning: missing " << type << ": " << asset.source.string() << "\n";
+                break;
+            default:
+                m_Stats.failed++;
+                ok = false;
+                manifestAssets.erase(asset.key);  // Retry next run
+                std::cerr << "ERROR: failed to cook " << type << ": " << asset.key << "\n";
+                break;
+        }
+    }
+
+    // Cooked copy of the scene: same layout, asset paths swapped for cooked files
+    fs::path cookedScene = fs::weakly_canonical(scenePath).lexically_relative(m_Options.root);
+    if (cookedScene.empty() || *cookedScene.begin() == "..") {
+        cookedScene = fs::path("scenes") / fs::path(scenePath).filename();
+    }
+    cookedScene = m_Options.output / cookedScene;
+    const fs::path cookedSceneDir = cookedScene.parent_path();
+
+    if (assets.contains("shaders")) {
+        for (auto& [name, paths] : assets["shaders"].items()) {
+            paths["vertex"] = cookedPath(paths["vertex"].get<std::string>(), sceneDir, cookedSceneDir);
+            paths["fragment"] = cookedPath(paths["fragment"].get<std::string>(), sceneDir, cookedSceneDir);
+        }
+    }
+    if (assets.contains("textures")) {
+        for (auto& [name, path] : assets["textures"].items()) {
+            path = cookedPath(path.get<std::string>(), sceneDir, cookedSceneDir);
+        }
+    }
+    if (assets.contains("models")) {
+        for (auto& [name, model] : assets["models"].items()) {
+            json& path = model.is_object() ? model["path"] : model;
+            path = cookedPath(path.get<std::string>(), sceneDir, cookedSceneDir);
+        }
+    }
+    if (assets.empty()) scene.erase("assets");
+
+    std::error_code ec;
+    fs::create_directories(cookedSceneDir, ec);
+    if (!writeFile(cookedScene, scene.dump(2))) {
+        std::cerr << "AssetCooker: cannot write " << cookedScene.string() << "\n";
+        return false;
+    }
+    std::cout << "✓ Wrote " << cookedScene.string() << "\n";
+
+    // Binary twin next to it: the game instantiates it without parsing JSON
+    const fs::path binaryScene = fs::path(cookedScene).replace_extension(engine::ESceneFormat::Extension);
+    if (!engine::SceneLoader::ConvertScene(cookedScene.string(), binaryScene.string())) {
+        std::cerr << "AssetCooker: cannot write " << binaryScene.string() << "\n";
+        return false;
+    }
+    std::cout << "✓ Wrote " << binaryScene.string() << "\n";
+
+    // Streamed copy: persistent entities in <scene>_world.json, the rest in cells
+    if (m_Options.partitionCellSize > 0.0f) {
+        const fs::path worldScene = cookedSceneDir / (cookedScene.stem().string() + "_world.json");
+        if (!engine::WorldPartition::Split(cookedScene.string(), worldScene.string(), m_Options.partitionCellSize)) {
+            std::cerr << "AssetCooker: cannot partition " << cookedScene.string() << "\n";
+            return false;
+        }
+    }
+    return ok;
+}
+
+bool AssetCooker::WriteManifest() const {
+    std::error_code ec;
+    fs::create_directories(m_Options.output, ec);
+    if (!writeFile(m_Options.output / "manifest.json", m_Manifest.dump(2))) {
+        std::cerr << "AssetCooker: cannot write manifest in " << m_Options.output.string() << "\n";
+        return false;
+    }
+    return true;
+}
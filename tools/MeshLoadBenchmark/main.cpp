@@ -0,0 +1,97 @@
+// MeshLoadBenchmark - parses each source model, bakes it to .emesh, then
+// times mapping the .emesh instead. Pure CPU (no window needed).
+//
+//   MeshLoadBenchmark [models...]
+//
+// Without arguments the game's Cat and AbandonedHouse glTFs are used; paths
+// are relative to the working directory (run from the repository root).
+
+#include "Engine/Assets/Formats/EMeshFormat.hpp"
+#include "Engine/Assets/Loaders/Mesh/MeshLoader.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Row {
+    std::string name;
+    size_t meshes = 0;
+    double parseMs = 0.0;
+    double mapMs = 0.0;
+    double readMs = 0.0;
+    uintmax_t sourceBytes = 0;
+    uintmax_t cookedBytes = 0;
+};
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::string> sources(argv + 1, argv + argc);
+    if (sources.empty()) {
+        sources = {"game/assets/models/Cat/scene.gltf", "game/assets/models/AbandonedHouse/scene.gltf"};
+    }
+
+    const std::filesystem::path outDir = std::filesystem::temp_directory_path() / "emesh_benchmark";
+    std::error_code ec;
+    std::filesystem::create_directories(outDir, ec);
+
+    std::vector<Row> rows;
+    for (const std::string& source : sources) {
+        Row row;
+        row.name = std::filesystem::path(source).filename().string();
+        row.sourceBytes = std::filesystem::file_size(source, ec);
+
+        std::vector<engine::MeshData> imported;
+        auto start = std::chrono::steady_clock::now();
+        if (!engine::MeshLoader::ImportMeshData(source, imported)) continue;
+        row.parseMs = millisecondsSince(start);
+        row.meshes = imported.size();
+
+        const std::string cooked = (outDir / (std::filesystem::path(source).stem().string() + "_" +
+                                              std::to_string(rows.size()) + engine::EMeshFormat::Extension)).string();
+        if (!engine::EMeshFormat::Write(cooked, imported)) continue;
+        row.cookedBytes = std::filesystem::file_size(cooked, ec);
+
+        // Mapping alone defers the I/O to the upload, so also time reading every byte once
+        std::vector<engine::MeshData> mapped;
+        start = std::chrono::steady_clock::now();
+        engine::EMeshFormat::Read(cooked, mapped);
+        row.mapMs = millisecondsSince(start);
+
+        uint64_t checksum = 0;
+        for (const engine::MeshData& mesh : mapped) {
+            for (size_t i = 0; i < mesh.vertexSize; i += 64) checksum += mesh.vertexBytes[i];
+            for (size_t i = 0; i < mesh.indexSize; i += 64) checksum += mesh.indexBytes[i];
+        }
+        row.readMs = millisecondsSince(start);
+
+        // Stored so the reads can't be optimized away
+        volatile uint64_t sink = checksum;
+        (void)sink;
+
+        rows.push_back(row);
+    }
+
+    std::cout << "\n--- Mesh load: source parse vs .emesh ---\n";
+    for (const Row& row : rows) {
+        std::cout << "  " << row.name << " (" << row.meshes << " meshes, "
+                  << row.sourceBytes / 1024 << " KB -> " << row.cookedBytes / 1024 << " KB)\n"
+                  << "    parse + pack:  " << row.parseMs << " ms\n"
+                  << "    .emesh map:    " << row.mapMs << " ms\n"
+                  << "    .emesh + read: " << row.readMs << " ms  (" << row.parseMs / std::max(row.readMs, 1e-3)
+                  << "x faster)\n";
+    }
+    std::filesystem::remove_all(outDir, ec);
+    return 0;
+}
@@ -0,0 +1,213 @@
+// ObjImportBenchmark - times OBJ parsing + vertex welding: the previous
+// tinyobjloader path with string-keyed dedup against engine::ObjParser.
+//
+//   ObjImportBenchmark [--mb N] [--threads N] [file.obj]
+//
+// Without a file, a synthetic grid OBJ of about N MB (default 256) is written
+// to the temp directory and removed afterwards.
+
+#include "Engine/Assets/Importers/ObjParser.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+
+#define TINYOBJLOADER_IMPLEMENTATION
+#include "tiny_obj_loader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct Counts {
+    size_t shapes = 0;
+    size_t vertices = 0;
+    size_t triangles = 0;
+};
+
+double millisecondsSince(std::chrono::steady_clock::time_point start) {
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+// Square grids of v/vt/vn triples with quad faces, one object per grid
+bool writeSyntheticObj(const std::string& path, size_t targetBytes) {
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) return false;
+
+    constexpr size_t kBytesPerCell = 160;  // Roughly: v + vt + vn lines and a quad face
+    constexpr size_t kObjects = 8;
+    const size_t cells = std::max<size_t>(1, targetBytes / kBytesPerCell / kObjects);
+    const size_t side = std::max<size_t>(2, static_cast<size_t>(std::sqrt(static_cast<double>(cells))) + 1);
+
+    size_t base = 0;
+    char line[256];
+    for (size_t o = 0; o < kObjects; ++o) {
+        std::fprintf(file, "o Grid_%zu\n", o);
+        for (size_t y = 0; y < side; ++y) {
+            for (size_t x = 0; x < side; ++x) {
+                const float fx = static_cast<float>(x) / (side - 1);
+                const float fy = static_cast<float>(y) / (side - 1);
+                const float h = 0.25f * std::sin(fx * 12.0f + o) * std::cos(fy * 9.0f);
+                int n = std::snprintf(line, sizeof(line), "v %.6f %.6f %.6f\nvt %.6f %.6f\nvn %.6f %.6f %.6f\n",
+                                      fx * 10.0f + o * 11.0f, h, fy * 10.0f, fx, fy, -h, 1.0f, 0.0f);
+                std::fwrite(line, 1, static_cast<size_t>(n), file);
+            }
+        }
+        for (size_t y = 0; y + 1 < side; ++y) {
+            for (size_t x = 0; x + 1 < side; ++x) {
+                const size_t a = base + y * side + x + 1;
+                const size_t b = a + 1, c = a + side + 1, d = a + side;
+                int n = std::snprintf(line, sizeof(line), "f %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu %zu/%zu/%zu\n",
+                                      a, a, a, b, b, b, c, c, c, d, d, d);
+                std::fwrite(line, 1, static_cast<size_t>(n), file);
+            }
+        }
+        base += side * side;
+    }
+    return std::fclose(file) == 0;
+}
+
+// The importer as it was: tinyobj, then a string key per corner
+bool loadLegacy(const std::string& path, Counts& counts) {
+    tinyobj::attrib_t attrib;
+    std::vector<tinyobj::shape_t> shapes;
+    std::vector<tinyobj::material_t> materials;
+    std::string warn, err;
+    if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.c_str())) {
+        std::cerr << "TinyObjLoader Error: " << warn << err << "\n";
+        return false;
+    }
+
+    for (const tinyobj::shape_t& shape : shapes) {
+        std::vector<engine::Vertex> vertices;
+        std::vector<unsigned int> indices;
+        std::unordered_map<std::string, unsigned int> uniqueVertices;
+
+        for (const auto& index : shape.mesh.indices) {
+            engine::Vertex vertex{};
+            vertex.Position = glm::vec3(attrib.vertices[3 * index.vertex_index + 0],
+                                        attrib.vertices[3 * index.vertex_index + 1],
+                                        attrib.vertices[3 * index.vertex_index + 2]);
+            if (index.normal_index >= 0) {
+                vertex.Normal = glm::vec3(attrib.normals[3 * index.normal_index + 0],
+                                          attrib.normals[3 * index.normal_index + 1],
+                                          attrib.normals[3 * index.normal_index + 2]);
+            }
+            if (index.texcoord_index >= 0) {
+                vertex.TexCoords = glm::vec2(attrib.texcoords[2 * index.texcoord_index + 0],
+                                             attrib.texcoords[2 * index.texcoord_index + 1]);
+            }
+
+            std::string key = std::to_string(index.vertex_index) + "/" +
+                              std::to_string(index.normal_index) + "/" +
+                              std::to_string(index.texcoord_index);
+
+            auto it = uniqueVertices.find(key);
+            if (it == uniqueVertices.end()) {
+                const unsigned int newIndex = static_cast<unsigned int>(vertices.size());
+                uniqueVertices.emplace(key, newIndex);
+                vertices.push_back(vertex);
+                indices.push_back(newIndex);
+            } else {
+                indices.push_back(it->second);
+            }
+        }
+
+        if (vertices.empty()) continue;
+        ++counts.shapes;
+        counts.vertices += vertices.size();
+        counts.triangles += indices.size() / 3;
+    }
+    return true;
+}
+
+bool loadParser(const std::string& path, Counts& counts) {
+    engine::ObjParser::Result result;
+    if (!engine::ObjParser::Load(path, result)) return false;
+
+    for (const auto& shape : result.shapes) {
+        ++counts.shapes;
+        counts.vertices += shape.vertices.size();
+        counts.triangles += shape.indices.size() / 3;
+    }
+    return true;
+}
+
+void printCounts(const char* label, const Counts& counts, double ms) {
+    std::cout << "  " << label << ms << " ms  (" << counts.shapes << " shapes, " << counts.vertices
+              << " vertices, " << counts.triangles << " triangles)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t megabytes = 256;
+    unsigned int threads = 0;
+    std::string path;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--mb" && i + 1 < argc) {
+            megabytes = std::stoul(argv[++i]);
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threads = static_cast<unsigned int>(std::stoul(argv[++i]));
+        } else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Usage: ObjImportBenchmark [--mb N] [--threads N] [file.obj]\n";
+            return 1;
+        } else {
+            path = arg;
+        }
+    }
+
+    engine::JobSystem::Instance().Init(threads);
+
+    const bool generated = path.empty();
+    if (generated) {
+        path = (std::filesystem::temp_directory_path() / "obj_import_benchmark.obj").string();
+        std::cout << "Writing synthetic OBJ (" << megabytes << " MB): " << path << "\n";
+        if (!writeSyntheticObj(path, megabytes << 20)) {
+            std::cerr << "Failed to write " << path << "\n";
+            return 1;
+        }
+    }
+
+    std::error_code ec;
+    const auto bytes = std::filesystem::file_size(path, ec);
+    std::cout << "OBJ import benchmark: " << path << " (" << (ec ? 0 : bytes >> 20) << " MB, "
+              << engine::JobSystem::Instance().GetWorkerCount() + 1 << " threads)\n";
+
+    Counts legacy, parser;
+
+    auto start = std::chrono::steady_clock::now();
+    const bool legacyOk = loadLegacy(path, legacy);
+    const double legacyMs = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    const bool parserOk = loadParser(path, parser);
+    const double parserMs = millisecondsSince(start);
+
+    if (generated) std::filesystem::remove(path, ec);
+
+    if (!legacyOk || !parserOk) {
+        std::cerr << "Import failed\n";
+        return 1;
+    }
+
+    printCounts("tinyobj + string keys: ", legacy, legacyMs);
+    printCounts("ObjParser:             ", parser, parserMs);
+    std::cout << "  Speedup: " << legacyMs / std::max(parserMs, 1e-3) << "x\n";
+
+    if (legacy.shapes != parser.shapes || legacy.vertices != parser.vertices ||
+        legacy.triangles != parser.triangles) {
+        // tinyobj ear-clips polygons (dropping degenerate ones); ObjParser fans
+        // them, so only triangle-only files are expected to match exactly
+        std::cout << "  Note: counts differ between the importers\n";
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+// SceneLoadScaling - times complete scene loads (imports, decodes and
+// uploads all finished) with 1..N JobSystem workers. Opens a window for the
+// GL context.
+//
+//   SceneLoadScaling [scene]
+//
+// Without a scene, the game's example scene is used, preferring the
+// AssetCooker's output like the game does; run from the repository root.
+
+#include "Engine/Assets/Cache/AssetCache.hpp"
+#include "Engine/Assets/Loaders/Mesh/MeshLoader.hpp"
+#include "Engine/Assets/Loaders/Shader/ShaderLoader.hpp"
+#include "Engine/Assets/Loaders/Texture/TextureLoader.hpp"
+#include "Engine/Core/Graphics/Texture/TextureStreamer.hpp"
+#include "Engine/Core/Graphics/Upload/UploadQueue.hpp"
+#include "Engine/Core/Jobs/JobSystem.hpp"
+#include "Engine/ECS/Core/World/World.hpp"
+#include "Engine/Rendering/Core/Renderer.hpp"
+#include "Engine/Scene/SceneLoader.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+double loadOnce(const std::string& scenePath) {
+    const auto start = std::chrono::steady_clock::now();
+    auto world = engine::SceneLoader::LoadScene(scenePath);
+    engine::TextureStreamer::Instance().Flush();
+    engine::UploadQueue::Instance().Flush();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    world.reset();
+    engine::ShaderLoader::Instance().Clear();
+    engine::TextureLoader::Instance().Clear();
+    engine::MeshLoader::Instance().Clear();
+    return elapsed.count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string scenePath = "game/assets/scenes/example_scene.json";
+    if (argc > 1) {
+        scenePath = argv[1];
+    } else {
+        for (const char* cooked : {"game/cooked/scenes/example_scene.escene", "game/cooked/scenes/example_scene.json"}) {
+            if (std::filesystem::exists(cooked)) {
+                scenePath = cooked;
+                break;
+            }
+        }
+    }
+
+    engine::Renderer renderer;
+    if (!renderer.Init()) {
+        std::cerr << "Failed to initialize renderer\n";
+        return 1;
+    }
+
+    // Workers only; the main thread also helps inside ParallelFor
+    const unsigned int hardware = std::max(2u, std::thread::hardware_concurrency());
+    std::vector<unsigned int> workerCounts;
+    for (unsigned int workers = 1; workers < hardware - 1; workers *= 2) workerCounts.push_back(workers);
+    workerCounts.push_back(hardware - 1);
+
+    // Derived .escene/.emesh/.etex would turn every run after the first into
+    // file mapping; parsing and decoding are what the workers are for
+    engine::AssetCache::Instance().SetEnabled(false);
+
+    auto& jobs = engine::JobSystem::Instance();
+    loadOnce(scenePath);  // Warm the OS file cache and the program binaries so every run sees the same state
+
+    std::vector<double> times;
+    for (unsigned int workers : workerCounts) {
+        jobs.Shutdown();
+        jobs.Init(workers);
+        times.push_back(loadOnce(scenePath));
+    }
+
+    std::cout << "\n--- Scene load scaling: " << scenePath << " ---\n";
+    for (size_t i = 0; i < workerCounts.size(); ++i) {
+        std::cout << "  " << workerCounts[i] << " worker(s): " << times[i] << " ms  ("
+                  << times[0] / std::max(times[i], 1e-3) << "x)\n";
+    }
+    return 0;
+}
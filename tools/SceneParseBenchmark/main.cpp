@@ -0,0 +1,156 @@
+// SceneParseBenchmark - generates a JSON scene of about N MB, then loads it
+// in two fresh processes, one per approach, so each reports its own peak RSS:
+// the streamed SceneLoader path against parsing the whole document first
+// (file >> json) and loading from that. Pure CPU (no window needed); the
+// AssetCache is off so only JSON is timed.
+//
+//   SceneParseBenchmark [MB]
+//
+// The per-approach runs re-execute this binary as
+// `SceneParseBenchmark --run <dom|stream> <scene.json>`.
+
+#include "Engine/Assets/Cache/AssetCache.hpp"
+#include "Engine/ECS/Core/World/World.hpp"
+#include "Engine/Scene/SceneLoader.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+constexpr size_t kDefaultMB = 100;
+
+// Peak resident set size of this process in MB
+double peakRssMB() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+    return counters.PeakWorkingSetSize / (1024.0 * 1024.0);
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / (1024.0 * 1024.0);  // Bytes
+#else
+    return usage.ru_maxrss / 1024.0;  // KB
+#endif
+#endif
+}
+
+// Roots with two levels of children (21 entities each); every other entity
+// has a renderer with a tinted material, so components dominate like in a level
+bool writeScene(const std::filesystem::path& path, size_t targetBytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+
+    size_t count = 0;
+    std::function<void(int, int)> writeEntity = [&](int depth, int index) {
+        const size_t id = count++;
+        file << "{\"name\":\"Entity_" << id << "\",\"transform\":{\"position\":[" << index * 2.5f << ","
+             << depth * 1.25f << "," << (id % 97) * 0.5f << "],\"rotation\":[0," << (id % 360) << ",0],"
+             << "\"scale\":" << 1.0f + (id % 4) * 0.25f << "},\"components\":[";
+        if (id % 2 == 0) {
+            file << "{\"type\":\"MeshRenderer\",\"meshIndex\":0,\"material\":{\"type\":\"tinted\",\"tint\":["
+                 << (id % 255) / 255.0f << ",0.5,0.25,1],\"pipelineState\":{\"faceCulling\":true,"
+                 << "\"cullFace\":\"back\",\"depthTesting\":true}}}";
+        }
+        file << "]";
+        if (depth < 2) {
+            file << ",\"children\":[";
+            for (int child = 0; child < 4; ++child) {
+                if (child > 0) file << ",";
+                writeEntity(depth + 1, child);
+            }
+            file << "]";
+        }
+        file << "}";
+    };
+
+    file << "{\"assets\":{},\"entities\":[\n";
+    for (int root = 0; static_cast<size_t>(file.tellp()) < targetBytes; ++root) {
+        if (root > 0) file << ",\n";
+        writeEntity(0, root);
+    }
+    file << "\n]}\n";
+    return static_cast<bool>(file);
+}
+
+// One measured load, in its own process
+int runLoad(const std::string& mode, const std::string& path) {
+    engine::AssetCache::Instance().SetEnabled(false);
+
+    // The loader's own log would interleave with the results
+    std::ostringstream discarded;
+    std::streambuf* console = std::cout.rdbuf(discarded.rdbuf());
+    const auto start = std::chrono::steady_clock::now();
+    std::unique_ptr<engine::World> world;
+    if (mode == "dom") {
+        nlohmann::json sceneJson;
+        std::ifstream file(path);
+        file >> sceneJson;
+        world = engine::SceneLoader::LoadScene(sceneJson, std::filesystem::path(path).parent_path().string());
+    } else {
+        world = engine::SceneLoader::LoadScene(path);
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout.rdbuf(console);
+
+    if (!world) return 1;
+    std::cout << "  " << (mode == "dom" ? "file >> json + load: " : "streamed (SAX):      ") << elapsed.count()
+              << " ms, peak RSS " << peakRssMB() << " MB (" << world->entities.size() << " entities)\n";
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc == 4 && std::string(argv[1]) == "--run") {
+        return runLoad(argv[2], argv[3]);
+    }
+    if (argc > 2 || (argc == 2 && argv[1][0] == '-')) {
+        std::cerr << "Usage: SceneParseBenchmark [MB]\n";
+        return 1;
+    }
+
+    const size_t requested = argc == 2 ? std::strtoul(argv[1], nullptr, 10) : 0;
+    const size_t megabytes = requested > 0 ? requested : kDefaultMB;
+
+    const std::filesystem::path outDir = std::filesystem::temp_directory_path() / "scene_parse_benchmark";
+    const std::filesystem::path scene = outDir / "scene.json";
+    std::error_code ec;
+    std::filesystem::create_directories(outDir, ec);
+    if (!writeScene(scene, megabytes * 1024 * 1024)) {
+        std::cerr << "ERROR: cannot write " << scene.string() << "\n";
+        return 1;
+    }
+
+    std::cout << "\n--- Scene parse: " << std::filesystem::file_size(scene, ec) / (1024 * 1024) << " MB JSON ---\n"
+              << std::flush;
+    int failures = 0;
+    for (const char* mode : {"dom", "stream"}) {
+        const std::string command = "\"" + std::string(argv[0]) + "\" --run " + mode + " \"" + scene.string() + "\"";
+        if (std::system(command.c_str()) != 0) {
+            std::cerr << "ERROR: " << mode << " run failed\n";
+            failures++;
+        }
+    }
+    std::filesystem::remove_all(outDir, ec);
+    return failures;
+}